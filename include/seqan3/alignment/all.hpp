@@ -217,6 +217,7 @@
  #pragma once
 
  #include <seqan3/alignment/aligned_sequence/all.hpp>
+#include <seqan3/alignment/chaining/all.hpp>
  #include <seqan3/alignment/configuration/all.hpp>
  #include <seqan3/alignment/exception.hpp>
  #include <seqan3/alignment/matrix/all.hpp>
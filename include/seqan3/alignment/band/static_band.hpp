@@ -12,6 +12,9 @@
 
 #pragma once
 
+#include <limits>
+#include <stdexcept>
+
 #include <seqan3/core/algorithm/bound.hpp>
 #include <seqan3/std/concepts>
 
@@ -0,0 +1,28 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Meta-header for the \link alignment_chaining chaining submodule \endlink.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+/*!\defgroup alignment_chaining Chaining
+ * \brief Combines exact matches between two sequences into colinear chains that are verified by an alignment.
+ * \ingroup alignment
+ * \see alignment
+ *
+ * \details
+ *
+ * Seeds found with seqan3::search or shared k-mers are given as seqan3::anchor. seqan3::chain_anchors combines them
+ * into seqan3::anchor_chain, whose seqan3::alignment_window restricts a banded seqan3::align_pairwise to the region
+ * around the chain.
+ */
+
+#include <seqan3/alignment/chaining/anchor_chain.hpp>
+#include <seqan3/alignment/chaining/chain_anchors.hpp>
@@ -0,0 +1,147 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::anchor, seqan3::anchor_chain and seqan3::alignment_window.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <seqan3/alignment/band/static_band.hpp>
+
+namespace seqan3
+{
+
+/*!\brief An exact match of length #length between two sequences, e.g. a shared k-mer or a seed found by seqan3::search.
+ * \ingroup alignment_chaining
+ *
+ * \details
+ *
+ * The positions follow the order of the sequences given to seqan3::align_pairwise, i.e. the first sequence is
+ * usually the reference and the second sequence the read.
+ */
+struct anchor
+{
+    size_t first_position{};  //!< The begin position of the anchor in the first sequence.
+    size_t second_position{}; //!< The begin position of the anchor in the second sequence.
+    size_t length{};          //!< The length of the anchor.
+
+    //!\brief The position behind the anchor in the first sequence.
+    constexpr size_t first_end() const noexcept
+    {
+        return first_position + length;
+    }
+
+    //!\brief The position behind the anchor in the second sequence.
+    constexpr size_t second_end() const noexcept
+    {
+        return second_position + length;
+    }
+
+    //!\brief The diagonal of the anchor as used by seqan3::static_band, i.e. the first minus the second position.
+    constexpr std::ptrdiff_t diagonal() const noexcept
+    {
+        return static_cast<std::ptrdiff_t>(first_position) - static_cast<std::ptrdiff_t>(second_position);
+    }
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Returns whether both anchors have the same positions and length.
+    constexpr friend bool operator==(anchor const & lhs, anchor const & rhs) noexcept
+    {
+        return lhs.first_position == rhs.first_position &&
+               lhs.second_position == rhs.second_position &&
+               lhs.length == rhs.length;
+    }
+
+    //!\brief Returns whether the anchors differ.
+    constexpr friend bool operator!=(anchor const & lhs, anchor const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+};
+
+/*!\brief The region of a sequence pair that is aligned to verify a seqan3::anchor_chain.
+ * \ingroup alignment_chaining
+ *
+ * \details
+ *
+ * The window denotes the infixes `[first_begin, first_end)` and `[second_begin, second_end)` of the two sequences.
+ * The #band is given relative to the begin of these infixes and can directly be used with
+ * seqan3::align_cfg::band to align them with seqan3::align_pairwise.
+ */
+struct alignment_window
+{
+    size_t first_begin{};  //!< The begin position of the window in the first sequence.
+    size_t first_end{};    //!< The end position of the window in the first sequence.
+    size_t second_begin{}; //!< The begin position of the window in the second sequence.
+    size_t second_end{};   //!< The end position of the window in the second sequence.
+    static_band band{};    //!< The band around the anchors relative to the begin of the window.
+};
+
+/*!\brief A colinear chain of seqan3::anchor as computed by seqan3::chain_anchors.
+ * \ingroup alignment_chaining
+ */
+struct anchor_chain
+{
+    //!\brief The anchors of the chain; each anchor ends before the next one begins in both sequences.
+    std::vector<anchor> anchors{};
+    //!\brief The summed length of the anchors minus the gap costs between them.
+    double score{};
+
+    /*!\brief Returns the region of the two sequences that is covered by the chain.
+     * \param[in] first_size The length of the first sequence.
+     * \param[in] second_size The length of the second sequence.
+     * \param[in] padding The number of positions by which the window is extended on both sides and by which the band
+     *                    is widened around the diagonals of the anchors.
+     * \returns The seqan3::alignment_window of the chain.
+     *
+     * \details
+     *
+     * The window spans the anchors of the chain, extended by `padding` and clipped to the ends of the sequences. The
+     * band covers the diagonals of all anchors widened by `padding`. It always contains the begin and the end of the
+     * window, such that the infixes can be aligned globally. The chain must not be empty.
+     */
+    alignment_window window(size_t const first_size, size_t const second_size, size_t const padding) const
+    {
+        anchor const & front = anchors.front();
+        anchor const & back = anchors.back();
+
+        alignment_window result{};
+        result.first_begin = front.first_position - std::min(front.first_position, padding);
+        result.second_begin = front.second_position - std::min(front.second_position, padding);
+        result.first_end = std::min(back.first_end() + padding, std::max(first_size, back.first_end()));
+        result.second_end = std::min(back.second_end() + padding, std::max(second_size, back.second_end()));
+
+        // The band starts with the diagonals of the begin and the end of the window relative to its begin.
+        std::ptrdiff_t const window_shift = static_cast<std::ptrdiff_t>(result.first_begin) -
+                                            static_cast<std::ptrdiff_t>(result.second_begin);
+        std::ptrdiff_t const end_diagonal = static_cast<std::ptrdiff_t>(result.first_end) -
+                                            static_cast<std::ptrdiff_t>(result.second_end) - window_shift;
+        std::ptrdiff_t lower = std::min<std::ptrdiff_t>(0, end_diagonal);
+        std::ptrdiff_t upper = std::max<std::ptrdiff_t>(0, end_diagonal);
+
+        for (anchor const & current : anchors)
+        {
+            lower = std::min(lower, current.diagonal() - window_shift);
+            upper = std::max(upper, current.diagonal() - window_shift);
+        }
+
+        std::ptrdiff_t const band_padding = padding;
+        result.band = static_band{lower_bound{lower - band_padding}, upper_bound{upper + band_padding}};
+        return result;
+    }
+};
+
+} // namespace seqan3
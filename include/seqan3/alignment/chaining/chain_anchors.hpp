@@ -0,0 +1,335 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::chain_anchors.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alignment/chaining/anchor_chain.hpp>
+#include <seqan3/alignment/chaining/detail/prefix_maximum_tree.hpp>
+#include <seqan3/core/detail/strong_type.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\brief A gap cost between two anchors that grows linearly with the number of skipped positions.
+ * \ingroup alignment_chaining
+ *
+ * \details
+ *
+ * The cost of connecting two anchors is #weight times the sum of the positions that lie between them in the first
+ * and in the second sequence. Only this gap cost can be chained exactly in \f$O(n \log n)\f$ by seqan3::chain_anchors.
+ */
+struct linear_chain_gap_cost
+{
+    //!\brief The cost of one skipped position.
+    double weight{1.0};
+
+    /*!\brief Returns the cost of connecting two anchors.
+     * \param[in] first_gap The number of positions between the anchors in the first sequence.
+     * \param[in] second_gap The number of positions between the anchors in the second sequence.
+     */
+    constexpr double operator()(size_t const first_gap, size_t const second_gap) const noexcept
+    {
+        return weight * static_cast<double>(first_gap + second_gap);
+    }
+};
+
+/*!\brief The number of preceding anchors that are considered as predecessors by the heuristic seqan3::chain_anchors.
+ * \ingroup alignment_chaining
+ */
+struct chain_look_back : detail::strong_type<size_t, chain_look_back>
+{
+    //!\brief Inheriting constructors from base class.
+    using detail::strong_type<size_t, chain_look_back>::strong_type;
+};
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+//!\brief The chaining scores of the sorted anchors and the index of the predecessor of every anchor in its chain.
+struct anchor_chaining_state
+{
+    //!\brief The index of anchors without predecessor.
+    static constexpr size_t no_predecessor = prefix_maximum_tree<double>::npos;
+
+    //!\brief The anchors sorted by their position in the first and then in the second sequence.
+    std::vector<anchor> anchors{};
+    //!\brief The best score of a chain ending in the respective anchor.
+    std::vector<double> scores{};
+    //!\brief The predecessor of the respective anchor in its best chain.
+    std::vector<size_t> predecessors{};
+};
+
+/*!\brief Copies and sorts the anchors and initialises every anchor as a chain of its own.
+ * \throws std::invalid_argument if an anchor has length zero.
+ */
+template <typename anchors_t>
+anchor_chaining_state initialise_anchor_chaining(anchors_t && anchors)
+{
+    anchor_chaining_state state{};
+    if constexpr (std::ranges::sized_range<anchors_t>)
+        state.anchors.reserve(std::ranges::size(anchors));
+
+    for (anchor const & current : anchors)
+    {
+        if (current.length == 0u)
+            throw std::invalid_argument{"The anchors to chain must not be empty."};
+
+        state.anchors.push_back(current);
+    }
+
+    std::ranges::sort(state.anchors, [] (anchor const & lhs, anchor const & rhs)
+    {
+        return std::tie(lhs.first_position, lhs.second_position, lhs.length) <
+               std::tie(rhs.first_position, rhs.second_position, rhs.length);
+    });
+
+    state.scores.resize(state.anchors.size());
+    std::ranges::transform(state.anchors, state.scores.begin(), [] (anchor const & current)
+    {
+        return static_cast<double>(current.length);
+    });
+    state.predecessors.assign(state.anchors.size(), anchor_chaining_state::no_predecessor);
+    return state;
+}
+
+/*!\brief Extracts the disjoint chains from the chaining scores, best chain first.
+ * \param[in] state The chaining state after all anchors have been scored.
+ * \param[in] min_chain_score The minimal score of a reported chain.
+ *
+ * \details
+ *
+ * The chains are traced back from the anchors with the highest scores. Every anchor is part of at most one chain. If
+ * a traceback reaches an anchor of an earlier chain, it stops there and the chain is scored without the shared part.
+ */
+inline std::vector<anchor_chain> extract_anchor_chains(anchor_chaining_state const & state,
+                                                       double const min_chain_score)
+{
+    // Of two anchors with the same score, the later one is traced back first, because it may extend the other chain.
+    std::vector<size_t> order(state.anchors.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::ranges::sort(order, [&] (size_t const lhs, size_t const rhs)
+    {
+        return std::tie(state.scores[lhs], lhs) > std::tie(state.scores[rhs], rhs);
+    });
+
+    std::vector<bool> used(state.anchors.size(), false);
+    std::vector<anchor_chain> chains{};
+    for (size_t const last : order)
+    {
+        if (state.scores[last] < min_chain_score)
+            break;
+
+        if (used[last])
+            continue;
+
+        size_t first = last;
+        std::vector<anchor> chain_anchors{};
+        for (size_t current = last; current != anchor_chaining_state::no_predecessor && !used[current];
+             current = state.predecessors[current])
+        {
+            used[current] = true;
+            chain_anchors.push_back(state.anchors[current]);
+            first = current;
+        }
+
+        double const score = state.scores[last] - state.scores[first] + state.anchors[first].length;
+        if (score < min_chain_score)
+            continue;
+
+        std::ranges::reverse(chain_anchors);
+        chains.push_back(anchor_chain{std::move(chain_anchors), score});
+    }
+
+    std::ranges::stable_sort(chains, [] (anchor_chain const & lhs, anchor_chain const & rhs)
+    {
+        return lhs.score > rhs.score;
+    });
+    return chains;
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\name Anchor chaining
+ * \{
+ */
+/*!\brief Computes the best colinear chains of anchors with a linear gap cost.
+ * \ingroup alignment_chaining
+ * \tparam anchors_t The type of the anchors; must model std::ranges::input_range over seqan3::anchor.
+ * \param[in] anchors The anchors of one sequence pair; each anchor must have a non-zero length.
+ * \param[in] gap_cost The seqan3::linear_chain_gap_cost between consecutive anchors.
+ * \param[in] min_chain_score The minimal score of a reported chain.
+ * \returns The disjoint chains with a score of at least `min_chain_score`, ordered by decreasing score.
+ * \throws std::invalid_argument if an anchor has length zero.
+ *
+ * \details
+ *
+ * A chain is a sequence of anchors in which every anchor ends before the next one begins in both sequences. Its score
+ * is the summed length of its anchors minus the gap cost between every two consecutive anchors. Because the linear gap
+ * cost splits into one term per anchor, the best predecessor of an anchor is a range maximum over the anchors that
+ * end before it. The anchors are swept by their position in the first sequence, while a binary indexed tree over
+ * their end positions in the second sequence answers these queries. This finds the optimal chains in
+ * \f$O(n \log n)\f$ time for \f$n\f$ anchors, instead of comparing all pairs of anchors.
+ *
+ * Every anchor is part of at most one chain. The chains can be verified by aligning their
+ * seqan3::anchor_chain::window with seqan3::align_pairwise.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/chaining/chain_anchors.cpp
+ */
+template <std::ranges::input_range anchors_t>
+//!\cond
+    requires std::convertible_to<std::ranges::range_reference_t<anchors_t>, anchor const &>
+//!\endcond
+std::vector<anchor_chain> chain_anchors(anchors_t && anchors,
+                                        linear_chain_gap_cost const gap_cost,
+                                        double const min_chain_score = 0.0)
+{
+    detail::anchor_chaining_state state = detail::initialise_anchor_chaining(std::forward<anchors_t>(anchors));
+    size_t const anchor_count = state.anchors.size();
+
+    // Pairs of an end position and the index of its anchor.
+    std::vector<std::pair<size_t, size_t>> first_ends(anchor_count);
+    std::vector<std::pair<size_t, size_t>> second_ends(anchor_count);
+    for (size_t index = 0; index < anchor_count; ++index)
+    {
+        first_ends[index] = {state.anchors[index].first_end(), index};
+        second_ends[index] = {state.anchors[index].second_end(), index};
+    }
+
+    // The anchors are activated in the order of their end position in the first sequence.
+    std::ranges::sort(first_ends);
+
+    // The ranks of the distinct end positions in the second sequence are the positions in the tree.
+    std::ranges::sort(second_ends);
+    std::vector<size_t> ranks(anchor_count);
+    std::vector<size_t> distinct_second_ends{};
+    distinct_second_ends.reserve(anchor_count);
+    for (auto const & [second_end, index] : second_ends)
+    {
+        if (distinct_second_ends.empty() || distinct_second_ends.back() != second_end)
+            distinct_second_ends.push_back(second_end);
+
+        ranks[index] = distinct_second_ends.size() - 1u;
+    }
+
+    detail::prefix_maximum_tree<double> tree{distinct_second_ends.size()};
+    auto end_it = first_ends.begin();
+    for (size_t current = 0; current < anchor_count; ++current)
+    {
+        anchor const & current_anchor = state.anchors[current];
+
+        // Activates all anchors that end before the current one begins in the first sequence. They have been scored
+        // already, because their begin position is smaller than their end position.
+        for (; end_it != first_ends.end() && end_it->first <= current_anchor.first_position; ++end_it)
+        {
+            size_t const predecessor = end_it->second;
+            tree.update(ranks[predecessor],
+                        state.scores[predecessor] + gap_cost.weight * (end_it->first +
+                                                                       state.anchors[predecessor].second_end()),
+                        predecessor);
+        }
+
+        auto [best_value, best_predecessor] =
+            tree.prefix_maximum(std::ranges::upper_bound(distinct_second_ends, current_anchor.second_position) -
+                                distinct_second_ends.begin());
+        if (best_predecessor == detail::anchor_chaining_state::no_predecessor)
+            continue;
+
+        double const score = current_anchor.length + best_value -
+                             gap_cost.weight * (current_anchor.first_position + current_anchor.second_position);
+        if (score > state.scores[current])
+        {
+            state.scores[current] = score;
+            state.predecessors[current] = best_predecessor;
+        }
+    }
+
+    return detail::extract_anchor_chains(state, min_chain_score);
+}
+
+/*!\brief Computes colinear chains of anchors with an arbitrary gap cost, considering a bounded number of predecessors.
+ * \ingroup alignment_chaining
+ * \tparam anchors_t The type of the anchors; must model std::ranges::input_range over seqan3::anchor.
+ * \tparam gap_cost_t The type of the gap cost; must be invocable with the two gap lengths and return a value
+ *                    convertible to `double`.
+ * \param[in] anchors The anchors of one sequence pair; each anchor must have a non-zero length.
+ * \param[in] gap_cost The cost of connecting two anchors, given the number of positions between them in the first and
+ *                     in the second sequence.
+ * \param[in] look_back The number of preceding anchors in the order of the first sequence that are considered as the
+ *                      predecessor of an anchor.
+ * \param[in] min_chain_score The minimal score of a reported chain.
+ * \returns The disjoint chains with a score of at least `min_chain_score`, ordered by decreasing score.
+ * \throws std::invalid_argument if an anchor has length zero.
+ *
+ * \details
+ *
+ * Gap costs that do not split into one term per anchor, e.g. costs that penalise the difference of the diagonals,
+ * cannot be maximised with a range query. This overload therefore compares every anchor with at most `look_back`
+ * preceding anchors, which takes \f$O(n \cdot h)\f$ time for \f$n\f$ anchors and a look-back of \f$h\f$. The
+ * result is exact if `look_back` is at least the number of anchors.
+ */
+template <std::ranges::input_range anchors_t, typename gap_cost_t>
+//!\cond
+    requires std::convertible_to<std::ranges::range_reference_t<anchors_t>, anchor const &> &&
+             std::invocable<gap_cost_t const &, size_t, size_t> &&
+             std::convertible_to<std::invoke_result_t<gap_cost_t const &, size_t, size_t>, double>
+//!\endcond
+std::vector<anchor_chain> chain_anchors(anchors_t && anchors,
+                                        gap_cost_t const & gap_cost,
+                                        chain_look_back const look_back,
+                                        double const min_chain_score = 0.0)
+{
+    detail::anchor_chaining_state state = detail::initialise_anchor_chaining(std::forward<anchors_t>(anchors));
+
+    for (size_t current = 0; current < state.anchors.size(); ++current)
+    {
+        anchor const & current_anchor = state.anchors[current];
+
+        for (size_t candidate = current - std::min(current, look_back.get()); candidate < current; ++candidate)
+        {
+            anchor const & predecessor = state.anchors[candidate];
+            if (predecessor.first_end() > current_anchor.first_position ||
+                predecessor.second_end() > current_anchor.second_position)
+                continue;
+
+            double const score = state.scores[candidate] + current_anchor.length -
+                                 static_cast<double>(gap_cost(current_anchor.first_position - predecessor.first_end(),
+                                                              current_anchor.second_position -
+                                                                  predecessor.second_end()));
+            if (score > state.scores[current])
+            {
+                state.scores[current] = score;
+                state.predecessors[current] = candidate;
+            }
+        }
+    }
+
+    return detail::extract_anchor_chains(state, min_chain_score);
+}
+//!\}
+
+} // namespace seqan3
@@ -0,0 +1,100 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::prefix_maximum_tree.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/concept/core_language.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A binary indexed (Fenwick) tree that answers maximum queries over a prefix of positions.
+ * \ingroup alignment_chaining
+ * \tparam value_t The type of the stored values; must model seqan3::arithmetic.
+ *
+ * \details
+ *
+ * Every position holds a value together with the index of the element it belongs to. Values can only increase, i.e.
+ * an update keeps the larger of the old and the new value. Both operations take \f$O(\log n)\f$ time.
+ */
+template <seqan3::arithmetic value_t>
+class prefix_maximum_tree
+{
+public:
+    //!\brief The index stored for positions that have never been updated.
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    //!\brief A value together with the index of its element.
+    using entry_type = std::pair<value_t, size_t>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    prefix_maximum_tree() = default;                                        //!< Defaulted.
+    prefix_maximum_tree(prefix_maximum_tree const &) = default;             //!< Defaulted.
+    prefix_maximum_tree(prefix_maximum_tree &&) = default;                  //!< Defaulted.
+    prefix_maximum_tree & operator=(prefix_maximum_tree const &) = default; //!< Defaulted.
+    prefix_maximum_tree & operator=(prefix_maximum_tree &&) = default;      //!< Defaulted.
+    ~prefix_maximum_tree() = default;                                       //!< Defaulted.
+
+    /*!\brief Constructs a tree over the given number of positions, all holding the lowest value.
+     * \param[in] size The number of positions.
+     */
+    explicit prefix_maximum_tree(size_t const size) : nodes(size + 1, empty_entry)
+    {}
+    //!\}
+
+    /*!\brief Raises the value at the given position.
+     * \param[in] position The position to update; must be smaller than the size of the tree.
+     * \param[in] value The new value.
+     * \param[in] index The index of the element the value belongs to.
+     */
+    void update(size_t position, value_t const value, size_t const index) noexcept
+    {
+        for (++position; position < nodes.size(); position += position & (~position + 1u))
+            if (value > nodes[position].first)
+                nodes[position] = entry_type{value, index};
+    }
+
+    /*!\brief Returns the maximum over the positions `[0, count)`.
+     * \param[in] count The number of positions to consider; must not be greater than the size of the tree.
+     * \returns The maximal value and its index, or the lowest value and #npos if no position was updated.
+     */
+    entry_type prefix_maximum(size_t count) const noexcept
+    {
+        entry_type result{empty_entry};
+        for (; count > 0u; count &= count - 1u)
+            if (nodes[count].first > result.first)
+                result = nodes[count];
+
+        return result;
+    }
+
+    //!\brief Returns the number of positions.
+    size_t size() const noexcept
+    {
+        return nodes.empty() ? 0u : nodes.size() - 1u;
+    }
+
+private:
+    //!\brief The entry of a position that was never updated.
+    static constexpr entry_type empty_entry{std::numeric_limits<value_t>::lowest(), npos};
+
+    //!\brief The nodes of the tree; node `i` covers the positions `[i - lowbit(i), i)`.
+    std::vector<entry_type> nodes{};
+};
+
+} // namespace seqan3::detail
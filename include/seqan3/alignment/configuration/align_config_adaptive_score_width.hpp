@@ -0,0 +1,59 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::adaptive_score_width configuration.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A tag to select the adaptive score width of the vectorised alignment algorithm.
+ * \ingroup alignment_configuration
+ */
+struct adaptive_score_width_tag : public pipeable_config_element<adaptive_score_width_tag, empty_type>
+{
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::adaptive_score_width};
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Computes every sequence pair of a vectorised alignment with the narrowest score type that cannot overflow.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The number of alignments that are computed at once by the \ref seqan3::align_cfg::vectorise "vectorised" alignment
+ * depends on the width of the score type, which is set with the seqan3::align_cfg::result configuration and defaults
+ * to `int32_t`. If this configuration is added, the sequence pairs are computed with simd vectors over `int8_t` or
+ * `int16_t` instead, as long as no score of their alignment matrix can exceed the value range of the narrower type.
+ * This is checked for every sequence pair before the computation, based on the length of the longer sequence and the
+ * configured scores. The remaining sequence pairs are computed with the next wider type, up to the configured score
+ * type. Hence, the results, including their score type, are exactly the same as without this configuration, but
+ * short sequences are computed with up to four times as many alignments per simd vector.
+ *
+ * This configuration has no effect without seqan3::align_cfg::vectorise or if the configured score type is not an
+ * integral type wider than `int8_t`. It cannot be combined with seqan3::align_cfg::debug.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_adaptive_score_width_example.cpp
+ */
+inline constexpr detail::adaptive_score_width_tag adaptive_score_width{};
+
+} // namespace seqan3::align_cfg
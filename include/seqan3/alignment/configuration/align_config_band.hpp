@@ -31,7 +31,8 @@ namespace seqan3::align_cfg
  * If no band is configured for the alignment algorithm the full alignment matrix will be computed.
  * Before executing the algorithm the band is tested for valid settings, e.g. that the upper bound is not smaller than
  * the lower bound, or the band is not shifted out of the alignment matrix. If an invalid setting is detected, a
- * seqan3::invalid_alignment_configuration exception will be thrown.
+ * seqan3::invalid_alignment_configuration exception will be thrown. The band can be combined with
+ * seqan3::align_cfg::vectorise to verify many sequence pairs within narrow bands.
  *
  * ### Example
  *
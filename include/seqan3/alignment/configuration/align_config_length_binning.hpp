@@ -0,0 +1,47 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::length_binning configuration.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Groups the sequence pairs of a vectorised alignment by their length before they are computed.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The \ref seqan3::align_cfg::vectorise "vectorised" alignment computes as many sequence pairs at once as fit into
+ * one simd vector and pads every pair to the longest sequences of this batch. If the sequence lengths vary, most of
+ * the computed cells are padding. With this configuration, the given number of consecutive sequence pairs is buffered
+ * and sorted by the length of their longer sequence, such that every simd vector is filled with pairs of similar
+ * length. The results are still returned in the order of the input and carry the index of their sequence pair.
+ *
+ * The window size is rounded up to a multiple of the number of alignments per simd vector. A larger window reduces
+ * the padding but delays the first result, since all results of a window become available at once. The window size
+ * must be greater than 0, otherwise a seqan3::invalid_alignment_configuration exception will be thrown.
+ * This configuration has no effect without seqan3::align_cfg::vectorise.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_length_binning_example.cpp
+ */
+struct length_binning : public pipeable_config_element<length_binning, uint32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::length_binning};
+};
+
+} // namespace seqan3::align_cfg
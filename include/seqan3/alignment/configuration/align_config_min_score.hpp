@@ -0,0 +1,56 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::min_score configuration.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Sets the minimal score of the alignments of interest, such that cells that cannot reach it are not computed.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * Many applications discard every alignment whose score is below a threshold. With this configuration, the alignment
+ * algorithm drops every cell whose score plus the best score that can still be added until the end of the alignment
+ * is lower than the given minimal score. If no band is configured, only the rows of a column that can be reached from
+ * a remaining cell of the previous column are computed, and the computation stops as soon as all cells of a column are
+ * dropped.
+ *
+ * The result of a sequence pair whose optimal score is at least the minimal score is the same as without this
+ * configuration. Otherwise, the reported score is lower than the minimal score, but the score, the coordinates and the
+ * alignment are unspecified.
+ *
+ * For the \ref seqan3::align_cfg::edit "edit distance" the minimal score `-k` has the same effect as
+ * seqan3::align_cfg::max_error `k`, i.e. the computation is limited to the last active cell of every column (Ukkonen's
+ * cut-off). In this case the minimal score must not be positive, otherwise a seqan3::invalid_alignment_configuration
+ * exception will be thrown.
+ *
+ * For all other scoring schemes this configuration can only be used for \ref seqan3::global_alignment
+ * "global alignments" without free end gaps, otherwise a seqan3::invalid_alignment_configuration exception will be
+ * thrown. It can be combined with seqan3::align_cfg::band, but neither with seqan3::align_cfg::max_error,
+ * seqan3::align_cfg::vectorise nor seqan3::align_cfg::x_drop.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_min_score_example.cpp
+ */
+struct min_score : public pipeable_config_element<min_score, int32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::min_score};
+};
+
+} // namespace seqan3::align_cfg
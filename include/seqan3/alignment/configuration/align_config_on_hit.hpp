@@ -0,0 +1,95 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::on_hit configuration.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <utility>
+
+#include <range/v3/utility/semiregular_box.hpp>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/std/concepts>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Reports every hit of a semi-global edit distance computation to a callback.
+ * \ingroup alignment_configuration
+ *
+ * \tparam callback_t The type of the callback; must model std::copy_constructible.
+ *
+ * \details
+ *
+ * A semi-global edit distance with seqan3::align_cfg::max_error only returns the best end position of the second
+ * sequence within the first sequence. With this configuration, the given callback is additionally invoked for every
+ * column of the first sequence in which the second sequence ends with at most seqan3::align_cfg::max_error errors.
+ * This allows one to scan a long sequence for all approximate occurrences of a pattern in a single pass.
+ *
+ * The callback is invoked with the index of the sequence pair (`size_t`), the seqan3::alignment_coordinate of the
+ * end position and the (non-positive) score of the hit. The hits are reported in increasing order of the end
+ * position. If the callback returns a value that is convertible to `bool`, returning `true` stops the computation of
+ * the current sequence pair; its alignment result then refers to the part of the first sequence scanned so far.
+ *
+ * The callback is copied together with the configuration; capture containers by reference to collect the hits. If the
+ * alignments are computed in parallel, the callback is invoked concurrently and must synchronise its state. Callbacks
+ * that are not std::semiregular, e.g. lambdas with captures, are stored in a `ranges::semiregular_t` wrapper.
+ *
+ * This configuration requires seqan3::align_cfg::max_error and free end gaps in the first sequence, i.e. it is only
+ * valid for the semi-global edit distance. Otherwise a seqan3::invalid_alignment_configuration exception is thrown.
+ * It cannot be combined with seqan3::align_cfg::band or seqan3::align_cfg::vectorise.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_on_hit_example.cpp
+ */
+template <std::copy_constructible callback_t>
+class on_hit : public pipeable_config_element<on_hit<callback_t>, ranges::semiregular_t<callback_t>>
+{
+    //!\brief The base type of this class.
+    using base_t = pipeable_config_element<on_hit<callback_t>, ranges::semiregular_t<callback_t>>;
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr on_hit() = default; //!< Defaulted.
+    constexpr on_hit(on_hit const &) = default; //!< Defaulted.
+    constexpr on_hit & operator=(on_hit const &) = default; //!< Defaulted.
+    constexpr on_hit(on_hit &&) = default; //!< Defaulted.
+    constexpr on_hit & operator=(on_hit &&) = default; //!< Defaulted.
+    ~on_hit() = default; //!< Defaulted.
+
+    /*!\brief Construction from the callback that is invoked for every hit.
+     * \param[in] callback The callback; will be copied or moved into the configuration element.
+     */
+    constexpr on_hit(callback_t callback) : base_t{ranges::semiregular_t<callback_t>{std::move(callback)}} {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::on_hit};
+};
+
+/*!\name Type deduction guides
+ * \brief Deduces the template parameter from the argument.
+ * \relates seqan3::align_cfg::on_hit
+ * \{
+ */
+/*!
+ * \brief Deduces the type of the callback.
+ * \tparam callback_t The type of the callback.
+ */
+template <typename callback_t>
+on_hit(callback_t) -> on_hit<callback_t>;
+//!\}
+
+} // namespace seqan3::align_cfg
@@ -0,0 +1,48 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::statistics configuration.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/alignment/pairwise/alignment_statistics.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Collects counters about the computed alignments in a seqan3::alignment_statistics object.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * If the throughput of the alignments changes, it is often unclear whether more cells are computed, the simd vectors
+ * are filled badly, the matrices are allocated too often or the traceback dominates. With this configuration, the
+ * alignment algorithms count the computed cells, the padded simd lanes, the length of the tracebacks and the matrix
+ * allocations, and measure the time spent in the matrix fill, the traceback and the creation of the results. The
+ * counters of all threads are added to the seqan3::alignment_statistics object the given pointer refers to.
+ *
+ * Without this configuration nothing is counted or measured. The object must outlive the seqan3::alignment_range
+ * returned by seqan3::align_pairwise and a `nullptr` results in a seqan3::invalid_alignment_configuration exception.
+ * The bit-parallel edit distance reports its whole computation, including the traceback, as matrix fill. This
+ * configuration cannot be combined with seqan3::align_cfg::wavefront.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_statistics_example.cpp
+ */
+struct statistics : public pipeable_config_element<statistics, alignment_statistics *>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::statistics};
+};
+
+} // namespace seqan3::align_cfg
@@ -0,0 +1,47 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::thread_pool configuration.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/parallel/thread_pool.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Computes the alignments in parallel on a persistent seqan3::thread_pool.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * With seqan3::align_cfg::parallel, every call of seqan3::align_pairwise spawns and joins its own threads. If many
+ * small batches of alignments are computed, this overhead can dominate the runtime. Instead, this configuration takes
+ * a pointer to a seqan3::thread_pool that is created once and shared by all calls. The alignments of a call are
+ * distributed as tasks over the worker threads of the pool, which balance their load by work stealing.
+ *
+ * The pool must outlive the seqan3::alignment_range returned by seqan3::align_pairwise and the alignments must not be
+ * computed from within a worker thread of the same pool. A `nullptr` results in a
+ * seqan3::invalid_alignment_configuration exception. This configuration cannot be combined with
+ * seqan3::align_cfg::parallel.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_thread_pool_example.cpp
+ */
+struct thread_pool : public pipeable_config_element<thread_pool, seqan3::thread_pool *>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::thread_pool};
+};
+
+} // namespace seqan3::align_cfg
@@ -46,6 +46,10 @@ namespace seqan3::align_cfg
  * multiple alignments and not a single alignment. This means that you should provide many sequences to compute as
  * one batch rather than computing them separately as there won't be performance gains.
  *
+ * The vectorised alignment can be combined with seqan3::align_cfg::band. In this case all sequence pairs of a batch
+ * share the same band and only the cells within the band are computed. The banded vectorised alignment can only
+ * compute the score and the back coordinate.
+ *
  * \sa For further information on SIMD see https://en.wikipedia.org/wiki/SIMD.
  *
  * ### Example
@@ -0,0 +1,62 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::wavefront configuration.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A tag to select the wavefront alignment algorithm.
+ * \ingroup alignment_configuration
+ */
+struct wavefront_tag : public pipeable_config_element<wavefront_tag, empty_type>
+{
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::wavefront};
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Computes the global alignment with the wavefront alignment algorithm.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The wavefront alignment algorithm computes the cells of the alignment matrix in increasing order of their penalty
+ * and skips matching characters. Its runtime grows with the length and the score difference of the sequences but not
+ * with the size of the alignment matrix, which makes it much faster than the dynamic programming algorithm for long
+ * and similar sequences. It computes the same optimal score and an optimal alignment, which may differ from the one
+ * of the dynamic programming algorithm if there are several. The results have the same type.
+ *
+ * This configuration requires a seqan3::global_alignment without free end gaps and a scoring scheme with a single
+ * match score and a single lower mismatch score, e.g. a seqan3::nucleotide_scoring_scheme. The gap open score must
+ * not be positive and twice the gap score must be less than the match score. Otherwise
+ * seqan3::invalid_alignment_configuration is thrown.
+ * It cannot be combined with seqan3::align_cfg::band, seqan3::align_cfg::max_error, seqan3::align_cfg::vectorise,
+ * seqan3::align_cfg::x_drop or seqan3::align_cfg::debug. If the alignment is requested, the memory grows
+ * quadratically with the score difference.
+ The overload of seqan3::align_pairwise that writes into a result buffer computes the wavefront alignment, too.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_wavefront_example.cpp
+ */
+inline constexpr detail::wavefront_tag wavefront{};
+
+} // namespace seqan3::align_cfg
@@ -0,0 +1,50 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::x_drop configuration.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Computes an X-drop extension alignment that stops once the score drops too far below the best score.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * This configuration turns a \ref seqan3::global_alignment "global alignment" into an extension alignment as it is
+ * used to extend a seed: the alignment starts at the beginning of both sequences but may end anywhere, i.e. the
+ * result is the best scoring cell of the alignment matrix. In addition, every cell whose score is more than `X`
+ * below the best score seen so far is dropped, such that no alignment can pass through it. The computation stops as
+ * soon as all cells of a column are dropped and, if no band is configured, only the rows of a column that can be
+ * reached from a remaining cell of the previous column are computed. The given value must not be negative, otherwise
+ * a seqan3::invalid_alignment_configuration exception will be thrown.
+ *
+ * This configuration can be combined with the seqan3::align_cfg::band configuration, but neither with
+ * \ref seqan3::local_alignment "local alignments", seqan3::align_cfg::aligned_ends, seqan3::align_cfg::max_error
+ * nor seqan3::align_cfg::vectorise. Since no score of the \ref seqan3::align_cfg::edit "edit distance" is positive,
+ * the extension could never leave the origin and the combination throws a seqan3::invalid_alignment_configuration
+ * exception.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_x_drop_example.cpp
+ */
+struct x_drop : public pipeable_config_element<x_drop, int32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::x_drop};
+};
+
+} // namespace seqan3::align_cfg
@@ -22,18 +22,26 @@ namespace seqan3::detail
  */
 enum struct align_config_id : uint8_t
 {
-    aligned_ends, //!< ID for the \ref seqan3::align_cfg::aligned_ends "aligned_ends" option.
-    band,         //!< ID for the \ref seqan3::align_cfg::band "band" option.
-    debug,        //!< ID for the \ref seqan3::align_cfg::debug "debug" option.
-    gap,          //!< ID for the \ref seqan3::align_cfg::gap "gap" option.
-    global,       //!< ID for the \ref seqan3::global_alignment "global alignment" option.
-    local,        //!< ID for the \ref seqan3::local_alignment "local alignment" option.
-    max_error,    //!< ID for the \ref seqan3::align_cfg::max_error "max_error" option.
-    parallel,     //!< ID for the \ref seqan3::align_cfg::parallel "parallel" option.
-    result,       //!< ID for the \ref seqan3::align_cfg::result "result" option.
-    scoring,      //!< ID for the \ref seqan3::align_cfg::scoring "scoring" option.
-    vectorise,    //!< ID for the \ref seqan3::align_cfg::vectorise "vectorise" option.
-    SIZE          //!< Represents the number of configuration elements.
+    adaptive_score_width, //!< ID for the \ref seqan3::align_cfg::adaptive_score_width "adaptive_score_width" option.
+    aligned_ends,         //!< ID for the \ref seqan3::align_cfg::aligned_ends "aligned_ends" option.
+    band,                 //!< ID for the \ref seqan3::align_cfg::band "band" option.
+    debug,                //!< ID for the \ref seqan3::align_cfg::debug "debug" option.
+    gap,                  //!< ID for the \ref seqan3::align_cfg::gap "gap" option.
+    global,               //!< ID for the \ref seqan3::global_alignment "global alignment" option.
+    length_binning,       //!< ID for the \ref seqan3::align_cfg::length_binning "length_binning" option.
+    local,                //!< ID for the \ref seqan3::local_alignment "local alignment" option.
+    max_error,            //!< ID for the \ref seqan3::align_cfg::max_error "max_error" option.
+    min_score,            //!< ID for the \ref seqan3::align_cfg::min_score "min_score" option.
+    on_hit,               //!< ID for the \ref seqan3::align_cfg::on_hit "on_hit" option.
+    parallel,             //!< ID for the \ref seqan3::align_cfg::parallel "parallel" option.
+    result,               //!< ID for the \ref seqan3::align_cfg::result "result" option.
+    scoring,              //!< ID for the \ref seqan3::align_cfg::scoring "scoring" option.
+    statistics,           //!< ID for the \ref seqan3::align_cfg::statistics "statistics" option.
+    thread_pool,          //!< ID for the \ref seqan3::align_cfg::thread_pool "thread_pool" option.
+    vectorise,            //!< ID for the \ref seqan3::align_cfg::vectorise "vectorise" option.
+    wavefront,            //!< ID for the \ref seqan3::align_cfg::wavefront "wavefront" option.
+    x_drop,               //!< ID for the \ref seqan3::align_cfg::x_drop "x_drop" option.
+    SIZE                  //!< Represents the number of configuration elements.
 };
 
 // ----------------------------------------------------------------------------
@@ -49,18 +57,26 @@ template <>
 inline constexpr std::array<std::array<bool, static_cast<uint8_t>(align_config_id::SIZE)>,
                             static_cast<uint8_t>(align_config_id::SIZE)> compatibility_table<align_config_id>
 {
-    {   //0  1  2  3  4  5  6  7  8  9 10
-        { 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}, //  0: aligned_ends
-        { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  1: band
-        { 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1}, //  2: debug
-        { 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1}, //  3: gap
-        { 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1}, //  4: global
-        { 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1}, //  5: local
-        { 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1}, //  6: max_error
-        { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1}, //  7: parallel
-        { 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1}, //  8: result
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1}, //  9: scoring
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0}  // 10: vectorise
+    {   //0  1  2  3  4  5  6  7  8  9 10 11 12 13 14 15 16 17 18
+        { 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1}, //  0: adaptive_score_width
+        { 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0}, //  1: aligned_ends
+        { 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 1}, //  2: band
+        { 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1}, //  3: debug
+        { 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  4: gap
+        { 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  5: global
+        { 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1}, //  6: length_binning
+        { 1, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0}, //  7: local
+        { 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0}, //  8: max_error
+        { 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0}, //  9: min_score
+        { 1, 1, 0, 1, 1, 1, 1, 0, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0}, // 10: on_hit
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1}, // 11: parallel
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}, // 12: result
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}, // 13: scoring
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1}, // 14: statistics
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1}, // 15: thread_pool
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0}, // 16: vectorise
+        { 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0}, // 17: wavefront
+        { 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0}  // 18: x_drop
     }
 };
 
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <deque>
+#include <utility>
 #include <vector>
 
 #include <seqan3/alignment/aligned_sequence/aligned_sequence_concept.hpp>
@@ -164,4 +165,116 @@ inline alignment_t alignment_trace(database_t && database,
     return aligned_seq;
 }
 
+/*!\brief Compute the trace and the front coordinate from a trace matrix in a single pass.
+ * \ingroup alignment_matrix
+ * \tparam    alignment_t                The type of the returned alignment.
+ * \tparam    database_t                 The type of the database sequence.
+ * \tparam    query_t                    The type of the query sequence.
+ * \tparam    trace_matrix_t             The type of the trace matrix.
+ * \param[in] database                   The database sequence.
+ * \param[in] query                      The query sequence.
+ * \param[in] matrix                     The trace matrix.
+ * \param[in] back_coordinate            Where the trace in the matrix ends.
+ * \returns Returns a pair of the seqan3::aligned_sequence and the front coordinate.
+ *
+ * \details
+ *
+ * Records the trace directions while following the trace once and builds the alignment from the recorded directions.
+ * Calling seqan3::detail::alignment_front_coordinate and seqan3::detail::alignment_trace instead follows the trace
+ * twice, which is expensive if the matrix recomputes the accessed cells, e.g.
+ * seqan3::detail::edit_distance_trace_matrix_checkpointed.
+ */
+template <
+    tuple_like alignment_t,
+    typename database_t,
+    typename query_t,
+    typename trace_matrix_t>
+//!\cond
+    requires matrix<remove_cvref_t<trace_matrix_t>> &&
+             std::same_as<typename remove_cvref_t<trace_matrix_t>::value_type, trace_directions> &&
+             detail::all_satisfy_aligned_seq<detail::tuple_type_list_t<alignment_t>>
+//!\endcond
+inline std::pair<alignment_t, alignment_coordinate> alignment_trace_and_front_coordinate(
+    database_t && database,
+    query_t && query,
+    trace_matrix_t && matrix,
+    alignment_coordinate const back_coordinate)
+{
+    constexpr auto N = trace_directions::none;
+    constexpr auto D = trace_directions::diagonal;
+    constexpr auto L = trace_directions::left;
+    constexpr auto U = trace_directions::up;
+
+    matrix_coordinate coordinate{row_index_type{back_coordinate.second}, column_index_type{back_coordinate.first}};
+
+    assert(coordinate.row <= query.size());
+    assert(coordinate.col <= database.size());
+    assert(coordinate.row < matrix.rows());
+    assert(coordinate.col < matrix.cols());
+
+    if (matrix.at({row_index_type{0u}, column_index_type{0u}}) != N)
+        throw std::logic_error{"End trace must be NONE"};
+
+    // The followed directions from the back to the front of the trace.
+    std::vector<trace_directions> path{};
+    path.reserve(coordinate.row + coordinate.col);
+
+    while (true)
+    {
+        trace_directions dir = matrix.at(coordinate);
+        if ((dir & L) == L)
+        {
+            coordinate.col = std::max<size_t>(coordinate.col, 1) - 1;
+            path.push_back(L);
+        }
+        else if ((dir & U) == U)
+        {
+            coordinate.row = std::max<size_t>(coordinate.row, 1) - 1;
+            path.push_back(U);
+        }
+        else if ((dir & D) == D)
+        {
+            coordinate.row = std::max<size_t>(coordinate.row, 1) - 1;
+            coordinate.col = std::max<size_t>(coordinate.col, 1) - 1;
+            path.push_back(D);
+        }
+        else
+        {
+#ifndef NDEBUG
+            if (!(coordinate.row == 0 || coordinate.col == 0))
+                throw std::logic_error{"Unknown seqan3::trace_direction in an inner cell of the trace matrix."};
+#endif
+            break;
+        }
+    }
+
+    alignment_t aligned_seq{};
+    assign_unaligned(std::get<0>(aligned_seq), views::slice(database, coordinate.col, back_coordinate.first));
+    assign_unaligned(std::get<1>(aligned_seq), views::slice(query, coordinate.row, back_coordinate.second));
+    auto end_aligned_db = std::ranges::cend(std::get<0>(aligned_seq));
+    auto end_aligned_qy = std::ranges::cend(std::get<1>(aligned_seq));
+
+    for (trace_directions const dir : path)
+    {
+        if (dir == L)
+        {
+            --end_aligned_db;
+            end_aligned_qy = insert_gap(std::get<1>(aligned_seq), end_aligned_qy);
+        }
+        else if (dir == U)
+        {
+            end_aligned_db = insert_gap(std::get<0>(aligned_seq), end_aligned_db);
+            --end_aligned_qy;
+        }
+        else
+        {
+            --end_aligned_db;
+            --end_aligned_qy;
+        }
+    }
+
+    return {std::move(aligned_seq), alignment_coordinate{column_index_type{coordinate.col},
+                                                         row_index_type{coordinate.row}}};
+}
+
 } // namespace seqan3::detail
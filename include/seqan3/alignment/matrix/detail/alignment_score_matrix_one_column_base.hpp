@@ -16,6 +16,7 @@
 #include <utility>
 #include <vector>
 
+#include <seqan3/alignment/matrix/detail/reuse_storage.hpp>
 #include <seqan3/core/concept/core_language.hpp>
 #include <seqan3/core/simd/concept.hpp>
 #include <seqan3/range/container/aligned_allocator.hpp>
@@ -29,7 +30,8 @@ namespace seqan3::detail
  *
  * \details
  *
- * Manages the actual storage as a std::vector. How much memory is allocated is handled by the derived type.
+ * Manages the actual storage as a std::vector. How much memory is allocated is handled by the derived type, which
+ * reuses the storage if the matrix is re-initialised for another sequence pair.
  * The `score_t` must either model the seqan3::arithmetic or seqan3::detail::simd_conceptvector concept.
  */
 template <typename score_t>
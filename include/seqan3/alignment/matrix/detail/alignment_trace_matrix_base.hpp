@@ -12,13 +12,17 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/packed_trace_matrix.hpp>
+#include <seqan3/alignment/matrix/detail/reuse_storage.hpp>
 #include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
 #include <seqan3/alignment/matrix/trace_directions.hpp>
 #include <seqan3/core/simd/concept.hpp>
 #include <seqan3/range/container/aligned_allocator.hpp>
+#include <seqan3/std/ranges>
 
 namespace seqan3::detail
 {
@@ -33,6 +37,10 @@ namespace seqan3::detail
  * Manages the actual storage as a std::vector. How much memory is allocated is handled by the derived type.
  * The `trace_t` must be either a seqan3::detail::trace_directions enum value or a seqan3::detail::simd_conceptvector
  * over seqan3::detail::trace_directions.
+ *
+ * Scalar trace directions are stored in a seqan3::detail::packed_trace_matrix. The alignment algorithm writes the
+ * current column into an unpacked column buffer (see #column_data), which is packed when the next column is
+ * requested or #flush_column is called.
  */
 template <typename trace_t>
 struct alignment_trace_matrix_base
@@ -50,15 +58,79 @@ protected:
                                               aligned_allocator<element_type, sizeof(element_type)>,
                                               std::allocator<element_type>>;
     //!\brief The type of the underlying memory pool.
-    using pool_type = two_dimensional_matrix<element_type, allocator_type, matrix_major_order::column>;
+    using pool_type = std::conditional_t<simd_concept<trace_t>,
+                                         two_dimensional_matrix<element_type,
+                                                                allocator_type,
+                                                                matrix_major_order::column>,
+                                         packed_trace_matrix>;
     //!\brief The size type.
     using size_type = size_t;
 
+    /*!\brief Allocates the trace matrix and the column buffer.
+     * \param[in] rows The number of rows of the trace matrix.
+     * \param[in] cols The number of columns of the trace matrix.
+     *
+     * \details
+     *
+     * Memory allocated for a previous sequence pair is reused if it is large enough.
+     */
+    void allocate_data(number_rows const rows, number_cols const cols)
+    {
+        data.resize(rows, cols);
+        buffered_slice_size = 0u;
+        cache_up = element_type{};
+
+        if constexpr (!simd_concept<trace_t>)
+            reuse_storage(column_buffer, rows.get());
+    }
+
+    /*!\brief Returns a pointer to the storage of a column slice that is written by the alignment algorithm.
+     * \param[in] slice_begin The coordinate of the first cell of the slice.
+     * \param[in] slice_size  The number of cells of the slice.
+     *
+     * \details
+     *
+     * For scalar trace directions the previously requested slice is packed into the trace matrix and the returned
+     * pointer refers to the column buffer.
+     */
+    element_type * column_data(matrix_coordinate const & slice_begin, size_type const slice_size) noexcept
+    {
+        if constexpr (simd_concept<trace_t>)
+        {
+            (void) slice_size;
+            return std::addressof(data[slice_begin]);
+        }
+        else
+        {
+            flush_column();
+            buffered_slice_begin = slice_begin;
+            buffered_slice_size = slice_size;
+            return column_buffer.data() + slice_begin.row;
+        }
+    }
+
+    //!\brief Packs the column slice that was last requested by #column_data into the trace matrix.
+    void flush_column() noexcept
+    {
+        if constexpr (!simd_concept<trace_t>)
+        {
+            auto slice_it = column_buffer.begin() + buffered_slice_begin.row;
+            data.assign_column(buffered_slice_begin, std::ranges::subrange{slice_it, slice_it + buffered_slice_size});
+            buffered_slice_size = 0u;
+        }
+    }
+
 public:
     //!\brief The linearised matrix storing the trace data in column-major-order.
     pool_type data{};
     //!\brief Internal cache for the trace values to the left.
     std::vector<element_type, allocator_type> cache_left{};
+    //!\brief The unpacked column that is currently computed; only used for scalar trace directions.
+    std::vector<element_type, allocator_type> column_buffer{};
+    //!\brief The coordinate of the first cell of the buffered column slice.
+    matrix_coordinate buffered_slice_begin{};
+    //!\brief The number of cells of the buffered column slice.
+    size_type buffered_slice_size{};
     //!\brief Internal cache for the last trace value above.
     element_type cache_up{};
     //!\brief The number of columns.
@@ -16,6 +16,9 @@
 #include <seqan3/alignment/matrix/detail/alignment_trace_matrix_base.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_trace_matrix_proxy.hpp>
 #include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
+#include <seqan3/alignment/matrix/detail/trace_matrix_lane_iterator.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
 #include <seqan3/range/views/zip.hpp>
 #include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
@@ -116,7 +119,29 @@ public:
     template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
     constexpr alignment_trace_matrix_full(first_sequence_t && first,
                                           second_sequence_t && second,
-                                          [[maybe_unused]] trace_t const initial_value = trace_t{})
+                                          trace_t const initial_value = trace_t{})
+    {
+        reset(first, second, initial_value);
+    }
+    //!\}
+
+    /*!\brief Re-initialises the matrix for two other ranges.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first  The first range.
+     * \param[in] second The second range.
+     * \param[in] initial_value The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * Has the same effect as constructing the matrix from the ranges, but keeps the allocated traceback matrix if it
+     * is large enough.
+     */
+    template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
+    constexpr void reset(first_sequence_t && first,
+                         second_sequence_t && second,
+                         [[maybe_unused]] trace_t const initial_value = trace_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
@@ -124,12 +149,10 @@ public:
         if constexpr (!coordinate_only)
         {
             // Allocate the matrix here.
-            matrix_base_t::data = typename matrix_base_t::pool_type{number_rows{matrix_base_t::num_rows},
-                                                                    number_cols{matrix_base_t::num_cols}};
-            matrix_base_t::cache_left.resize(matrix_base_t::num_rows, initial_value);
+            matrix_base_t::allocate_data(number_rows{matrix_base_t::num_rows}, number_cols{matrix_base_t::num_cols});
+            reuse_storage(matrix_base_t::cache_left, matrix_base_t::num_rows, initial_value);
         }
     }
-    //!\}
 
     /*!\brief Returns a trace path starting from the given coordinate and ending in the cell with
      *        seqan3::detail::trace_directions::none.
@@ -148,10 +171,40 @@ public:
         if (trace_begin.row >= matrix_base_t::num_rows || trace_begin.col >= matrix_base_t::num_cols)
             throw std::invalid_argument{"The given coordinate exceeds the matrix in vertical or horizontal direction."};
 
+        matrix_base_t::flush_column();
+
         return path_t{trace_iterator_t{matrix_base_t::data.begin() + matrix_offset{trace_begin}},
                       std::ranges::default_sentinel};
     }
 
+    /*!\brief Returns the trace path of a single alignment that was computed in vectorised mode.
+     * \param[in] lane        The position of the alignment within the simd vector.
+     * \param[in] trace_begin A seqan3::matrix_coordinate pointing to the begin of the trace to follow.
+     * \returns A std::ranges::subrange over the corresponding trace path.
+     * \throws std::invalid_argument if the specified coordinate is out of range.
+     *
+     * \details
+     *
+     * The trace directions of the lane are read directly from the simd vectors of the trace matrix
+     * (see seqan3::detail::trace_matrix_lane_iterator).
+     */
+    auto lane_trace_path(size_t const lane, matrix_coordinate const & trace_begin) const
+    {
+        static_assert(!coordinate_only, "Requested trace but storing the trace was disabled!");
+        static_assert(simd_concept<trace_t>, "Only a trace matrix over simd vectors stores multiple alignments.");
+        assert(lane < simd_traits<trace_t>::length);
+
+        using matrix_iter_t = std::ranges::iterator_t<typename matrix_base_t::pool_type const>;
+        using trace_iterator_t = trace_iterator<trace_matrix_lane_iterator<matrix_iter_t>>;
+        using path_t = std::ranges::subrange<trace_iterator_t, std::ranges::default_sentinel_t>;
+
+        if (trace_begin.row >= matrix_base_t::num_rows || trace_begin.col >= matrix_base_t::num_cols)
+            throw std::invalid_argument{"The given coordinate exceeds the matrix in vertical or horizontal direction."};
+
+        trace_matrix_lane_iterator lane_it{matrix_base_t::data.begin() + matrix_offset{trace_begin}, lane};
+        return path_t{trace_iterator_t{lane_it}, std::ranges::default_sentinel};
+    }
+
 private:
     //!\copydoc seqan3::detail::alignment_matrix_column_major_range_base::initialise_column
     constexpr alignment_column_type initialise_column(size_type const column_index) noexcept
@@ -167,8 +220,9 @@ private:
         else
         {
             matrix_coordinate current_position{row_index_type{0u}, column_index_type{column_index}};
-            auto col = views::zip(std::span<element_type>{std::addressof(matrix_base_t::data[current_position]),
-                                                               matrix_base_t::num_rows},
+            auto col = views::zip(std::span<element_type>{matrix_base_t::column_data(current_position,
+                                                                                     matrix_base_t::num_rows),
+                                                          matrix_base_t::num_rows},
                                   std::span<element_type>{matrix_base_t::cache_left},
                                   std::views::iota(std::move(row_begin), std::move(row_end)));
             return alignment_column_type{*this, column_data_view_type{col}};
@@ -128,7 +128,31 @@ public:
     constexpr alignment_trace_matrix_full_banded(first_sequence_t && first,
                                                  second_sequence_t && second,
                                                  static_band const & band,
-                                                 [[maybe_unused]] trace_t const initial_value = trace_t{})
+                                                 trace_t const initial_value = trace_t{})
+    {
+        reset(first, second, band, initial_value);
+    }
+    //!\}
+
+    /*!\brief Re-initialises the matrix for two other ranges and a band.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first         The first range.
+     * \param[in] second        The second range.
+     * \param[in] band          The seqan3::static_band in which to calculate the alignment.
+     * \param[in] initial_value The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * Has the same effect as constructing the matrix from the ranges and the band, but keeps the allocated traceback
+     * matrix if it is large enough.
+     */
+    template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
+    constexpr void reset(first_sequence_t && first,
+                         second_sequence_t && second,
+                         static_band const & band,
+                         [[maybe_unused]] trace_t const initial_value = trace_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
@@ -140,12 +164,11 @@ public:
         // Reserve one more cell to deal with last cell in the banded column which needs only the diagonal and up cell.
         if constexpr (!coordinate_only)
         {
-            matrix_base_t::data = typename matrix_base_t::pool_type{number_rows{static_cast<size_type>(band_size)},
-                                                                    number_cols{matrix_base_t::num_cols}};
-            matrix_base_t::cache_left.resize(band_size + 1, initial_value);
+            matrix_base_t::allocate_data(number_rows{static_cast<size_type>(band_size)},
+                                         number_cols{matrix_base_t::num_cols});
+            reuse_storage(matrix_base_t::cache_left, band_size + 1, initial_value);
         }
     }
-    //!\}
 
     //!\copydoc seqan3::detail::alignment_trace_matrix_full::trace_path
     auto trace_path(matrix_coordinate const & trace_begin)
@@ -159,6 +182,8 @@ public:
         if (trace_begin.row >= static_cast<size_t>(band_size) || trace_begin.col >= matrix_base_t::num_cols)
             throw std::invalid_argument{"The given coordinate exceeds the trace matrix size."};
 
+        matrix_base_t::flush_column();
+
         return path_t{trace_iterator_t{matrix_base_t::data.begin() + matrix_offset{trace_begin},
                                        column_index_type{band_col_index}},
                       std::ranges::default_sentinel};
@@ -199,7 +224,7 @@ private:
             size_type slice_size =  slice_end - slice_begin;
             // We need to jump to the offset.
             auto col = views::zip(
-                            std::span<element_type>{std::addressof(matrix_base_t::data[band_begin]), slice_size},
+                            std::span<element_type>{matrix_base_t::column_data(band_begin, slice_size), slice_size},
                             std::span<element_type>{std::addressof(matrix_base_t::cache_left[slice_begin]), slice_size},
                             std::views::iota(std::move(row_begin), std::move(row_end)));
             return alignment_column_type{*this, column_data_view_type{std::move(col)}};
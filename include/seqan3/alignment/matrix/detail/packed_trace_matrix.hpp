@@ -0,0 +1,300 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::packed_trace_matrix.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/reuse_storage.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix_iterator_base.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief A column-major two-dimensional matrix over seqan3::detail::trace_directions using four bits per cell.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * The traceback (see seqan3::detail::trace_iterator_base) only distinguishes the preferred direction of a cell, where
+ * diagonal is preferred over up and up is preferred over left, and whether a vertical or horizontal gap is opened in
+ * this cell. Hence, every cell is stored as a four bit code: two bits for the preferred direction and one bit for each
+ * of seqan3::detail::trace_directions::up_open and seqan3::detail::trace_directions::left_open. Two cells share one
+ * byte. Reading a cell returns the decoded trace directions, which lead to the same trace path as the original value
+ * but might drop directions that are never followed.
+ *
+ * The matrix is written column-wise with #assign_column and read with a
+ * seqan3::detail::two_dimensional_matrix_iterator, i.e. it can be used with seqan3::detail::trace_iterator and
+ * seqan3::detail::trace_iterator_banded.
+ */
+class packed_trace_matrix
+{
+public:
+    class iterator;
+
+    /*!\name Associated types
+     * \{
+     */
+    using value_type = trace_directions; //!< The value type.
+    using reference = trace_directions; //!< The cells are decoded on access, so the reference is a value.
+    using const_reference = trace_directions; //!< The const reference type.
+    using difference_type = std::ptrdiff_t; //!< The difference type.
+    using size_type = size_t; //!< The size type.
+    using const_iterator = iterator; //!< The matrix can only be modified with #assign_column.
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    packed_trace_matrix() = default; //!< Defaulted
+    packed_trace_matrix(packed_trace_matrix const &) = default; //!< Defaulted
+    packed_trace_matrix(packed_trace_matrix &&) = default; //!< Defaulted
+    packed_trace_matrix & operator=(packed_trace_matrix const &) = default; //!< Defaulted
+    packed_trace_matrix & operator=(packed_trace_matrix &&) = default; //!< Defaulted
+    ~packed_trace_matrix() = default; //!< Defaulted
+
+    /*!\brief Constructs the matrix by the given dimensions; every cell is seqan3::detail::trace_directions::none.
+     * \param row_dim The row dimension (number of rows).
+     * \param col_dim The column dimension (number of columns).
+     */
+    packed_trace_matrix(number_rows const row_dim, number_cols const col_dim) :
+        row_dim{row_dim.get()}, col_dim{col_dim.get()}
+    {
+        storage.resize((row_dim.get() * col_dim.get() + 1u) / 2u);
+    }
+    //!\}
+
+    /*!\brief Changes the dimensions of the matrix; every cell is seqan3::detail::trace_directions::none afterwards.
+     * \param row_dim The new row dimension (number of rows).
+     * \param col_dim The new column dimension (number of columns).
+     *
+     * \details
+     *
+     * The allocated memory is reused if it is large enough (see seqan3::detail::reuse_storage).
+     */
+    void resize(number_rows const row_dim, number_cols const col_dim)
+    {
+        this->row_dim = row_dim.get();
+        this->col_dim = col_dim.get();
+        reuse_storage(storage, (row_dim.get() * col_dim.get() + 1u) / 2u);
+    }
+
+    //!\copydoc seqan3::detail::two_dimensional_matrix::rows
+    size_type rows() const noexcept
+    {
+        return row_dim;
+    }
+
+    //!\copydoc seqan3::detail::two_dimensional_matrix::cols
+    size_type cols() const noexcept
+    {
+        return col_dim;
+    }
+
+    //!\brief Returns the trace directions of the cell at the given coordinate.
+    trace_directions operator[](matrix_coordinate const & coordinate) const noexcept
+    {
+        assert(coordinate.row < rows());
+        assert(coordinate.col < cols());
+
+        return get(coordinate.col * row_dim + coordinate.row);
+    }
+
+    /*!\brief Stores consecutive cells of one column.
+     * \tparam column_t The type of the column slice; must model std::ranges::input_range over
+     *                  seqan3::detail::trace_directions.
+     * \param[in] slice_begin The coordinate of the first cell to store.
+     * \param[in] column      The trace directions of the cells starting at `slice_begin`.
+     */
+    template <std::ranges::input_range column_t>
+    void assign_column(matrix_coordinate const & slice_begin, column_t && column) noexcept
+    {
+        size_t index = slice_begin.col * row_dim + slice_begin.row;
+        for (trace_directions const trace : column)
+        {
+            assert(index < (slice_begin.col + 1u) * row_dim);
+            set(index++, trace);
+        }
+    }
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator pointing to the first cell of the matrix.
+    iterator begin() const noexcept;
+    //!\copydoc begin()
+    iterator cbegin() const noexcept;
+    //!\brief Returns an iterator pointing behind-the-end of the matrix.
+    iterator end() const noexcept;
+    //!\copydoc end()
+    iterator cend() const noexcept;
+    //!\}
+
+private:
+    //!\brief Encodes the trace directions as four bit code.
+    static constexpr uint8_t pack(trace_directions const trace) noexcept
+    {
+        uint8_t const direction = static_cast<bool>(trace & trace_directions::diagonal) ? 1u :
+                                  static_cast<bool>(trace & (trace_directions::up | trace_directions::up_open)) ? 2u :
+                                  static_cast<bool>(trace & (trace_directions::left | trace_directions::left_open)) ?
+                                  3u : 0u;
+
+        return direction |
+               (static_cast<bool>(trace & trace_directions::up_open) ? 0b0100u : 0u) |
+               (static_cast<bool>(trace & trace_directions::left_open) ? 0b1000u : 0u);
+    }
+
+    //!\brief Decodes the four bit code.
+    static constexpr trace_directions unpack(uint8_t const code) noexcept
+    {
+        constexpr std::array<trace_directions, 4> directions{trace_directions::none,
+                                                             trace_directions::diagonal,
+                                                             trace_directions::up,
+                                                             trace_directions::left};
+
+        return directions[code & 0b0011u] |
+               ((code & 0b0100u) ? trace_directions::up_open : trace_directions::none) |
+               ((code & 0b1000u) ? trace_directions::left_open : trace_directions::none);
+    }
+
+    //!\brief Returns the decoded cell at the given linear index.
+    trace_directions get(size_t const index) const noexcept
+    {
+        return unpack((storage[index / 2u] >> (4u * (index % 2u))) & 0b1111u);
+    }
+
+    //!\brief Stores the encoded cell at the given linear index.
+    void set(size_t const index, trace_directions const trace) noexcept
+    {
+        uint8_t const shift = 4u * (index % 2u);
+        uint8_t & byte = storage[index / 2u];
+        byte = (byte & ~(0b1111u << shift)) | (pack(trace) << shift);
+    }
+
+    //!\brief The packed cells in column-major order.
+    std::vector<uint8_t> storage{};
+    //!\brief The number of rows.
+    size_type row_dim{};
+    //!\brief The number of columns.
+    size_type col_dim{};
+};
+
+/*!\brief The two-dimensional iterator over the seqan3::detail::packed_trace_matrix.
+ * \implements seqan3::detail::two_dimensional_matrix_iterator
+ */
+class packed_trace_matrix::iterator :
+    public two_dimensional_matrix_iterator_base<packed_trace_matrix::iterator, matrix_major_order::column>
+{
+private:
+    //!\brief The base class type.
+    using base_t = two_dimensional_matrix_iterator_base<iterator, matrix_major_order::column>;
+
+    //!\brief Befriend the base crtp class.
+    friend base_t;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    using value_type = trace_directions; //!< The value type.
+    using reference = trace_directions; //!< The cells are decoded on access, so the reference is a value.
+    using pointer = void; //!< No pointer type.
+    using difference_type = std::ptrdiff_t; //!< The difference type.
+    using iterator_category = std::random_access_iterator_tag; //!< The iterator tag.
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    iterator() = default; //!< Defaulted.
+    iterator(iterator const &) = default; //!< Defaulted.
+    iterator(iterator &&) = default; //!< Defaulted.
+    iterator & operator=(iterator const &) = default; //!< Defaulted.
+    iterator & operator=(iterator &&) = default; //!< Defaulted.
+    ~iterator() = default; //!< Defaulted.
+
+    /*!\brief Construction from the underlying matrix and the linear index of the cell.
+     * \param[in] matrix The underlying matrix.
+     * \param[in] index  The linear index of the cell in column-major order.
+     */
+    iterator(packed_trace_matrix const & matrix, difference_type const index) noexcept :
+        matrix_ptr{&matrix},
+        host_iter{index}
+    {}
+    //!\}
+
+    // Import advance operator from base class.
+    using base_t::operator+=;
+
+    //!\brief Advances the iterator by the given `offset`.
+    iterator & operator+=(matrix_offset const & offset) noexcept
+    {
+        assert(matrix_ptr != nullptr);
+
+        host_iter += offset.col * static_cast<difference_type>(matrix_ptr->rows()) + offset.row;
+        return *this;
+    }
+
+    //!\brief Returns the decoded cell.
+    reference operator*() const noexcept
+    {
+        assert(matrix_ptr != nullptr);
+
+        return matrix_ptr->get(host_iter);
+    }
+
+    //!\copydoc seqan3::detail::two_dimensional_matrix_iterator::coordinate()
+    matrix_coordinate coordinate() const noexcept
+    {
+        assert(matrix_ptr != nullptr);
+
+        size_t const rows = matrix_ptr->rows();
+        return {row_index_type{static_cast<size_t>(host_iter) % rows},
+                column_index_type{static_cast<size_t>(host_iter) / rows}};
+    }
+
+private:
+    //!\brief Points to the associated matrix.
+    packed_trace_matrix const * matrix_ptr{nullptr};
+    //!\brief The linear index of the cell; named as the storage iterator used by the base class.
+    difference_type host_iter{};
+};
+
+inline packed_trace_matrix::iterator packed_trace_matrix::begin() const noexcept
+{
+    return {*this, 0};
+}
+
+inline packed_trace_matrix::iterator packed_trace_matrix::cbegin() const noexcept
+{
+    return begin();
+}
+
+inline packed_trace_matrix::iterator packed_trace_matrix::end() const noexcept
+{
+    return {*this, static_cast<difference_type>(row_dim * col_dim)};
+}
+
+inline packed_trace_matrix::iterator packed_trace_matrix::cend() const noexcept
+{
+    return end();
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::reuse_storage and seqan3::detail::reuse_storage_allocation_counter.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Counts the allocations of seqan3::detail::reuse_storage in the calling thread while it is alive.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * seqan3::detail::reuse_storage only counts its allocations if a counter is active in the calling thread. The
+ * alignment algorithms create one for the computation of a chunk if seqan3::align_cfg::statistics is configured, so
+ * nothing is counted otherwise. Counters can be nested, in which case only the innermost one counts. A counter that
+ * is constructed from a `nullptr` does not count and leaves an enclosing counter active.
+ */
+class reuse_storage_allocation_counter
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    reuse_storage_allocation_counter() = delete; //!< Deleted.
+    reuse_storage_allocation_counter(reuse_storage_allocation_counter const &) = delete; //!< Deleted.
+    reuse_storage_allocation_counter(reuse_storage_allocation_counter &&) = delete; //!< Deleted.
+    reuse_storage_allocation_counter & operator=(reuse_storage_allocation_counter const &) = delete; //!< Deleted.
+    reuse_storage_allocation_counter & operator=(reuse_storage_allocation_counter &&) = delete; //!< Deleted.
+
+    /*!\brief Counts the allocations into the given variable until the counter is destroyed.
+     * \param[in] allocations Points to the variable that is incremented for every allocation; may be `nullptr`.
+     */
+    explicit reuse_storage_allocation_counter(uint64_t * const allocations) noexcept : previous{active()}
+    {
+        if (allocations != nullptr)
+            active() = allocations;
+    }
+
+    //!\brief Restores the counter that was active before.
+    ~reuse_storage_allocation_counter() noexcept
+    {
+        active() = previous;
+    }
+    //!\}
+
+    //!\brief Counts one allocation if a counter is active in the calling thread.
+    static void count() noexcept
+    {
+        if (uint64_t * const allocations = active(); allocations != nullptr)
+            ++*allocations;
+    }
+
+private:
+    //!\brief The variable the innermost counter of the calling thread counts into; `nullptr` if there is none.
+    static uint64_t * & active() noexcept
+    {
+        thread_local uint64_t * allocations{nullptr};
+        return allocations;
+    }
+
+    //!\brief The counter that was active when this one was created.
+    uint64_t * previous;
+};
+
+/*!\brief Sets the size of a vector and overwrites all elements, keeping the allocated memory if it suffices.
+ * \ingroup alignment_matrix
+ * \tparam storage_t The type of the vector, e.g. std::vector.
+ * \param[in,out] storage The vector to resize.
+ * \param[in]     size    The new size.
+ * \param[in]     value   The value every element is set to; value initialised if not specified.
+ *
+ * \details
+ *
+ * The matrices of the alignment algorithms are kept by the algorithm object and re-initialised for every sequence
+ * pair. If the memory of the vector is too small, the capacity is at least doubled, such that a series of growing
+ * sequence pairs only leads to a logarithmic number of allocations. Afterwards the vector does not allocate again
+ * unless a larger sequence pair is encountered.
+ */
+template <typename storage_t>
+void reuse_storage(storage_t & storage,
+                   size_t const size,
+                   std::ranges::range_value_t<storage_t> const & value = std::ranges::range_value_t<storage_t>{})
+{
+    if (storage.capacity() < size)
+    {
+        size_t const new_capacity = std::max<size_t>(size, 2u * storage.capacity());
+        storage.clear(); // Avoids copying the old elements into the new memory.
+        storage.reserve(new_capacity);
+        reuse_storage_allocation_counter::count();
+    }
+
+    storage.assign(size, value);
+}
+
+} // namespace seqan3::detail
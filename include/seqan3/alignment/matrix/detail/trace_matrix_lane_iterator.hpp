@@ -0,0 +1,118 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::trace_matrix_lane_iterator.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix_iterator_base.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix_iterator_concept.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/core/simd/concept.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+#include <seqan3/core/type_traits/pre.hpp>
+#include <seqan3/std/iterator>
+
+namespace seqan3::detail
+{
+
+/*!\brief A two-dimensional iterator over the trace directions of a single alignment in a vectorised trace matrix.
+ * \ingroup alignment_matrix
+ * \implements seqan3::detail::two_dimensional_matrix_iterator
+ * \tparam matrix_iter_t The wrapped matrix iterator; must model seqan3::detail::two_dimensional_matrix_iterator and
+ *                       its value type must model seqan3::simd::simd_concept.
+ *
+ * \details
+ *
+ * A vectorised trace matrix stores the trace directions of all alignments of a batch in one simd vector per cell.
+ * This iterator moves like the wrapped iterator, but dereferencing it returns the trace directions of the given lane
+ * only. Thus, the trace path of one alignment can be followed with a seqan3::detail::trace_iterator without copying
+ * the lane into a scalar matrix first.
+ */
+template <two_dimensional_matrix_iterator matrix_iter_t>
+class trace_matrix_lane_iterator :
+    public two_dimensional_matrix_iterator_base<trace_matrix_lane_iterator<matrix_iter_t>, matrix_major_order::column>
+{
+private:
+    static_assert(simd_concept<value_type_t<matrix_iter_t>>, "The wrapped iterator must point to simd vectors.");
+
+    //!\brief The base class type.
+    using base_t = two_dimensional_matrix_iterator_base<trace_matrix_lane_iterator, matrix_major_order::column>;
+
+    //!\brief Befriend the base crtp class.
+    friend base_t;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    using value_type = trace_directions; //!< The value type.
+    using reference = trace_directions; //!< The lane is extracted on access, so the reference is a value.
+    using pointer = void; //!< No pointer type.
+    using difference_type = difference_type_t<matrix_iter_t>; //!< The difference type.
+    using iterator_category = std::random_access_iterator_tag; //!< The iterator tag.
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr trace_matrix_lane_iterator() = default; //!< Defaulted.
+    constexpr trace_matrix_lane_iterator(trace_matrix_lane_iterator const &) = default; //!< Defaulted.
+    constexpr trace_matrix_lane_iterator(trace_matrix_lane_iterator &&) = default; //!< Defaulted.
+    constexpr trace_matrix_lane_iterator & operator=(trace_matrix_lane_iterator const &) = default; //!< Defaulted.
+    constexpr trace_matrix_lane_iterator & operator=(trace_matrix_lane_iterator &&) = default; //!< Defaulted.
+    ~trace_matrix_lane_iterator() = default; //!< Defaulted.
+
+    /*!\brief Construction from the wrapped matrix iterator and the lane to read.
+     * \param[in] matrix_iter The wrapped matrix iterator.
+     * \param[in] lane        The position of the alignment within the simd vector.
+     */
+    constexpr trace_matrix_lane_iterator(matrix_iter_t const matrix_iter, size_t const lane) noexcept :
+        host_iter{matrix_iter},
+        lane{lane}
+    {
+        assert(lane < simd_traits<value_type_t<matrix_iter_t>>::length);
+    }
+    //!\}
+
+    // Import advance operator from base class.
+    using base_t::operator+=;
+
+    //!\brief Advances the iterator by the given `offset`.
+    constexpr trace_matrix_lane_iterator & operator+=(matrix_offset const & offset) noexcept
+    {
+        host_iter += offset;
+        return *this;
+    }
+
+    //!\brief Returns the trace directions of the lane.
+    constexpr reference operator*() const noexcept
+    {
+        return static_cast<trace_directions>((*host_iter)[lane]);
+    }
+
+    //!\copydoc seqan3::detail::two_dimensional_matrix_iterator::coordinate()
+    constexpr matrix_coordinate coordinate() const noexcept
+    {
+        return host_iter.coordinate();
+    }
+
+private:
+    //!\brief The wrapped matrix iterator.
+    matrix_iter_t host_iter{};
+    //!\brief The position of the alignment within the simd vector.
+    size_t lane{};
+};
+
+} // namespace seqan3::detail
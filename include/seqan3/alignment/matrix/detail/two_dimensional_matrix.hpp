@@ -16,6 +16,7 @@
 #include <vector>
 
 #include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/reuse_storage.hpp>
 #include <seqan3/alignment/matrix/detail/two_dimensional_matrix_iterator_base.hpp>
 #include <seqan3/core/type_traits/deferred_crtp_base.hpp>
 #include <seqan3/core/type_traits/template_inspection.hpp>
@@ -185,6 +186,21 @@ public:
     }
     //!\}
 
+    /*!\brief Changes the dimensions of the matrix and value initialises every element.
+     * \param row_dim The new row dimension (number of rows).
+     * \param col_dim The new column dimension (number of columns).
+     *
+     * \details
+     *
+     * The allocated memory is reused if it is large enough (see seqan3::detail::reuse_storage).
+     */
+    void resize(number_rows const row_dim, number_cols const col_dim)
+    {
+        this->row_dim = row_dim.get();
+        this->col_dim = col_dim.get();
+        reuse_storage(storage, row_dim.get() * col_dim.get());
+    }
+
     /*!\brief Returns a reference to the element at the given coordinate.
      * \param[in] coordinate The two-dimensional coordinate to access.
      */
@@ -0,0 +1,192 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::edit_distance_trace_matrix_banded.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_fwd.hpp>
+#include <seqan3/core/bit_manipulation.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The underlying data structure of seqan3::detail::edit_distance_banded that represents the
+ *        trace matrix.
+ * \ingroup pairwise_alignment
+ * \tparam word_t         \copydoc word_type
+ * \tparam is_semi_global \copydoc default_edit_distance_trait_type::is_semi_global
+ *
+ * \details
+ *
+ * In contrast to seqan3::detail::edit_distance_trace_matrix_full, every column only stores the bit-vectors of the
+ * cells that are covered by the band. The band is stored diagonal-wise, i.e. the bit at position `k` of column `col`
+ * corresponds to the row `col - upper_diagonal + k`. Cells that are not covered by the band have the trace direction
+ * seqan3::detail::trace_directions::none.
+ */
+template <typename word_t, bool is_semi_global>
+class edit_distance_trace_matrix_banded
+{
+public:
+    //!\brief This friend allows the edit distance algorithm to fill the trace matrix via add_column.
+    template <std::ranges::viewable_range database_t,
+              std::ranges::viewable_range query_t,
+              typename align_config_t,
+              typename edit_traits>
+    friend class edit_distance_banded;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+     edit_distance_trace_matrix_banded() = default;                                                      //!< Defaulted
+     edit_distance_trace_matrix_banded(edit_distance_trace_matrix_banded const &) = default;             //!< Defaulted
+     edit_distance_trace_matrix_banded(edit_distance_trace_matrix_banded &&) = default;                  //!< Defaulted
+     edit_distance_trace_matrix_banded & operator=(edit_distance_trace_matrix_banded const &) = default; //!< Defaulted
+     edit_distance_trace_matrix_banded & operator=(edit_distance_trace_matrix_banded &&) = default;      //!< Defaulted
+     ~edit_distance_trace_matrix_banded() = default;                                                     //!< Defaulted
+
+protected:
+     /*!\brief Construct the trace matrix.
+      * \param rows_size      \copydoc rows_size
+      * \param upper_diagonal \copydoc upper_diagonal
+      * \param band_size      \copydoc band_size
+      */
+     edit_distance_trace_matrix_banded(size_t const rows_size, int64_t const upper_diagonal, size_t const band_size) :
+         rows_size{rows_size},
+         upper_diagonal{upper_diagonal},
+         band_size{band_size},
+         block_count{(band_size + word_size - 1u) / word_size}
+     {}
+    //!\}
+
+public:
+    //!\copydoc default_edit_distance_trait_type::word_type
+    using word_type = word_t;
+
+    //!\copydoc default_edit_distance_trait_type::word_size
+    static constexpr auto word_size = sizeof_bits<word_type>;
+
+    //!\copydoc seqan3::detail::matrix::value_type
+    using value_type = detail::trace_directions;
+
+    //!\copydoc seqan3::detail::matrix::reference
+    using reference = value_type;
+
+    //!\copydoc seqan3::detail::matrix::size_type
+    using size_type = size_t;
+
+    /*!\brief Increase the capacity of the columns to a value that's greater or equal to `new_capacity`.
+     * \param new_capacity The new capacity.
+     * \details
+     *
+     * ### Exception
+     *
+     * Strong exception guarantee.
+     */
+    void reserve(size_t const new_capacity)
+    {
+        left.reserve(new_capacity * block_count);
+        diagonal.reserve(new_capacity * block_count);
+        up.reserve(new_capacity * block_count);
+    }
+
+public:
+    //!\copydoc seqan3::detail::matrix::at
+    reference at(matrix_coordinate const & coordinate) const noexcept
+    {
+        size_t row = coordinate.row;
+        size_t col = coordinate.col;
+
+        assert(row < rows());
+        assert(col < cols());
+
+        if (row == 0u)
+        {
+            if constexpr(is_semi_global)
+                return detail::trace_directions::none;
+
+            if (col == 0u)
+                return detail::trace_directions::none;
+
+            return detail::trace_directions::left;
+        }
+
+        if (col == 0u)
+            return detail::trace_directions::up;
+
+        int64_t const band_position = static_cast<int64_t>(row) - static_cast<int64_t>(col) + upper_diagonal;
+
+        if (band_position < 0 || !(static_cast<size_t>(band_position) < band_size))
+            return detail::trace_directions::none;
+
+        size_t const idx = col * block_count + band_position / word_size;
+        word_type const mask = word_type{1u} << (band_position % word_size);
+
+        auto const dir = ((left[idx] & mask) ? detail::trace_directions::left : detail::trace_directions::none) |
+                         ((diagonal[idx] & mask) ? detail::trace_directions::diagonal
+                                                 : detail::trace_directions::none) |
+                         ((up[idx] & mask) ? detail::trace_directions::up : detail::trace_directions::none);
+
+        return dir;
+    }
+
+    //!\copydoc seqan3::detail::matrix::rows
+    size_t rows() const noexcept
+    {
+        return rows_size;
+    }
+
+    //!\copydoc seqan3::detail::matrix::cols
+    size_t cols() const noexcept
+    {
+        return (block_count == 0u) ? 0u : up.size() / block_count;
+    }
+
+protected:
+    /*!\brief Adds a column to the trace matrix.
+     * \param new_left     Indicates for each cell of the band whether the trace comes from the left.
+     * \param new_diagonal Indicates for each cell of the band whether the trace comes from the diagonal.
+     * \param new_up       Indicates for each cell of the band whether the trace comes from above.
+     */
+    void add_column(std::vector<word_type> const & new_left,
+                    std::vector<word_type> const & new_diagonal,
+                    std::vector<word_type> const & new_up)
+    {
+        assert(new_left.size() == block_count);
+        assert(new_diagonal.size() == block_count);
+        assert(new_up.size() == block_count);
+
+        left.insert(left.end(), new_left.begin(), new_left.end());
+        diagonal.insert(diagonal.end(), new_diagonal.begin(), new_diagonal.end());
+        up.insert(up.end(), new_up.begin(), new_up.end());
+    }
+
+private:
+    //!\brief The number of rows in the matrix.
+    size_t rows_size{};
+    //!\brief The upper diagonal of the band, i.e. column `col` stores the rows starting at `col - upper_diagonal`.
+    int64_t upper_diagonal{};
+    //!\brief The number of cells stored per column.
+    size_t band_size{};
+    //!\brief The number of machine words stored per column.
+    size_t block_count{};
+    //!\brief The left bits of all columns stored one after another.
+    std::vector<word_type> left{};
+    //!\brief The diagonal bits of all columns stored one after another.
+    std::vector<word_type> diagonal{};
+    //!\brief The up bits of all columns stored one after another.
+    std::vector<word_type> up{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,275 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ * \brief Provides seqan3::detail::edit_distance_trace_matrix_checkpointed.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_fwd.hpp>
+#include <seqan3/core/bit_manipulation.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The trace matrix of seqan3::detail::edit_distance_unbanded for long sequences, which only stores the
+ *        vertical differences of every `k`-th column and recomputes the traces in between on demand.
+ * \ingroup pairwise_alignment
+ * \tparam word_t         \copydoc word_type
+ * \tparam is_semi_global \copydoc default_edit_distance_trait_type::is_semi_global
+ *
+ * \details
+ *
+ * Let `n` be the number of columns and `m` the number of rows. In contrast to
+ * seqan3::detail::edit_distance_trace_matrix_full, which stores three bit-vectors of `m` bits for every column, this
+ * matrix stores the two bit-vectors `vp` and `vn` of every `k`-th column, where `k` is the rounded up square root of
+ * `n`. If a cell is accessed, the `k` columns following its checkpoint are recomputed from the checkpoint and kept
+ * until a cell of another segment is accessed. Hence, the matrix needs \f$ O(m \sqrt{n}) \f$ bits instead of
+ * \f$ O(nm) \f$ bits. Since the traceback walks through the matrix from right to left, every segment is recomputed
+ * once per traceback.
+ *
+ * The traces are recomputed with the same function as in the forward pass, which is passed by
+ * seqan3::detail::edit_distance_unbanded together with the bit masks of the query. Accessing a cell modifies the
+ * cached segment, so concurrent calls to #at on the same matrix are not thread-safe.
+ */
+template <typename word_t, bool is_semi_global>
+class edit_distance_trace_matrix_checkpointed
+{
+public:
+    //!\brief This friend allows the edit distance algorithm to fill the trace matrix via add_column.
+    template <std::ranges::viewable_range database_t,
+              std::ranges::viewable_range query_t,
+              typename align_config_t,
+              typename edit_traits>
+    friend class edit_distance_unbanded;
+
+    //!\copydoc default_edit_distance_trait_type::word_type
+    using word_type = word_t;
+
+    /*!\brief The function that computes the traces of the next column.
+     *
+     * \details
+     *
+     * The function is invoked with the bit masks of the database symbol of the column, the vertical differences
+     * `vp` and `vn` of the previous column, which are updated to the ones of the computed column, and the output
+     * for the bit-vectors of the horizontal (left) and diagonal traces of the computed column.
+     */
+    using column_function_type = void (*)(word_type const * symbol_bit_masks,
+                                          std::vector<word_type> & vp,
+                                          std::vector<word_type> & vn,
+                                          word_type * left,
+                                          word_type * diagonal);
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_trace_matrix_checkpointed() = default;                                                //!< Defaulted
+    edit_distance_trace_matrix_checkpointed(edit_distance_trace_matrix_checkpointed const &) = default; //!< Defaulted
+    edit_distance_trace_matrix_checkpointed(edit_distance_trace_matrix_checkpointed &&) = default;      //!< Defaulted
+    edit_distance_trace_matrix_checkpointed & operator=(edit_distance_trace_matrix_checkpointed const &)
+        = default; //!< Defaulted
+    edit_distance_trace_matrix_checkpointed & operator=(edit_distance_trace_matrix_checkpointed &&)
+        = default; //!< Defaulted
+    ~edit_distance_trace_matrix_checkpointed() = default;                                               //!< Defaulted
+
+protected:
+    //!\brief Allow seqan3::detail::edit_distance_unbanded_trace_matrix_policy to access the private constructor.
+    template <typename derived_t, typename edit_traits>
+    friend class edit_distance_unbanded_trace_matrix_policy;
+
+    /*!\brief Construct the trace matrix.
+     * \param rows_size      \copydoc rows_size
+     * \param cols_capacity  The number of columns that will be added.
+     * \param bit_masks      \copydoc bit_masks
+     * \param compute_column \copydoc compute_column
+     */
+    edit_distance_trace_matrix_checkpointed(size_t const rows_size,
+                                            size_t const cols_capacity,
+                                            std::shared_ptr<std::vector<word_type> const> bit_masks,
+                                            column_function_type const compute_column) :
+        rows_size{rows_size},
+        block_count{(rows_size + word_size - 2u) / word_size},
+        checkpoint_distance{std::max<size_t>(std::ceil(std::sqrt(static_cast<double>(cols_capacity))), 1u)},
+        bit_masks{std::move(bit_masks)},
+        compute_column{compute_column}
+    {
+        ranks.reserve(cols_capacity);
+        checkpoints.reserve(cols_capacity / checkpoint_distance + 1u);
+    }
+    //!\}
+
+public:
+    //!\copydoc default_edit_distance_trait_type::word_size
+    static constexpr auto word_size = sizeof_bits<word_type>;
+
+    //!\copydoc seqan3::detail::matrix::value_type
+    using value_type = detail::trace_directions;
+
+    //!\copydoc seqan3::detail::matrix::reference
+    using reference = value_type;
+
+    //!\copydoc seqan3::detail::matrix::size_type
+    using size_type = size_t;
+
+    /*!\copydoc seqan3::detail::matrix::at
+     * \details
+     *
+     * Recomputes the segment of the accessed column if it is not the cached one.
+     *
+     * ### Exception
+     *
+     * Might throw std::bad_alloc if the segment is recomputed.
+     */
+    reference at(matrix_coordinate const & coordinate) const
+    {
+        size_t row = coordinate.row;
+        size_t col = coordinate.col;
+
+        assert(row < rows());
+        assert(col < cols());
+
+        if (row == 0u)
+        {
+            if constexpr(is_semi_global)
+                return detail::trace_directions::none;
+
+            if (col == 0u)
+                return detail::trace_directions::none;
+
+            return detail::trace_directions::left;
+        }
+
+        if (col == 0u)
+            return detail::trace_directions::up;
+
+        size_t const segment = (col - 1u) / checkpoint_distance;
+        if (segment != cached_segment)
+            recompute_segment(segment);
+
+        size_t const idx = ((col - 1u) % checkpoint_distance) * block_count + (row - 1u) / word_size;
+        word_type const mask = word_type{1u} << ((row - 1u) % word_size);
+
+        auto const dir = ((left[idx] & mask) ? detail::trace_directions::left : detail::trace_directions::none) |
+                         ((diagonal[idx] & mask) ? detail::trace_directions::diagonal
+                                                 : detail::trace_directions::none) |
+                         ((up[idx] & mask) ? detail::trace_directions::up : detail::trace_directions::none);
+
+        return dir;
+    }
+
+    //!\copydoc seqan3::detail::matrix::rows
+    size_t rows() const noexcept
+    {
+        return rows_size;
+    }
+
+    //!\copydoc seqan3::detail::matrix::cols
+    size_t cols() const noexcept
+    {
+        return cols_size;
+    }
+
+protected:
+    //!\brief The vertical differences of a column from which the following columns are recomputed.
+    struct checkpoint_type
+    {
+        //!\brief Machine words which represent the positive vertical differences.
+        std::vector<word_type> vp{};
+        //!\brief Machine words which represent the negative vertical differences.
+        std::vector<word_type> vn{};
+    };
+
+    /*!\brief Adds a column to the trace matrix.
+     * \param vp   \copydoc checkpoint_type::vp
+     * \param vn   \copydoc checkpoint_type::vn
+     * \param rank The rank of the database symbol of this column; ignored for the first column.
+     *
+     * \details
+     *
+     * Only the rank is stored, unless the column is a checkpoint.
+     */
+    void add_column(std::vector<word_type> const & vp, std::vector<word_type> const & vn, size_t const rank)
+    {
+        if (cols_size > 0u)
+            ranks.push_back(static_cast<uint32_t>(rank));
+
+        if (cols_size % checkpoint_distance == 0u)
+            checkpoints.push_back(checkpoint_type{vp, vn});
+
+        ++cols_size;
+    }
+
+private:
+    /*!\brief Recomputes the columns `(s * k, (s + 1) * k]` of the segment `s` from its checkpoint.
+     * \param segment The index `s` of the segment.
+     */
+    void recompute_segment(size_t const segment) const
+    {
+        size_t const first_column = segment * checkpoint_distance;
+        size_t const column_count = std::min(checkpoint_distance, cols_size - 1u - first_column);
+
+        vp = checkpoints[segment].vp;
+        vn = checkpoints[segment].vn;
+        left.resize(column_count * block_count);
+        diagonal.resize(column_count * block_count);
+        up.resize(column_count * block_count);
+
+        for (size_t column = 0; column < column_count; ++column)
+        {
+            size_t const offset = column * block_count;
+            compute_column(bit_masks->data() + block_count * ranks[first_column + column],
+                           vp,
+                           vn,
+                           left.data() + offset,
+                           diagonal.data() + offset);
+            std::copy(vp.begin(), vp.end(), up.begin() + offset);
+        }
+
+        cached_segment = segment;
+    }
+
+    //!\copydoc seqan3::detail::matrix::rows
+    size_t rows_size{};
+    //!\brief The number of columns that were added.
+    size_t cols_size{};
+    //!\brief The number of machine words per column.
+    size_t block_count{};
+    //!\brief The number of columns between two checkpoints.
+    size_t checkpoint_distance{1u};
+    //!\brief The bit masks of the query (see seqan3::detail::edit_distance_query_cache).
+    std::shared_ptr<std::vector<word_type> const> bit_masks{};
+    //!\brief The function that recomputes a single column.
+    column_function_type compute_column{};
+    //!\brief The ranks of the database symbols; the rank at position `i` belongs to the column `i + 1`.
+    std::vector<uint32_t> ranks{};
+    //!\brief The checkpoints of the columns `0, k, 2k, ...`.
+    std::vector<checkpoint_type> checkpoints{};
+
+    //!\brief The segment whose columns are cached.
+    mutable size_t cached_segment{std::numeric_limits<size_t>::max()};
+    //!\brief The positive vertical differences while recomputing a segment.
+    mutable std::vector<word_type> vp{};
+    //!\brief The negative vertical differences while recomputing a segment.
+    mutable std::vector<word_type> vn{};
+    //!\brief Machine words which represent the trace_direction::left of the cached columns.
+    mutable std::vector<word_type> left{};
+    //!\brief Machine words which represent the trace_direction::diagonal of the cached columns.
+    mutable std::vector<word_type> diagonal{};
+    //!\brief Machine words which represent the trace_direction::up of the cached columns.
+    mutable std::vector<word_type> up{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,365 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_all_pairs.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/alignment_configurator.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/type_traits/template_inspection.hpp>
+#include <seqan3/range/views/chunk.hpp>
+#include <seqan3/range/views/zip.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Divides the upper triangle of an all-vs-all comparison into square tiles.
+ * \ingroup pairwise_alignment
+ *
+ * \details
+ *
+ * A tile covers the sequence pairs `(first, second)` with `first` in `[first_begin, first_end)`, `second` in
+ * `[second_begin, second_end)` and `first < second`. The tiles are numbered row by row, such that every pair of
+ * distinct sequences is covered by exactly one tile. Tiles on the diagonal contain only half as many pairs.
+ */
+class all_pairs_tiling
+{
+public:
+    //!\brief The ranges of sequence indices covered by a tile.
+    struct tile
+    {
+        size_t first_begin;  //!< The index of the first sequence of the rows.
+        size_t first_end;    //!< Behind the index of the last sequence of the rows.
+        size_t second_begin; //!< The index of the first sequence of the columns.
+        size_t second_end;   //!< Behind the index of the last sequence of the columns.
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    all_pairs_tiling() = default;                                     //!< Defaulted.
+    all_pairs_tiling(all_pairs_tiling const &) = default;             //!< Defaulted.
+    all_pairs_tiling(all_pairs_tiling &&) = default;                  //!< Defaulted.
+    all_pairs_tiling & operator=(all_pairs_tiling const &) = default; //!< Defaulted.
+    all_pairs_tiling & operator=(all_pairs_tiling &&) = default;      //!< Defaulted.
+    ~all_pairs_tiling() = default;                                    //!< Defaulted.
+
+    /*!\brief Constructs the tiling of the given number of sequences.
+     * \param[in] sequence_count The number of sequences.
+     * \param[in] tile_size      The number of sequences per side of a tile; must be greater than 0.
+     */
+    all_pairs_tiling(size_t const sequence_count, size_t const tile_size) :
+        sequence_count{sequence_count},
+        tile_size{tile_size}
+    {
+        assert(tile_size > 0u);
+
+        size_t const tiles_per_side = (sequence_count + tile_size - 1u) / tile_size;
+        row_offsets.reserve(tiles_per_side + 1u);
+        row_offsets.push_back(0u);
+        for (size_t row = 0; row < tiles_per_side; ++row)
+            row_offsets.push_back(row_offsets.back() + tiles_per_side - row);
+    }
+    //!\}
+
+    //!\brief Returns the number of tiles.
+    size_t size() const noexcept
+    {
+        return row_offsets.back();
+    }
+
+    //!\brief Returns the tile with the given number.
+    tile operator[](size_t const index) const noexcept
+    {
+        assert(index < size());
+
+        size_t const row = std::ranges::upper_bound(row_offsets, index) - row_offsets.begin() - 1;
+        size_t const column = row + index - row_offsets[row];
+
+        return tile{row * tile_size,
+                    std::min((row + 1u) * tile_size, sequence_count),
+                    column * tile_size,
+                    std::min((column + 1u) * tile_size, sequence_count)};
+    }
+
+    /*!\brief Selects the tile size for the given sequences.
+     * \param[in] sequence_count The number of sequences.
+     * \param[in] sequence_bytes The memory of all sequences in bytes.
+     * \param[in] thread_count   The number of threads that process the tiles.
+     * \returns The number of sequences per side of a tile.
+     *
+     * \details
+     *
+     * The sequences of a tile should fit into the level two cache of a core, such that they are only loaded once per
+     * tile. The tiles are made smaller if there would not be enough of them to keep every thread busy.
+     */
+    static size_t tile_size_for(size_t const sequence_count, size_t const sequence_bytes, size_t const thread_count)
+    {
+        constexpr size_t cache_bytes = 256u * 1024u;
+
+        size_t const bytes_per_sequence = std::max<size_t>(sequence_bytes / std::max<size_t>(sequence_count, 1u), 1u);
+        size_t tile_size = std::clamp<size_t>(cache_bytes / (2u * bytes_per_sequence), 1u, 1024u);
+
+        while (tile_size > 1u && all_pairs_tiling{sequence_count, tile_size}.size() < 8u * thread_count)
+            tile_size /= 2u;
+
+        return tile_size;
+    }
+
+private:
+    //!\brief The number of sequences.
+    size_t sequence_count{};
+    //!\brief The number of sequences per side of a tile.
+    size_t tile_size{1u};
+    //!\brief The number of the first tile of every row of tiles, followed by the total number of tiles.
+    std::vector<size_t> row_offsets{0u};
+};
+
+/*!\brief An upper bound of the score of every alignment between two sequences of the given lengths.
+ * \ingroup pairwise_alignment
+ * \tparam config_t The type of the alignment configuration.
+ * \param[in] config          The alignment configuration.
+ * \param[in] first_length    The length of the first sequence.
+ * \param[in] second_length   The length of the second sequence.
+ * \param[in] max_match_score The maximal score of two aligned symbols.
+ *
+ * \details
+ *
+ * At most `min(first_length, second_length)` columns can align two symbols. In a global alignment without free end
+ * gaps, the remaining symbols of the longer sequence have to be aligned to gaps.
+ */
+template <typename config_t>
+double all_pairs_score_bound(config_t const & config,
+                             size_t const first_length,
+                             size_t const second_length,
+                             double const max_match_score)
+{
+    size_t const shorter_length = std::min(first_length, second_length);
+    double bound = shorter_length * std::max(max_match_score, 0.0);
+
+    if constexpr (config_t::template exists<align_cfg::mode<global_alignment_type>>())
+    {
+        auto const & gaps = config.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}});
+        auto const aligned_ends = config.template value_or<align_cfg::aligned_ends>(free_ends_none);
+
+        bool has_free_ends = false;
+        for (size_t i = 0; i < 4u; ++i)
+            has_free_ends |= aligned_ends[i];
+
+        if (!has_free_ends)
+            bound += gaps.score(std::max(first_length, second_length) - shorter_length);
+    }
+
+    return bound;
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Computes the alignments of all pairs of distinct sequences of a collection.
+ * \ingroup pairwise_alignment
+ * \tparam sequences_t        The type of the sequence collection; must model std::ranges::random_access_range and
+ *                            std::ranges::sized_range.
+ * \tparam alignment_config_t The type of the alignment configuration; must be a seqan3::configuration.
+ * \tparam callback_t         The type of the callback.
+ * \param[in] sequences The sequences to align.
+ * \param[in] config    The object storing the alignment configuration.
+ * \param[in] callback  Invoked with the index of the first sequence (`size_t`), the index of the second sequence
+ *                      (`size_t`) and the seqan3::alignment_result of every aligned pair.
+ *
+ * \throws seqan3::invalid_alignment_configuration if the configuration is invalid.
+ *
+ * \details
+ *
+ * Computes the same alignments as
+ * `seqan3::align_pairwise(seqan3::views::pairwise_combine(sequences), config)`, i.e. the alignments of
+ * `sequences[i]` and `sequences[j]` for all `i < j`. Instead of walking the pairs row by row, the upper triangle is
+ * divided into tiles of pairs (see seqan3::detail::all_pairs_tiling) whose sequences fit into the cache. Every thread
+ * takes the next tile that is not yet computed, which balances the smaller tiles on the diagonal.
+ * Within a tile, the pairs are computed column by column, such that consecutive pairs share the second sequence. Its
+ * preprocessing, e.g. the bit masks of the edit distance or the simd representation of a vectorised alignment, is
+ * thus only computed once per column of the tile.
+ *
+ * If seqan3::align_cfg::parallel is given, the tiles are computed by the configured number of threads, which also
+ * invoke the callback concurrently. Otherwise the tiles are computed by the calling thread.
+ * seqan3::align_cfg::thread_pool is not supported.
+ *
+ * The pairs are reported in no particular order; the `id()` of the alignment result is not meaningful. If
+ * seqan3::align_cfg::min_score is given, only pairs reaching the score are reported. Pairs that cannot reach it,
+ * because their lengths differ too much for a global alignment or because they are too short, are skipped without
+ * computing their alignment. The other pairs are computed with the pruning of seqan3::align_cfg::min_score.
+ *
+ * \include test/snippet/alignment/pairwise/align_all_pairs.cpp
+ *
+ * ### Exception
+ *
+ * Basic exception guarantee. An exception thrown by the callback stops the computation of all threads and is
+ * rethrown by this function.
+ */
+template <std::ranges::random_access_range sequences_t, typename alignment_config_t, typename callback_t>
+//!\cond
+    requires std::ranges::sized_range<sequences_t> &&
+             detail::is_type_specialisation_of_v<alignment_config_t, configuration>
+//!\endcond
+void align_all_pairs(sequences_t && sequences, alignment_config_t const & config, callback_t && callback)
+{
+    using sequence_t = std::ranges::range_reference_t<sequences_t>;
+    using alphabet_t = std::ranges::range_value_t<sequence_t>;
+    using sequence_pairs_t = std::vector<std::tuple<sequence_t, sequence_t>>;
+
+    auto configured = detail::alignment_configurator::configure<sequence_pairs_t &>(config);
+    auto const & adapted_config = configured.second;
+
+    using traits_t = detail::alignment_configuration_traits<remove_cvref_t<decltype(adapted_config)>>;
+
+    static_assert(!traits_t::uses_thread_pool, "align_all_pairs does not support align_cfg::thread_pool.");
+
+    std::optional<int32_t> min_score{};
+    if constexpr (alignment_config_t::template exists<align_cfg::min_score>())
+        min_score = get<align_cfg::min_score>(config).value;
+
+    size_t thread_count = 1u;
+    if constexpr (traits_t::is_parallel)
+    {
+        thread_count = get<align_cfg::parallel>(adapted_config).value;
+        if (thread_count == 0u)
+            throw invalid_alignment_configuration{"The number of threads of align_cfg::parallel must be greater "
+                                                  "than 0."};
+    }
+
+    size_t chunk_size = traits_t::alignments_per_chunk;
+    if constexpr (traits_t::is_length_binned)
+        chunk_size *= (get<align_cfg::length_binning>(adapted_config).value + chunk_size - 1) / chunk_size;
+
+    // The best score of two aligned symbols is needed to skip the pairs that cannot reach the minimal score.
+    double max_match_score = 0.0;
+    if (min_score.has_value())
+    {
+        auto const & scoring_scheme = get<align_cfg::scoring>(adapted_config).value;
+        max_match_score = std::numeric_limits<double>::lowest();
+        for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+        {
+            for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+            {
+                max_match_score = std::max<double>(max_match_score,
+                                                   scoring_scheme.score(assign_rank_to(rank1, alphabet_t{}),
+                                                                        assign_rank_to(rank2, alphabet_t{})));
+            }
+        }
+    }
+
+    size_t const sequence_count = std::ranges::size(sequences);
+    size_t sequence_bytes = 0u;
+    for (auto && sequence : sequences)
+        sequence_bytes += std::ranges::size(sequence) * sizeof(alphabet_t);
+
+    detail::all_pairs_tiling const tiling{sequence_count,
+                                          detail::all_pairs_tiling::tile_size_for(sequence_count,
+                                                                                  sequence_bytes,
+                                                                                  thread_count)};
+
+    std::atomic<size_t> next_tile{0u};
+    std::atomic<bool> has_failed{false};
+    std::exception_ptr failure{};
+    std::mutex failure_mutex{};
+
+    auto sequences_begin = std::ranges::begin(sequences);
+
+    // Every thread owns a copy of the algorithm, including the preprocessing of the last second sequence.
+    auto compute_tiles = [&, algorithm = configured.first] () mutable
+    {
+        sequence_pairs_t sequence_pairs{};
+        std::vector<size_t> first_indices{};
+
+        try
+        {
+            for (size_t tile_index = next_tile++; tile_index < tiling.size() && !has_failed; tile_index = next_tile++)
+            {
+                auto const tile = tiling[tile_index];
+
+                for (size_t second = tile.second_begin; second < tile.second_end; ++second)
+                {
+                    sequence_pairs.clear();
+                    first_indices.clear();
+
+                    for (size_t first = tile.first_begin; first < std::min(tile.first_end, second); ++first)
+                    {
+                        if (min_score.has_value() &&
+                            detail::all_pairs_score_bound(adapted_config,
+                                                          std::ranges::size(sequences_begin[first]),
+                                                          std::ranges::size(sequences_begin[second]),
+                                                          max_match_score) < *min_score)
+                        {
+                            continue;
+                        }
+
+                        sequence_pairs.emplace_back(sequences_begin[first], sequences_begin[second]);
+                        first_indices.push_back(first);
+                    }
+
+                    for (auto && chunk : views::zip(sequence_pairs, std::views::iota(0)) | views::chunk(chunk_size))
+                    {
+                        for (auto && result : algorithm(chunk))
+                        {
+                            if (!min_score.has_value() || result.score() >= *min_score)
+                                std::invoke(callback, first_indices[result.id()], second, std::move(result));
+                        }
+                    }
+                }
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard lock{failure_mutex};
+            if (!has_failed.exchange(true))
+                failure = std::current_exception();
+        }
+    };
+
+    if (thread_count == 1u)
+    {
+        compute_tiles();
+    }
+    else
+    {
+        std::vector<std::thread> threads{};
+        threads.reserve(thread_count);
+        for (size_t thread_index = 0; thread_index < thread_count; ++thread_index)
+            threads.emplace_back(compute_tiles);
+
+        for (std::thread & thread : threads)
+            thread.join();
+    }
+
+    if (failure)
+        std::rethrow_exception(failure);
+}
+
+} // namespace seqan3
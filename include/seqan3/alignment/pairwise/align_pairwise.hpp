@@ -14,12 +14,14 @@
 
 #include <functional>
 #include <iostream>
+#include <stdexcept>
 #include <tuple>
 #include <type_traits>
 
 #include <meta/meta.hpp>
 
 #include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/exception.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
 #include <seqan3/alignment/pairwise/alignment_configurator.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
@@ -27,6 +29,7 @@
 #include <seqan3/alignment/pairwise/execution/all.hpp>
 #include <seqan3/core/algorithm/all.hpp>
 #include <seqan3/core/parallel/execution.hpp>
+#include <seqan3/core/parallel/thread_pool.hpp>
 #include <seqan3/core/simd/simd_traits.hpp>
 #include <seqan3/core/simd/simd.hpp>
 #include <seqan3/core/type_traits/basic.hpp>
@@ -70,14 +73,21 @@ namespace seqan3
  * alignments and then computes the alignments sequentially or in parallel depending on the given configuration.
  * Since there is always a certain amount of initial setup involving runtime checks required, it is advisable to pass
  * many sequence-pairs to this algorithm instead of repeatedly calling it with a single pair.
+ * If the function is nevertheless called many times in parallel mode, a persistent seqan3::thread_pool can be passed
+ * with seqan3::align_cfg::thread_pool to avoid spawning new threads on every call.
  *
  * ### Accessing the alignment results
  *
  * For each sequence pair one or more \ref seqan3::alignment_result "seqan3::alignment_result"s can be computed.
  * The seqan3::align_pairwise function returns an seqan3::alignment_range which can be used to iterate over the
  * alignments. If the `vectorise` configurations are omitted the alignments are computed on-demand when iterating over
- * the results. In case of a parallel execution all alignments are computed at once in parallel when calling `begin` on
- * the associated seqan3::alignment_range.
+ * the results. In case of a parallel execution the alignments are computed in parallel in windows of a bounded size.
+ * The first window is computed when calling `begin` on the associated seqan3::alignment_range and every following
+ * window is computed in the background while the results of the previous one are consumed. Thus, the memory for the
+ * results does not grow with the number of sequence pairs and the results are still returned in input order.
+ * The range over the sequence pairs can be single-pass, e.g. a view over a seqan3::sequence_file_input. Then, the
+ * sequence pairs of every window are buffered and the alignments of a result refer to these buffered sequences, which
+ * are only valid until the first result of the next window is requested.
  *
  * The following snippets demonstrate the single element and the range based interface.
  *
@@ -178,14 +188,100 @@ constexpr auto align_pairwise(sequence_t && sequences,
             return seqan3::seq;
     };
 
-    // Create a two-way executor for the alignment.
-    detail::alignment_executor_two_way executor{std::move(seq_view),
-                                                std::move(algorithm),
-                                                traits_t::alignments_per_vector,
-                                                get_execution_rule()};
-    // Return the range over the alignments.
-    return alignment_range{std::move(executor)};
+    // Buffer whole windows of sequence pairs if they are sorted by length, rounded up to the default chunk size.
+    size_t chunk_size = traits_t::alignments_per_chunk;
+    if constexpr (traits_t::is_length_binned)
+        chunk_size *= (get<align_cfg::length_binning>(adapted_config).value + chunk_size - 1) / chunk_size;
+
+    if constexpr (traits_t::uses_thread_pool)
+    {
+        seqan3::thread_pool * pool = get<align_cfg::thread_pool>(adapted_config).value;
+        if (pool == nullptr)
+            throw invalid_alignment_configuration{"The align_cfg::thread_pool must not be a nullptr."};
+
+        // Submit the alignments to the persistent thread pool instead of spawning new threads.
+        detail::execution_handler_thread_pool handler{*pool};
+        detail::alignment_executor_two_way executor{std::move(seq_view),
+                                                    std::move(algorithm),
+                                                    chunk_size,
+                                                    std::move(handler)};
+        return alignment_range{std::move(executor)};
+    }
+    else
+    {
+        // Create a two-way executor for the alignment.
+        detail::alignment_executor_two_way executor{std::move(seq_view),
+                                                    std::move(algorithm),
+                                                    chunk_size,
+                                                    get_execution_rule()};
+        // Return the range over the alignments.
+        return alignment_range{std::move(executor)};
+    }
 }
 //!\endcond
 
+/*!\brief Computes the pairwise alignments for a range over sequence pairs and writes the results into a buffer.
+ * \ingroup pairwise_alignment
+ * \tparam sequence_t         The type of the range over sequence pairs; must model
+ *                            seqan3::detail::align_pairwise_range_input.
+ * \tparam alignment_config_t The type of the alignment configuration; must be a seqan3::configuration.
+ * \tparam result_buffer_t    The type of the buffer; must model std::ranges::forward_range and its elements must be
+ *                            assignable from the alignment results.
+ * \param[in]  sequences      The range over sequence pairs.
+ * \param[in]  config         The object storing the alignment configuration.
+ * \param[out] results        The buffer to store the results in, one element per sequence pair.
+ * \returns The number of results written into `results`.
+ *
+ * \throws std::invalid_argument if `results` is smaller than `sequences` or seqan3::invalid_alignment_configuration if
+ *         the configuration is invalid. Might throw std::bad_alloc if it fails to allocate the alignment matrix.
+ *
+ * \details
+ *
+ * Unlike the overload returning a seqan3::alignment_range, the alignment algorithm is not type-erased and the results
+ * are not collected per chunk, such that the computation of many short sequence pairs can be fully inlined.
+ * Instead, the algorithm type is resolved entirely from the type of the configuration. Thus, all
+ * seqan3::align_cfg::aligned_ends settings must be known at compile time, the alignments are computed sequentially
+ * with the scalar algorithm and seqan3::align_cfg::max_error cannot be used. The specialised edit distance
+ * algorithm is never selected, since this depends on the values of the configured scores.
+ *
+ * The element type of the buffer is the value type of the seqan3::alignment_range that the other overload returns for
+ * the same arguments:
+ *
+ * \include test/snippet/alignment/pairwise/align_pairwise_into_buffer.cpp
+ *
+ * ### Exception
+ *
+ * Basic exception guarantee.
+ *
+ * ### Thread safety
+ *
+ * Re-entrant.
+ */
+template <typename sequence_t, typename alignment_config_t, std::ranges::forward_range result_buffer_t>
+//!\cond
+    requires detail::align_pairwise_range_input<sequence_t> &&
+             detail::is_type_specialisation_of_v<alignment_config_t, configuration>
+//!\endcond
+size_t align_pairwise(sequence_t && sequences, alignment_config_t const & config, result_buffer_t && results)
+{
+    auto [algorithm, adapted_config] = detail::alignment_configurator::configure_statically<sequence_t>(config);
+    (void) adapted_config;
+
+    using std::get;
+
+    size_t count = 0;
+    auto result_it = std::ranges::begin(results);
+    for (auto && sequence_pair : sequences)
+    {
+        if (result_it == std::ranges::end(results))
+            throw std::invalid_argument{"The result buffer is smaller than the range over sequence pairs."};
+
+        *result_it = algorithm(count, get<0>(sequence_pair), get<1>(sequence_pair));
+        ++result_it;
+        ++count;
+    }
+
+    return count;
+}
+
 } // namespace seqan3
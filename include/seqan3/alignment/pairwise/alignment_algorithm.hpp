@@ -12,20 +12,35 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <type_traits>
+#include <vector>
 
+#include <seqan3/alignment/configuration/align_config_aligned_ends.hpp>
 #include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring.hpp>
 #include <seqan3/alignment/configuration/align_config_result.hpp>
+#include <seqan3/alignment/configuration/align_config_statistics.hpp>
+#include <seqan3/alignment/configuration/align_config_x_drop.hpp>
 #include <seqan3/alignment/exception.hpp>
 #include <seqan3/alignment/matrix/trace_directions.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/alignment_statistics.hpp>
+#include <seqan3/alignment/pairwise/detail/affine_gap_anti_diagonal_simd.hpp>
+#include <seqan3/alignment/pairwise/detail/affine_gap_linear_space_traceback.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/reuse_storage.hpp>
+#include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
 
+#include <seqan3/alphabet/concept.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/core/simd/concept.hpp>
 #include <seqan3/core/simd/simd.hpp>
@@ -36,6 +51,8 @@
 #include <seqan3/range/views/drop.hpp>
 #include <seqan3/range/views/get.hpp>
 #include <seqan3/range/views/take.hpp>
+#include <seqan3/range/views/zip.hpp>
+#include <seqan3/std/algorithm>
 #include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
 
@@ -102,6 +119,9 @@ private:
                                                   std::allocator<std::optional<trace_directions>>,
                                                   matrix_major_order::column>,
                            empty_type>;
+    //!\brief The type of the counters collected for seqan3::align_cfg::statistics.
+    using statistics_record_t =
+        std::conditional_t<traits_t::collects_statistics, alignment_statistics_record, empty_type>;
 
 public:
     /*!\name Constructors, destructor and assignment
@@ -126,6 +146,12 @@ public:
     {
         this->scoring_scheme = seqan3::get<align_cfg::scoring>(*cfg_ptr).value;
         this->initialise_alignment_state(*cfg_ptr);
+
+        if constexpr (traits_t::is_x_drop)
+            x_drop_score = seqan3::get<align_cfg::x_drop>(*cfg_ptr).value;
+
+        if constexpr (traits_t::uses_min_score)
+            initialise_min_score_bound(seqan3::get<align_cfg::min_score>(*cfg_ptr).value);
     }
     //!\}
 
@@ -172,6 +198,16 @@ public:
      * |space (end positions)   |\f$ O(m) \f$      |\f$ O(k) \f$       |
      * |space (begin positions) |\f$ O(n*m) \f$    |\f$ O(n*k) \f$     |
      * |space (alignment)       |\f$ O(n*m) \f$    |\f$ O(n*k) \f$     |
+     *
+     * If the unbanded matrix of a sequence pair has more than #linear_space_traceback_min_matrix_size cells, the
+     * begin positions and the alignment are computed with seqan3::detail::affine_gap_linear_space_traceback in
+     * \f$ O(n+m) \f$ space instead (except in debug mode).
+     *
+     * If seqan3::align_cfg::x_drop or seqan3::align_cfg::min_score is configured without a band, only the cells that
+     * are not dropped and the cells directly below or to the right of them are computed.
+     *
+     * If seqan3::align_cfg::statistics is configured, the counters of all sequence pairs of the given range are added
+     * to the configured seqan3::alignment_statistics after the last pair was computed.
      */
     template <indexed_sequence_pair_range indexed_sequence_pairs_t>
     //!\cond
@@ -186,14 +222,55 @@ public:
 
         using std::get;
 
+        reuse_storage_allocation_counter const allocation_counter{statistics_allocations()};
         std::vector<alignment_result<result_t>> results{};
         for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
             results.emplace_back(compute_single_pair(idx, get<0>(sequence_pair), get<1>(sequence_pair)));
 
+        flush_statistics(results.size());
         return results;
     }
 
-    //!\overload
+    /*!\overload
+     *
+     * \param[in] idx       The index of the sequence pair.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \returns The seqan3::alignment_result of the single sequence pair.
+     *
+     * \details
+     *
+     * Computes a single sequence pair without collecting the result in a std::vector. This is used by the statically
+     * dispatched seqan3::align_pairwise, which writes the results into a buffer of the caller.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+    //!\cond
+        requires !traits_t::is_vectorised
+    //!\endcond
+    auto operator()(size_t const idx, sequence1_t & sequence1, sequence2_t & sequence2)
+    {
+        reuse_storage_allocation_counter const allocation_counter{statistics_allocations()};
+        alignment_result result{compute_single_pair(idx, sequence1, sequence2)};
+        flush_statistics(1u);
+        return result;
+    }
+
+    /*!\overload
+     *
+     * \details
+     *
+     * If the chunk is too small to fill at least half of the simd vector and every sequence pair is long enough, the
+     * sequence pairs are computed one after another with seqan3::detail::affine_gap_anti_diagonal_simd, which uses
+     * the whole simd vector for a single sequence pair. This requires that only the score or the back coordinate is
+     * requested.
+     *
+     * If seqan3::align_cfg::band is configured, every sequence pair is sliced as in the scalar banded alignment
+     * (see seqan3::detail::alignment_matrix_policy::slice_sequences). The slices of all pairs begin at the same
+     * positions, hence all lanes share the same band and only \f$ O(n*k) \f$ cells are computed for the batch, where
+     * \f$ n \f$ is the size of the longest slice of the first sequences and \f$ k \f$ the size of the band. The
+     * vectorised banded alignment only computes the score and the back coordinate.
+     */
     template <indexed_sequence_pair_range indexed_sequence_pairs_t>
     auto operator()(indexed_sequence_pairs_t && indexed_sequence_pairs)
     //!\cond
@@ -205,34 +282,128 @@ public:
         static_assert(simd_concept<typename traits_t::score_t>, "Expected simd score type.");
         static_assert(simd_concept<typename traits_t::trace_t>, "Expected simd trace type.");
 
+        reuse_storage_allocation_counter const allocation_counter{statistics_allocations()};
+
+        if constexpr (supports_anti_diagonal_vectorisation)
+        {
+            if (prefers_anti_diagonal_vectorisation(indexed_sequence_pairs))
+            {
+                auto results = compute_anti_diagonal_vectorised(indexed_sequence_pairs);
+                flush_statistics(results.size());
+                return results;
+            }
+        }
+
         // Extract the batch of sequences for the first and the second sequence.
         auto sequence1_range = indexed_sequence_pairs | views::get<0> | views::get<0>;
         auto sequence2_range = indexed_sequence_pairs | views::get<0> | views::get<1>;
 
+        if constexpr (traits_t::is_banded)
+        {
+            static_assert(traits_t::result_type_rank < with_front_coordinate_type::rank,
+                          "The vectorised banded alignment can only compute the score and the back coordinate.");
+
+            auto const & band = seqan3::get<align_cfg::band>(*cfg_ptr).value;
+            auto [sliced_sequences1, sliced_sequences2] = slice_batch_of_sequences(sequence1_range,
+                                                                                   sequence2_range,
+                                                                                   band);
+            compute_batch(sliced_sequences1, sliced_sequences2, band);
+        }
+        else
+        {
+            compute_batch(sequence1_range, sequence2_range);
+        }
+
+        auto results = make_alignment_result(indexed_sequence_pairs);
+        flush_statistics(results.size());
+        return results;
+    }
+    //!\}
+
+private:
+    /*!\brief Computes the alignment matrix of a batch of sequence pairs with the inter-sequence vectorisation.
+     * \tparam sequence1_range_t The type of the range over the first sequences; must model std::ranges::forward_range.
+     * \tparam sequence2_range_t The type of the range over the second sequences; must model std::ranges::forward_range.
+     * \tparam band_t The type of the band; only given for the banded alignment.
+     *
+     * \param[in] sequence1_range The first sequences of the batch.
+     * \param[in] sequence2_range The second sequences of the batch.
+     * \param[in] band The seqan3::static_band shared by all sequence pairs; only given for the banded alignment.
+     */
+    template <typename sequence1_range_t, typename sequence2_range_t, typename ...band_t>
+    void compute_batch(sequence1_range_t & sequence1_range, sequence2_range_t & sequence2_range, band_t const & ...band)
+    {
         // Initialise the find_optimum policy in the simd case.
         this->initialise_find_optimum_policy(sequence1_range,
                                              sequence2_range,
                                              this->scoring_scheme.padding_match_score());
 
         // Convert batch of sequences to sequence of simd vectors.
-        auto simd_sequences1 = convert_batch_of_sequences_to_simd_vector(sequence1_range);
-        auto simd_sequences2 = convert_batch_of_sequences_to_simd_vector(sequence2_range);
+        bool const is_uniform_batch1 = is_uniform_batch(sequence1_range);
+        auto simd_sequences1 = convert_batch_of_sequences_to_simd_vector(sequence1_range, is_uniform_batch1);
+        auto simd_sequences2 = convert_batch_of_sequences_to_simd_vector(sequence2_range,
+                                                                         is_uniform_batch(sequence2_range));
+        // The columns of a first sequence that is shared by all lanes are scored with precomputed profiles.
+        this->profiles_symbols = is_uniform_batch1;
+        count_statistics_simd_lanes(sequence1_range, simd_sequences1.size());
+        count_statistics_simd_lanes(sequence2_range, simd_sequences2.size());
 
         max_size_in_collection = std::pair{simd_sequences1.size(), simd_sequences2.size()};
         // Reset the alignment state's optimum between executions of the alignment algorithm.
         this->alignment_state.reset_optimum();
 
-        compute_matrix(simd_sequences1, simd_sequences2);
+        compute_matrix(simd_sequences1, simd_sequences2, band...);
+    }
+
+    /*!\brief Slices every sequence pair of the batch according to the band.
+     * \tparam sequence1_range_t The type of the range over the first sequences; must model std::ranges::forward_range.
+     * \tparam sequence2_range_t The type of the range over the second sequences; must model std::ranges::forward_range.
+     *
+     * \param[in] sequence1_range The first sequences of the batch.
+     * \param[in] sequence2_range The second sequences of the batch.
+     * \param[in] band The seqan3::static_band shared by all sequence pairs.
+     *
+     * \returns A std::pair over two std::vector with the sliced first and second sequences.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band excludes the alignment matrix of any sequence pair.
+     *
+     * \details
+     *
+     * The sequences are sliced with seqan3::detail::alignment_matrix_policy::slice_sequences, whose begin positions
+     * only depend on the band. Hence, the band has the same position in the matrix of every sequence pair and the
+     * sliced pairs can be computed within one banded simd matrix. The end positions differ between the pairs and
+     * are handled like different sequence sizes in the unbanded case.
+     */
+    template <typename sequence1_range_t, typename sequence2_range_t>
+    auto slice_batch_of_sequences(sequence1_range_t & sequence1_range,
+                                  sequence2_range_t & sequence2_range,
+                                  static_band const & band)
+    {
+        using sequence1_t = std::ranges::range_reference_t<sequence1_range_t>;
+        using sequence2_t = std::ranges::range_reference_t<sequence2_range_t>;
+        using sliced_sequences_t = decltype(this->slice_sequences(std::declval<sequence1_t &>(),
+                                                                  std::declval<sequence2_t &>(),
+                                                                  band));
+
+        std::vector<std::tuple_element_t<0, sliced_sequences_t>> sliced_sequences1{};
+        std::vector<std::tuple_element_t<1, sliced_sequences_t>> sliced_sequences2{};
+
+        for (auto && [sequence1, sequence2] : views::zip(sequence1_range, sequence2_range))
+        {
+            check_valid_band_parameter(sequence1, sequence2, band);
+            auto && [subsequence1, subsequence2] = this->slice_sequences(sequence1, sequence2, band);
+            sliced_sequences1.push_back(std::move(subsequence1));
+            sliced_sequences2.push_back(std::move(subsequence2));
+        }
 
-        return make_alignment_result(indexed_sequence_pairs);
+        return std::pair{std::move(sliced_sequences1), std::move(sliced_sequences2)};
     }
-    //!\}
 
-private:
     /*!\brief Converts a batch of sequences to a sequence of simd vectors.
      * \tparam sequence_range_t The type of the range over sequences; must model std::ranges::forward_range.
      *
-     * \param[in] sequences The batch of sequences to transform.
+     * \param[in] sequences  The batch of sequences to transform.
+     * \param[in] is_uniform Whether the batch is full and consists of the same sequence (see #is_uniform_batch).
      *
      * \returns a sequence over simd vectors.
      *
@@ -241,9 +412,12 @@ private:
      * Expects that the size of the batch is less or equal than the number of alignments that can be computed within one
      * simd vector. Applies an Array-of-Structures (AoS) to Structure-of-Arrays (SoA) transformation by storing one
      * column of the batch as a simd vector.
+     *
+     * If the batch is full and consists of the same sequence in every lane, e.g. if one query is aligned against many
+     * targets, the transformation is skipped and every symbol of this sequence is broadcast to a simd vector.
      */
     template <typename sequence_range_t>
-    constexpr auto convert_batch_of_sequences_to_simd_vector(sequence_range_t & sequences)
+    constexpr auto convert_batch_of_sequences_to_simd_vector(sequence_range_t & sequences, bool const is_uniform)
     {
         assert(static_cast<size_t>(std::ranges::distance(sequences)) <= traits_t::alignments_per_vector);
 
@@ -251,6 +425,14 @@ private:
 
         std::vector<simd_score_t, aligned_allocator<simd_score_t, alignof(simd_score_t)>> simd_sequence{};
 
+        if (is_uniform)
+        {
+            for (auto && symbol : *std::ranges::begin(sequences))
+                simd_sequence.push_back(simd::fill<simd_score_t>(seqan3::to_rank(symbol)));
+
+            return simd_sequence;
+        }
+
         for (auto && simd_vector_chunk : sequences | views::to_simd<simd_score_t>(traits_t::padding_symbol))
             for (auto && simd_vector : simd_vector_chunk)
                 simd_sequence.push_back(std::move(simd_vector));
@@ -258,6 +440,141 @@ private:
         return simd_sequence;
     }
 
+    /*!\brief Checks whether the batch fills every lane of the simd vector with the same sequence.
+     * \tparam sequence_range_t The type of the range over sequences; must model std::ranges::forward_range.
+     * \param[in] sequences The batch of sequences to check.
+     * \returns `true` if the batch is full and all sequences are equal, otherwise `false`.
+     */
+    template <typename sequence_range_t>
+    static bool is_uniform_batch(sequence_range_t & sequences)
+    {
+        if (static_cast<size_t>(std::ranges::distance(sequences)) != traits_t::alignments_per_vector)
+            return false;
+
+        auto sequence_it = std::ranges::begin(sequences);
+        auto && first_sequence = *sequence_it;
+        for (++sequence_it; sequence_it != std::ranges::end(sequences); ++sequence_it)
+        {
+            // Sequences of different pairs usually differ within the first few symbols.
+            if (!std::ranges::equal(*sequence_it, first_sequence))
+                return false;
+        }
+
+        return true;
+    }
+
+    /*!\brief Creates the algorithm that computes a single sequence pair with simd vectors along the anti-diagonals.
+     * \returns A seqan3::detail::affine_gap_anti_diagonal_simd with the configured gap scores and free end gaps.
+     */
+    auto make_anti_diagonal_algorithm() const
+    {
+        auto const align_ends_cfg = cfg_ptr->template value_or<align_cfg::aligned_ends>(free_ends_none);
+
+        return affine_gap_anti_diagonal_simd<typename traits_t::score_t, traits_t::is_local>
+        {
+            this->alignment_state.gap_open_score[0],
+            this->alignment_state.gap_extension_score[0],
+            {align_ends_cfg[0], align_ends_cfg[1], align_ends_cfg[2], align_ends_cfg[3]}
+        };
+    }
+
+    /*!\brief Decides whether the given chunk is computed with seqan3::detail::affine_gap_anti_diagonal_simd.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs.
+     * \param[in] indexed_sequence_pairs The chunk of indexed sequence pairs to be aligned.
+     *
+     * \details
+     *
+     * The inter-sequence vectorisation wastes the lanes that are not filled by a sequence pair, whereas the
+     * anti-diagonal vectorisation only wastes lanes at the corners of the matrix. Hence, the anti-diagonal version is
+     * used if less than half of the lanes are filled and the shorter sequence of every pair spans at least
+     * #anti_diagonal_min_sequence_size cells. In addition, the scores of every pair must not overflow the score type
+     * (see seqan3::detail::affine_gap_anti_diagonal_simd::is_representable).
+     */
+    template <typename indexed_sequence_pairs_t>
+    bool prefers_anti_diagonal_vectorisation(indexed_sequence_pairs_t && indexed_sequence_pairs) const
+    {
+        using std::get;
+        using simd_score_t = typename traits_t::score_t;
+
+        if (static_cast<size_t>(std::ranges::distance(indexed_sequence_pairs)) * 2u > traits_t::alignments_per_vector)
+            return false;
+
+        auto const anti_diagonal_algorithm = make_anti_diagonal_algorithm();
+
+        // The scoring scheme might be a substitution matrix, so every pair of symbols is checked.
+        using scalar_score_t = typename simd_traits<simd_score_t>::scalar_type;
+        scalar_score_t max_match_score = 0;
+        for (size_t rank1 = 0; rank1 < alphabet_size<typename traits_t::scoring_scheme_alphabet_t>; ++rank1)
+        {
+            for (size_t rank2 = 0; rank2 < alphabet_size<typename traits_t::scoring_scheme_alphabet_t>; ++rank2)
+            {
+                auto const score = this->scoring_scheme.score(simd::fill<simd_score_t>(rank1),
+                                                              simd::fill<simd_score_t>(rank2));
+                max_match_score = std::max(max_match_score, static_cast<scalar_score_t>(std::abs(score[0])));
+            }
+        }
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            (void) idx;
+            size_t const size1 = std::ranges::distance(get<0>(sequence_pair));
+            size_t const size2 = std::ranges::distance(get<1>(sequence_pair));
+
+            if (std::min(size1, size2) < anti_diagonal_min_sequence_size ||
+                !anti_diagonal_algorithm.is_representable(size1, size2, max_match_score))
+                return false;
+        }
+
+        return true;
+    }
+
+    /*!\brief Computes every sequence pair of the chunk with seqan3::detail::affine_gap_anti_diagonal_simd.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs.
+     * \param[in] indexed_sequence_pairs The chunk of indexed sequence pairs to be aligned.
+     * \returns A std::vector over seqan3::alignment_result with the score and if requested the back coordinate.
+     */
+    template <typename indexed_sequence_pairs_t>
+    auto compute_anti_diagonal_vectorised(indexed_sequence_pairs_t && indexed_sequence_pairs)
+    {
+        using std::get;
+        using indexed_sequence_pair_t = std::ranges::range_value_t<indexed_sequence_pairs_t>;
+        using sequence_pair_t = std::tuple_element_t<0, indexed_sequence_pair_t>;
+        using sequence1_t = std::tuple_element_t<0, sequence_pair_t>;
+        using sequence2_t = std::tuple_element_t<1, sequence_pair_t>;
+        using result_value_t = typename align_result_selector<sequence1_t, sequence2_t, config_t>::type;
+
+        auto anti_diagonal_algorithm = make_anti_diagonal_algorithm();
+
+        std::vector<alignment_result<result_value_t>> results{};
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            auto const fill_start = start_statistics_phase();
+            auto const optimum = anti_diagonal_algorithm(get<0>(sequence_pair),
+                                                         get<1>(sequence_pair),
+                                                         this->scoring_scheme);
+            finish_statistics_phase(&alignment_statistics_record::fill_time, fill_start);
+
+            // The whole simd vector is used for a single matrix, hence the scalar cells are counted.
+            if constexpr (traits_t::collects_statistics)
+                statistics_record.cells += (std::ranges::distance(get<0>(sequence_pair)) + 1) *
+                                           (std::ranges::distance(get<1>(sequence_pair)) + 1);
+
+            result_value_t res{};
+            res.id = idx;
+            res.score = optimum.score;
+
+            if constexpr (traits_t::result_type_rank >= 1)  // compute back coordinate
+            {
+                res.back_coordinate.first = optimum.column_index;
+                res.back_coordinate.second = optimum.row_index;
+            }
+
+            results.emplace_back(std::move(res));
+        }
+
+        return results;
+    }
+
     /*!\brief Computes the pairwise sequence alignment for a single pair of sequences.
      * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
      * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
@@ -298,11 +615,76 @@ private:
         }
         else
         {
+            if constexpr (supports_linear_space_traceback)
+            {
+                size_t const matrix_size = (static_cast<size_t>(std::ranges::distance(sequence1)) + 1u) *
+                                           (static_cast<size_t>(std::ranges::distance(sequence2)) + 1u);
+
+                if (matrix_size > linear_space_traceback_min_matrix_size)
+                {
+                    count_statistics_cells(matrix_size);
+                    return compute_linear_space_traceback(idx, sequence1, sequence2);
+                }
+            }
+
             compute_matrix(sequence1, sequence2);
             return make_alignment_result(idx, sequence1, sequence2);
         }
     }
 
+    /*!\brief Computes the alignment of a single sequence pair with seqan3::detail::affine_gap_linear_space_traceback.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     *
+     * \param[in] idx The index of the current processed sequence pair.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \returns A seqan3::alignment_result with the requested alignment outcomes.
+     *
+     * \details
+     *
+     * Neither the score matrix nor the trace matrix is allocated. The trace path is computed in linear space and
+     * passed to the seqan3::detail::aligned_sequence_builder.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+    auto compute_linear_space_traceback(size_t const idx, sequence1_t & sequence1, sequence2_t & sequence2)
+    {
+        using result_value_t = typename align_result_selector<sequence1_t, sequence2_t, config_t>::type;
+
+        auto const align_ends_cfg = cfg_ptr->template value_or<align_cfg::aligned_ends>(free_ends_none);
+        affine_gap_linear_space_traceback<typename traits_t::score_t, traits_t::is_local> linear_space_algorithm
+        {
+            this->alignment_state.gap_open_score,
+            this->alignment_state.gap_extension_score,
+            {align_ends_cfg[0], align_ends_cfg[1], align_ends_cfg[2], align_ends_cfg[3]}
+        };
+
+        auto const fill_start = start_statistics_phase();
+        auto const linear_space_res = linear_space_algorithm(sequence1, sequence2, this->scoring_scheme);
+        finish_statistics_phase(&alignment_statistics_record::fill_time, fill_start);
+
+        auto const result_start = start_statistics_phase();
+        result_value_t res{};
+        res.id = idx;
+        res.score = linear_space_res.optimum.score;
+        res.back_coordinate = alignment_coordinate{column_index_type{linear_space_res.optimum.column_index},
+                                                   row_index_type{linear_space_res.optimum.row_index}};
+
+        auto const traceback_start = start_statistics_phase();
+        aligned_sequence_builder builder{sequence1, sequence2};
+        auto trace_res = builder(linear_space_res.trace_path());
+        auto const traceback_time = finish_traceback_statistics(traceback_start, trace_res);
+        res.front_coordinate.first = trace_res.first_sequence_slice_positions.first;
+        res.front_coordinate.second = trace_res.second_sequence_slice_positions.first;
+
+        if constexpr (traits_t::result_type_rank == 3) // compute alignment
+            res.alignment = std::move(trace_res.alignment);
+
+        finish_statistics_phase(&alignment_statistics_record::result_time, result_start, traceback_time);
+        return res;
+    }
+
     /*!\brief Checks if the band parameters are valid for the given sequences.
      * \tparam sequence1_t The type of the first sequence.
      * \tparam sequence2_t The type of the second sequence.
@@ -386,7 +768,9 @@ private:
         // Initialisation phase: allocate memory and initialise first column.
         // ----------------------------------------------------------------------------
 
+        auto const fill_start = start_statistics_phase();
         this->allocate_matrix(sequence1, sequence2);
+        initialise_last_cell_coordinate(sequence1, sequence2);
         initialise_first_alignment_column(sequence2);
 
         // ----------------------------------------------------------------------------
@@ -395,7 +779,14 @@ private:
 
         for (auto const & seq1_value : sequence1)
         {
-            compute_alignment_column<true>(seq1_value, sequence2);
+            if (all_cells_dropped()) // No alignment can pass the remaining columns.
+                break;
+
+            if constexpr (is_pruned)
+                compute_pruned_alignment_column(seq1_value, sequence2);
+            else
+                compute_alignment_column<true>(seq1_value, sequence2);
+
             finalise_last_cell_in_column(true);
         }
 
@@ -404,6 +795,7 @@ private:
         // ----------------------------------------------------------------------------
 
         finalise_alignment();
+        finish_statistics_phase(&alignment_statistics_record::fill_time, fill_start);
     }
 
     //!\overload
@@ -418,8 +810,14 @@ private:
         // ----------------------------------------------------------------------------
 
         // Allocate and initialise first column.
+        auto const fill_start = start_statistics_phase();
         this->allocate_matrix(sequence1, sequence2, band, this->alignment_state);
         size_t last_row_index = this->score_matrix.band_row_index;
+        initialise_last_cell_coordinate(sequence1, sequence2);
+
+        // The simd optimum is tracked in the coordinates of the outer matrix.
+        if constexpr (traits_t::is_vectorised)
+            this->band_column_index = this->score_matrix.band_col_index;
         initialise_first_alignment_column(sequence2 | views::take(last_row_index));
 
         // ----------------------------------------------------------------------------
@@ -429,6 +827,9 @@ private:
         size_t sequence2_size = std::ranges::distance(sequence2);
         for (auto const & seq1_value : sequence1 | views::take(this->score_matrix.band_col_index))
         {
+            if (all_cells_dropped()) // No alignment can pass the remaining columns.
+                break;
+
             compute_alignment_column<true>(seq1_value, sequence2 | views::take(++last_row_index));
             // Only if band reached last row of matrix the last cell might be tracked.
             finalise_last_cell_in_column(last_row_index >= sequence2_size);
@@ -441,6 +842,9 @@ private:
         size_t first_row_index = 0;
         for (auto const & seq1_value : sequence1 | views::drop(this->score_matrix.band_col_index))
         {
+            if (all_cells_dropped()) // No alignment can pass the remaining columns.
+                break;
+
             // In the second phase the band moves in every column one base down on the second sequence.
             compute_alignment_column<false>(seq1_value, sequence2 | views::slice(first_row_index++, ++last_row_index));
             // Only if band reached last row of matrix the last cell might be tracked.
@@ -452,6 +856,7 @@ private:
         // ----------------------------------------------------------------------------
 
         finalise_alignment();
+        finish_statistics_phase(&alignment_statistics_record::fill_time, fill_start);
     }
 
     /*!\brief Initialises the first column of the alignment matrix.
@@ -475,11 +880,18 @@ private:
 
         // Initialise first cell.
         alignment_column_it = alignment_column.begin();
+        reset_remaining_rows();
         this->init_origin_cell(*alignment_column_it, this->alignment_state);
+        prune_cell(*alignment_column_it, 0u);
 
         // Initialise the remaining cells of this column.
+        size_t row = 0;
         for (auto it = std::ranges::begin(sequence2); it != std::ranges::end(sequence2); ++it)
+        {
             this->init_column_cell(*++alignment_column_it, this->alignment_state);
+            prune_cell(*alignment_column_it, ++row);
+        }
+        count_statistics_cells(row + 1);
 
         // Finalise the last cell of the initial column.
         bool at_last_row = true;
@@ -512,6 +924,10 @@ private:
         alignment_column_it = alignment_column.begin();
 
         auto seq2_it = std::ranges::begin(sequence2);
+        reset_remaining_rows();
+
+        // The value of the first sequence is the same for all cells of this column.
+        auto const & seq1_profile = this->scoring_scheme_profile(seq1_value);
 
         if constexpr (initialise_first_cell) // Initialise first cell if it intersects with the first row of the matrix.
         {
@@ -521,14 +937,217 @@ private:
         {
             this->compute_first_band_cell(*alignment_column_it,
                                           this->alignment_state,
-                                          this->scoring_scheme.score(seq1_value, *seq2_it));
+                                          this->scoring_scheme.score(seq1_profile, *seq2_it));
             ++seq2_it;
         }
+        prune_cell(*alignment_column_it, 0u);
+
+        size_t row = 1;
+        for (; seq2_it != std::ranges::end(sequence2); ++seq2_it, ++row)
+        {
+            this->compute_cell(*++alignment_column_it,
+                               this->alignment_state,
+                               this->scoring_scheme.score(seq1_profile, *seq2_it));
+            prune_cell(*alignment_column_it, row);
+        }
+        count_statistics_cells(row);
+    }
+
+    /*!\brief Computes the rows of a single unbanded alignment column that can be reached from remaining cells.
+     * \tparam seq1_value_t The value type of the first sequence.
+     * \tparam sequence2_t The type of the second sequence.
+     *
+     * \param[in] seq1_value The current value of the first sequence for this alignment column.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \details
+     *
+     * Let `[first, end)` be the rows of the previous column that were not dropped (see #prune_cell). The cells above
+     * `first` can only be reached from dropped cells and are skipped; they still store the dropped scores of the
+     * previous column. Below `end` the column is continued only as long as the vertical gap starting in a remaining
+     * cell is not dropped. All other cells keep the dropped scores of the previous columns as well.
+     */
+    template <typename sequence1_value_t, typename sequence2_t>
+    void compute_pruned_alignment_column(sequence1_value_t const & seq1_value, sequence2_t && sequence2)
+    {
+        using std::get;
+
+        this->next_alignment_column();
+        alignment_column = this->current_alignment_column();
+        alignment_column_it = alignment_column.begin();
+
+        size_t const previous_first_row = first_remaining_row;
+        size_t const previous_end_row = end_remaining_row;
+        reset_remaining_rows();
+        auto const & seq1_profile = this->scoring_scheme_profile(seq1_value);
+
+        auto seq2_it = std::ranges::begin(sequence2);
+        size_t row = previous_first_row;
+
+        if (row == 0)
+        {
+            this->init_row_cell(*alignment_column_it, this->alignment_state);
+            prune_cell(*alignment_column_it, row++);
+        }
+        else
+        {
+            // The iterator must be incremented cell by cell to keep the cached diagonal of the score column.
+            for (size_t skipped_row = 1; skipped_row < row; ++skipped_row, ++seq2_it)
+                ++alignment_column_it;
+
+            // The cell above the first computed cell was dropped and cannot open a vertical gap.
+            get<0>(*alignment_column_it).up = dropped_score;
+        }
+
+        for (; seq2_it != std::ranges::end(sequence2); ++seq2_it, ++row)
+        {
+            if (row > previous_end_row && end_remaining_row != row) // The cell above was dropped or never computed.
+                break;
 
-        for (; seq2_it != std::ranges::end(sequence2); ++seq2_it)
             this->compute_cell(*++alignment_column_it,
                                this->alignment_state,
-                               this->scoring_scheme.score(seq1_value, *seq2_it));
+                               this->scoring_scheme.score(seq1_profile, *seq2_it));
+            prune_cell(*alignment_column_it, row);
+        }
+        count_statistics_cells(row - previous_first_row);
+    }
+
+    /*!\brief Drops the given cell if it is pruned by seqan3::align_cfg::x_drop or seqan3::align_cfg::min_score.
+     * \tparam cell_t The type of the alignment matrix cell.
+     *
+     * \param[in,out] cell The cell that was computed last.
+     * \param[in] row The position of the cell within the current column.
+     *
+     * \details
+     *
+     * A cell is dropped if its score is more than seqan3::align_cfg::x_drop below the current optimum (see
+     * #exceeds_x_drop) or if no alignment through it can reach seqan3::align_cfg::min_score (see #misses_min_score).
+     * The score of a dropped cell and the score of the horizontal gap leaving it are set to #dropped_score,
+     * such that no alignment of the following columns can pass through it. The vertical gap leaving the cell is kept,
+     * since every cell reached by it is dropped for the same reason. Otherwise, the row is added to the remaining rows
+     * `[first_remaining_row, end_remaining_row)` of the current column. This function does nothing if neither
+     * seqan3::align_cfg::x_drop nor seqan3::align_cfg::min_score is configured.
+     */
+    template <typename cell_t>
+    constexpr void prune_cell([[maybe_unused]] cell_t && cell, [[maybe_unused]] size_t const row) noexcept
+    {
+        if constexpr (is_pruned)
+        {
+            using std::get;
+            auto & score_cell = get<0>(cell);
+
+            if (exceeds_x_drop(score_cell.current) || misses_min_score(score_cell.current, get<1>(cell).coordinate))
+            {
+                score_cell.current = dropped_score;
+                score_cell.w_left = dropped_score;
+            }
+            else
+            {
+                first_remaining_row = (end_remaining_row == 0u) ? row : first_remaining_row;
+                end_remaining_row = row + 1;
+            }
+        }
+    }
+
+    //!\brief Whether the given score is more than seqan3::align_cfg::x_drop below the current optimum.
+    constexpr bool exceeds_x_drop([[maybe_unused]] typename traits_t::original_score_t const score) const noexcept
+    {
+        if constexpr (traits_t::is_x_drop)
+            return score < this->alignment_state.optimum.score - x_drop_score;
+        else
+            return false;
+    }
+
+    /*!\brief Whether no global alignment through the given cell can reach seqan3::align_cfg::min_score.
+     * \tparam coordinate_t The type of the coordinate stored in the trace matrix.
+     *
+     * \param[in] score The score of the cell.
+     * \param[in] coordinate The coordinate of the cell; the row is relative to the band in the banded matrix.
+     *
+     * \details
+     *
+     * The path from the cell to the last cell of the matrix consists of at least `|r1 - r2|` gaps and at most
+     * `min(r1, r2)` diagonal steps, where `r1` and `r2` are the remaining columns and rows. Hence, its score is at most
+     * `min(r1, r2) * m + |r1 - r2| * e`, where `m` is the largest substitution score and `e` is the gap extension score.
+     */
+    template <typename coordinate_t>
+    constexpr bool misses_min_score([[maybe_unused]] typename traits_t::original_score_t const score,
+                                    [[maybe_unused]] coordinate_t const & coordinate) const noexcept
+    {
+        if constexpr (traits_t::uses_min_score)
+        {
+            std::ptrdiff_t const column = coordinate.first;
+            std::ptrdiff_t row = coordinate.second;
+            if constexpr (traits_t::is_banded)
+                row += column - static_cast<std::ptrdiff_t>(this->score_matrix.band_col_index);
+
+            std::ptrdiff_t const remaining_columns = last_cell_coordinate.first - column;
+            std::ptrdiff_t const remaining_rows = last_cell_coordinate.second - row;
+
+            return score + std::min(remaining_columns, remaining_rows) * max_substitution_score +
+                   std::abs(remaining_columns - remaining_rows) * min_score_gap_extension < min_score;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    /*!\brief Initialises the bound of seqan3::align_cfg::min_score for the configured scores.
+     * \param[in] configured_min_score The configured minimal score.
+     *
+     * \details
+     *
+     * The bound of #misses_min_score assumes that neither opening nor extending a gap increases the score. Otherwise,
+     * no cell is dropped because of the minimal score.
+     */
+    void initialise_min_score_bound(int32_t const configured_min_score)
+    {
+        using alphabet_t = typename traits_t::scoring_scheme_alphabet_t;
+
+        auto const & scoring_scheme = seqan3::get<align_cfg::scoring>(*cfg_ptr).value;
+        for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+        {
+            for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+            {
+                std::ptrdiff_t const score = scoring_scheme.score(assign_rank_to(rank1, alphabet_t{}),
+                                                                  assign_rank_to(rank2, alphabet_t{}));
+                max_substitution_score = std::max(max_substitution_score, score);
+            }
+        }
+
+        min_score_gap_extension = this->alignment_state.gap_extension_score;
+        // The state stores the score of the first gap position, i.e. the gap open plus the gap extension score.
+        if (min_score_gap_extension <= 0 && this->alignment_state.gap_open_score <= min_score_gap_extension)
+            min_score = configured_min_score;
+    }
+
+    //!\brief Stores the coordinate of the last cell of the matrix of the given sequences for #misses_min_score.
+    template <typename sequence1_t, typename sequence2_t>
+    constexpr void initialise_last_cell_coordinate([[maybe_unused]] sequence1_t & sequence1,
+                                                   [[maybe_unused]] sequence2_t & sequence2) noexcept
+    {
+        if constexpr (traits_t::uses_min_score)
+            last_cell_coordinate = {std::ranges::distance(sequence1), std::ranges::distance(sequence2)};
+    }
+
+    //!\brief Clears the remaining rows of the pruned alignment before a new column is computed.
+    constexpr void reset_remaining_rows() noexcept
+    {
+        if constexpr (is_pruned)
+        {
+            first_remaining_row = 0u;
+            end_remaining_row = 0u;
+        }
+    }
+
+    //!\brief Whether every cell of the last computed column was dropped; always `false` without pruning.
+    constexpr bool all_cells_dropped() const noexcept
+    {
+        if constexpr (is_pruned)
+            return end_remaining_row == 0u;
+        else
+            return false;
     }
 
     /*!\brief Finalises the last cell of the current alignment column.
@@ -601,6 +1220,8 @@ private:
                       "The configuration must contain an align_cfg::result element.");
 
         using result_value_t = typename align_result_selector<sequence1_t, sequence2_t, config_t>::type;
+        auto const result_start = start_statistics_phase();
+        [[maybe_unused]] std::chrono::nanoseconds traceback_time{};
         result_value_t res{};
 
         res.id = idx;
@@ -621,10 +1242,12 @@ private:
         if constexpr (traits_t::result_type_rank >= 2) // compute front coordinate
         {
             // Get a aligned sequence builder for banded or un-banded case.
+            auto const traceback_start = start_statistics_phase();
             aligned_sequence_builder builder{sequence1, sequence2};
             auto optimum_coordinate = alignment_coordinate{column_index_type{this->alignment_state.optimum.column_index},
                                                            row_index_type{this->alignment_state.optimum.row_index}};
             auto trace_res = builder(this->trace_matrix.trace_path(optimum_coordinate));
+            traceback_time = finish_traceback_statistics(traceback_start, trace_res);
             res.front_coordinate.first = trace_res.first_sequence_slice_positions.first;
             res.front_coordinate.second = trace_res.second_sequence_slice_positions.first;
 
@@ -640,6 +1263,7 @@ private:
                 res.trace_debug_matrix = std::move(trace_debug_matrix);
         }
 
+        finish_statistics_phase(&alignment_statistics_record::result_time, result_start, traceback_time);
         return res;
     }
 
@@ -656,6 +1280,9 @@ private:
      * This function is called for the vectorised algorithm. In this case the alignment state stores the results for
      * the entire chunk of sequence pairs processed within this alignment computation. Accordingly, the chunk of
      * sequence pairs is processed iteratively and the alignment results are added to the returned vector.
+     * If the begin positions or the alignment are requested, the trace directions of the respective sequence pair
+     * are followed from the back coordinate directly in the simd trace matrix
+     * (see seqan3::detail::alignment_trace_matrix_full::lane_trace_path).
      * Depending on the selected configuration the following is extracted and/or computed:
      *
      * 1. The alignment score.
@@ -679,6 +1306,8 @@ private:
 
         using result_value_t = typename align_result_selector<sequence1_t, sequence2_t, config_t>::type;
 
+        auto const result_start = start_statistics_phase();
+        [[maybe_unused]] std::chrono::nanoseconds traceback_time{};
         std::vector<alignment_result<result_value_t>> results{};
         results.reserve(std::ranges::distance(index_sequence_pairs));
 
@@ -697,10 +1326,29 @@ private:
                 res.back_coordinate.second = this->alignment_state.optimum.row_index[simd_index];
             }
 
+            if constexpr (traits_t::result_type_rank >= 2) // compute front coordinate
+            {
+                using std::get;
+
+                // Follow the trace of the current alignment from the optimum.
+                auto const traceback_start = start_statistics_phase();
+                matrix_coordinate const trace_begin{row_index_type{res.back_coordinate.second},
+                                                    column_index_type{res.back_coordinate.first}};
+                aligned_sequence_builder builder{get<0>(sequence_pairs), get<1>(sequence_pairs)};
+                auto trace_res = builder(this->trace_matrix.lane_trace_path(simd_index, trace_begin));
+                traceback_time += finish_traceback_statistics(traceback_start, trace_res);
+                res.front_coordinate.first = trace_res.first_sequence_slice_positions.first;
+                res.front_coordinate.second = trace_res.second_sequence_slice_positions.first;
+
+                if constexpr (traits_t::result_type_rank == 3) // compute alignment
+                    res.alignment = std::move(trace_res.alignment);
+            }
+
             results.emplace_back(std::move(res));
             ++simd_index;
         }
 
+        finish_statistics_phase(&alignment_statistics_record::result_time, result_start, traceback_time);
         return results;
     }
 
@@ -743,6 +1391,117 @@ private:
         }
     }
 
+    //!\brief The time at the begin of a phase measured for seqan3::align_cfg::statistics.
+    struct statistics_phase_start
+    {
+        //!\brief The time at the begin of the phase.
+        std::chrono::steady_clock::time_point time{};
+    };
+
+    //!\brief The member of seqan3::detail::alignment_statistics_record that stores the time of a phase.
+    using statistics_phase_time_t = std::chrono::nanoseconds alignment_statistics_record::*;
+
+    //!\brief Begins a phase; the clock is not read without seqan3::align_cfg::statistics.
+    static statistics_phase_start start_statistics_phase() noexcept
+    {
+        if constexpr (traits_t::collects_statistics)
+            return {std::chrono::steady_clock::now()};
+        else
+            return {};
+    }
+
+    /*!\brief The counter of the matrix allocations for seqan3::detail::reuse_storage_allocation_counter.
+     * \returns A pointer to the allocations of the statistics record; `nullptr` without seqan3::align_cfg::statistics.
+     */
+    uint64_t * statistics_allocations() noexcept
+    {
+        if constexpr (traits_t::collects_statistics)
+            return &statistics_record.allocations;
+        else
+            return nullptr;
+    }
+
+    /*!\brief Adds the time of a phase to the statistics record.
+     * \param[in] phase_time The member of the record that stores the time of this phase.
+     * \param[in] start      The begin of the phase.
+     * \param[in] excluded   The time of a nested phase that is recorded separately.
+     * \returns The time of the phase without the excluded time; 0 without seqan3::align_cfg::statistics.
+     */
+    std::chrono::nanoseconds finish_statistics_phase([[maybe_unused]] statistics_phase_time_t const phase_time,
+                                                     [[maybe_unused]] statistics_phase_start const & start,
+                                                     [[maybe_unused]] std::chrono::nanoseconds const excluded = {})
+    {
+        if constexpr (traits_t::collects_statistics)
+        {
+            auto const elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                                      start.time) - excluded;
+            statistics_record.*phase_time += elapsed;
+            return elapsed;
+        }
+        else
+        {
+            return std::chrono::nanoseconds{};
+        }
+    }
+
+    /*!\brief Adds the time and the length of a traceback to the statistics record.
+     * \tparam trace_result_t The result type of the seqan3::detail::aligned_sequence_builder.
+     * \param[in] start     The begin of the traceback.
+     * \param[in] trace_res The result of the traceback.
+     * \returns The time of the traceback; 0 without seqan3::align_cfg::statistics.
+     */
+    template <typename trace_result_t>
+    std::chrono::nanoseconds finish_traceback_statistics(statistics_phase_start const & start,
+                                                         [[maybe_unused]] trace_result_t const & trace_res)
+    {
+        if constexpr (traits_t::collects_statistics)
+        {
+            statistics_record.traceback_length +=
+                (trace_res.first_sequence_slice_positions.second - trace_res.first_sequence_slice_positions.first) +
+                (trace_res.second_sequence_slice_positions.second - trace_res.second_sequence_slice_positions.first);
+        }
+
+        return finish_statistics_phase(&alignment_statistics_record::traceback_time, start);
+    }
+
+    //!\brief Counts the given number of computed cells; every lane of a simd cell counts in the vectorised alignment.
+    constexpr void count_statistics_cells([[maybe_unused]] size_t const cells) noexcept
+    {
+        if constexpr (traits_t::collects_statistics)
+            statistics_record.cells += cells * traits_t::alignments_per_vector;
+    }
+
+    /*!\brief Counts the simd lanes of a converted batch of sequences and the lanes that only contain padding symbols.
+     * \tparam sequence_range_t The type of the range over sequences; must model std::ranges::forward_range.
+     * \param[in] sequences          The batch of sequences.
+     * \param[in] simd_sequence_size The number of simd vectors the batch was converted to.
+     */
+    template <typename sequence_range_t>
+    void count_statistics_simd_lanes([[maybe_unused]] sequence_range_t & sequences,
+                                     [[maybe_unused]] size_t const simd_sequence_size)
+    {
+        if constexpr (traits_t::collects_statistics)
+        {
+            uint64_t const lanes = simd_sequence_size * traits_t::alignments_per_vector;
+            uint64_t symbols = 0u;
+            for (auto && sequence : sequences)
+                symbols += std::ranges::distance(sequence);
+
+            statistics_record.simd_lanes += lanes;
+            statistics_record.padded_simd_lanes += lanes - symbols;
+        }
+    }
+
+    //!\brief Adds the counters of the computed alignments to the seqan3::alignment_statistics and clears them.
+    void flush_statistics([[maybe_unused]] size_t const alignments) noexcept
+    {
+        if constexpr (traits_t::collects_statistics)
+        {
+            statistics_record.alignments += alignments;
+            statistics_record.flush(*seqan3::get<align_cfg::statistics>(*cfg_ptr).value);
+        }
+    }
+
     //!\brief The alignment configuration stored on the heap.
     std::shared_ptr<config_t> cfg_ptr{};
     //!\brief Stores the currently processed alignment column.
@@ -753,8 +1512,43 @@ private:
     score_debug_matrix_t score_debug_matrix{};
     //!\brief The debug matrix for the traces.
     trace_debug_matrix_t trace_debug_matrix{};
+    //!\brief The counters of the alignments since the last call of #flush_statistics.
+    statistics_record_t statistics_record{};
     //!\brief The maximal size within the first and the second sequence collection.
     std::pair<size_t, size_t> max_size_in_collection{};
+    //!\brief The configured seqan3::align_cfg::x_drop value.
+    typename traits_t::original_score_t x_drop_score{};
+    //!\brief The configured seqan3::align_cfg::min_score value; the lowest value if no cell is dropped by it.
+    std::ptrdiff_t min_score{std::numeric_limits<std::ptrdiff_t>::lowest()};
+    //!\brief The largest substitution score of the scoring scheme, but at least 0.
+    std::ptrdiff_t max_substitution_score{};
+    //!\brief The gap extension score used to bound the score of the remaining gaps.
+    std::ptrdiff_t min_score_gap_extension{};
+    //!\brief The coordinate of the last cell of the current matrix.
+    std::pair<std::ptrdiff_t, std::ptrdiff_t> last_cell_coordinate{};
+    //!\brief The first row of the last computed column that was not dropped.
+    size_t first_remaining_row{};
+    //!\brief The row behind the last row of the last computed column that was not dropped; 0 if all were dropped.
+    size_t end_remaining_row{};
+
+    //!\brief The score of a dropped cell; leaves room to add gap scores without an underflow.
+    static constexpr typename traits_t::original_score_t dropped_score =
+        std::numeric_limits<typename traits_t::original_score_t>::lowest() / 2;
+
+    //!\brief Whether cells are dropped by seqan3::align_cfg::x_drop or seqan3::align_cfg::min_score.
+    static constexpr bool is_pruned = traits_t::is_x_drop || traits_t::uses_min_score;
+    //!\brief Whether a chunk can be computed with seqan3::detail::affine_gap_anti_diagonal_simd.
+    static constexpr bool supports_anti_diagonal_vectorisation =
+        traits_t::is_vectorised && !traits_t::is_banded && !traits_t::is_debug &&
+        traits_t::result_type_rank < with_front_coordinate_type::rank;
+    //!\brief The minimal size of the shorter sequence of a pair to use the anti-diagonal vectorisation.
+    static constexpr size_t anti_diagonal_min_sequence_size = 4u * traits_t::alignments_per_vector;
+    //!\brief Whether a sequence pair can be computed with seqan3::detail::affine_gap_linear_space_traceback.
+    static constexpr bool supports_linear_space_traceback =
+        !traits_t::is_vectorised && !traits_t::is_banded && !traits_t::is_debug && !is_pruned &&
+        traits_t::result_type_rank >= with_front_coordinate_type::rank;
+    //!\brief The number of matrix cells above which the traceback is computed in linear space (256 MiB of traces).
+    static constexpr size_t linear_space_traceback_min_matrix_size = size_t{1u} << 28;
 };
 
 } // namespace seqan3::detail
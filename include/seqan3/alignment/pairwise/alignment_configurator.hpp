@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <cstdlib>
 #include <functional>
 #include <tuple>
 #include <utility>
@@ -26,10 +27,15 @@
 #include <seqan3/alignment/pairwise/alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/adaptive_score_width_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/length_binned_algorithm.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_algorithm.hpp>
+#include <seqan3/alignment/pairwise/wavefront_alignment_algorithm.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
 #include <seqan3/alignment/scoring/detail/simd_match_mismatch_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/detail/simd_matrix_scoring_scheme.hpp>
 #include <seqan3/core/concept/tuple.hpp>
 #include <seqan3/core/simd/simd.hpp>
 #include <seqan3/core/type_traits/deferred_crtp_base.hpp>
@@ -202,7 +208,7 @@ private:
 
 public:
     /*!\brief Configures the algorithm.
-     * \tparam sequences_t The range type containing the sequence pairs; must model std::ranges::forward_range.
+     * \tparam sequences_t The range type containing the sequence pairs; must model std::ranges::input_range.
      * \tparam config_t    The alignment configuration type; must be a specialisation of seqan3::configuration.
      * \param[in] cfg      The configuration object.
      *
@@ -288,27 +294,19 @@ public:
             // Configure the algorithm
             // ----------------------------------------------------------------------------
 
-            // Use default edit distance if gaps are not set.
-            auto const & gaps = cfg.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}});
-            auto const & scoring_scheme = get<align_cfg::scoring>(cfg).value;
             auto align_ends_cfg = cfg.template value_or<align_cfg::aligned_ends>(free_ends_none);
 
-            if constexpr (config_t::template exists<align_cfg::mode<detail::global_alignment_type>>())
+            // The X-drop extension is rejected by validate() for the edit distance scores.
+            if constexpr (config_t::template exists<align_cfg::mode<detail::global_alignment_type>>() &&
+                          !config_t::template exists<align_cfg::x_drop>() &&
+                          !alignment_configuration_traits<config_t>::is_wavefront)
             {
                 // Only use edit distance if ...
-                if (gaps.get_gap_open_score() == 0 &&  // gap open score is not set,
+                if (has_edit_distance_scores(cfg) && // the scores are the ones of the edit distance,
                     !(align_ends_cfg[2] || align_ends_cfg[3]) && // none of the free end gaps are set for second seq,
                     align_ends_cfg[0] == align_ends_cfg[1]) // free ends for leading and trailing gaps are equal in first seq.
                 {
-                    // TODO: Instead of relying on nucleotide scoring schemes we need to be able to determine the edit distance
-                    //       option via the scheme.
-                    if constexpr (is_type_specialisation_of_v<remove_cvref_t<decltype(scoring_scheme)>,
-                                                              nucleotide_scoring_scheme>)
-                    {
-                        if ((scoring_scheme.score('A'_dna15, 'A'_dna15) == 0) &&
-                            (scoring_scheme.score('A'_dna15, 'C'_dna15)) == -1)
-                            return std::pair{configure_edit_distance<function_wrapper_t>(cfg), cfg};
-                    }
+                    return std::pair{configure_edit_distance<function_wrapper_t>(cfg), cfg};
                 }
             }
 
@@ -320,28 +318,239 @@ public:
             if (config_t::template exists<align_cfg::max_error>())
                 throw invalid_alignment_configuration{"The align_cfg::max_error configuration is only allowed for "
                                                       "the specific edit distance computation."};
+
+            if (config_t::template exists<align_cfg::on_hit>())
+                throw invalid_alignment_configuration{"The align_cfg::on_hit configuration is only allowed for "
+                                                      "the semi-global edit distance computation."};
+
+            validate(cfg);
+
             // Configure the alignment algorithm.
-            return std::pair{configure_scoring_scheme<function_wrapper_t>(cfg), cfg};
+            if constexpr (alignment_configuration_traits<config_t>::is_wavefront)
+            {
+                return std::pair{configure_wavefront<function_wrapper_t>(cfg), cfg};
+            }
+            else if constexpr (alignment_configuration_traits<config_t>::is_score_width_adaptive)
+            {
+                return std::pair{configure_adaptive_score_width<function_wrapper_t,
+                                                                indexed_sequence_pair_chunk_t,
+                                                                std::remove_reference_t<wrapped_first_t>,
+                                                                std::remove_reference_t<wrapped_second_t>>(cfg),
+                                 cfg};
+            }
+            else if constexpr (alignment_configuration_traits<config_t>::is_length_binned)
+            {
+                return std::pair{configure_length_binning<function_wrapper_t,
+                                                          indexed_sequence_pair_chunk_t,
+                                                          std::remove_reference_t<wrapped_first_t>,
+                                                          std::remove_reference_t<wrapped_second_t>>(cfg),
+                                 cfg};
+            }
+            else
+            {
+                return std::pair{configure_scoring_scheme<function_wrapper_t>(cfg), cfg};
+            }
+        }
+    }
+
+    /*!\brief Configures the algorithm without type erasure.
+     * \tparam sequences_t The range type containing the sequence pairs; must model std::ranges::input_range.
+     * \tparam config_t    The alignment configuration type; must be a specialisation of seqan3::configuration.
+     * \param[in] cfg      The configuration object.
+     *
+     * \returns a std::pair over the configured alignment algorithm and the adapted alignment configuration.
+     *
+     * \throws seqan3::invalid_alignment_configuration if seqan3::detail::alignment_configurator::validate rejects the
+     *         configuration or if the seqan3::align_cfg::wavefront configuration is invalid.
+     *
+     * \details
+     *
+     * Unlike seqan3::detail::alignment_configurator::configure, the type of the returned algorithm is resolved entirely
+     * from the type of the configuration. Hence, all seqan3::align_cfg::aligned_ends settings must be static, the
+     * algorithm must be neither vectorised nor parallel and seqan3::align_cfg::max_error cannot be used.
+     * The specialised edit distance algorithm is never selected, since this depends on the values of the scores.
+     * If seqan3::align_cfg::wavefront is configured, the wavefront alignment algorithm is returned.
+     */
+    template <align_pairwise_range_input sequences_t, typename config_t>
+    //!\cond
+        requires is_type_specialisation_of_v<config_t, configuration>
+    //!\endcond
+    static constexpr auto configure_statically(config_t const & cfg)
+    {
+        if constexpr (!config_t::template exists<align_cfg::result>())
+        {
+            // Set the default result value to be computed.
+            return configure_statically<sequences_t>(cfg | align_cfg::result{with_score});
+        }
+        else
+        {
+            using traits_t = alignment_configuration_traits<config_t>;
+            using alignment_contract_t = alignment_contract<sequences_t, config_t>;
+            using align_ends_cfg_t = remove_cvref_t<decltype(cfg.template value_or<align_cfg::aligned_ends>(
+                                                                 free_ends_none))>;
+
+            static_assert(alignment_contract_t::expects_alignment_configuration() &&
+                          alignment_contract_t::expects_tuple_like_value_type() &&
+                          alignment_contract_t::expects_valid_scoring_scheme(),
+                          "Alignment configuration error: "
+                          "The configuration or the sequences cannot be used for the alignment.");
+
+            static_assert(!traits_t::is_vectorised && !traits_t::is_parallel && !traits_t::uses_thread_pool &&
+                          !config_t::template exists<align_cfg::max_error>() &&
+                          !config_t::template exists<align_cfg::on_hit>(),
+                          "Alignment configuration error: "
+                          "The statically dispatched alignment is computed sequentially by the scalar algorithm.");
+
+            static_assert(traits_t::is_local || (align_ends_cfg_t::template is_static<0>() &&
+                                                 align_ends_cfg_t::template is_static<1>() &&
+                                                 align_ends_cfg_t::template is_static<2>() &&
+                                                 align_ends_cfg_t::template is_static<3>()),
+                          "Alignment configuration error: "
+                          "The statically dispatched alignment requires static align_cfg::aligned_ends settings.");
+
+            validate(cfg);
+
+            if constexpr (traits_t::is_wavefront)
+                return std::pair{configure_wavefront<static_dispatch_tag>(cfg), cfg};
+            else
+                return std::pair{configure_scoring_scheme<static_dispatch_tag>(cfg), cfg};
         }
     }
 
 private:
+    //!\brief Passed instead of a std::function type to return the configured algorithm itself.
+    struct static_dispatch_tag
+    {};
+
+    /*!\brief Checks the configuration elements that are shared by the alignment algorithms other than the edit
+     *        distance.
+     * \tparam config_t The alignment configuration type.
+     * \param[in] cfg   The passed configuration object.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the seqan3::align_cfg::x_drop value is negative or combined
+     *         with the edit distance scores, if seqan3::align_cfg::min_score is combined with free end gaps, if
+     *         seqan3::align_cfg::statistics is a nullptr or if the seqan3::align_cfg::length_binning window is empty.
+     *
+     * \details
+     *
+     * Called by seqan3::detail::alignment_configurator::configure and
+     * seqan3::detail::alignment_configurator::configure_statically.
+     */
+    template <typename config_t>
+    static constexpr void validate(config_t const & cfg)
+    {
+        if constexpr (config_t::template exists<align_cfg::x_drop>())
+            check_x_drop(cfg);
+
+        if constexpr (config_t::template exists<align_cfg::min_score>())
+            check_min_score_without_free_ends(cfg.template value_or<align_cfg::aligned_ends>(free_ends_none));
+
+        if constexpr (config_t::template exists<align_cfg::statistics>())
+            check_statistics(cfg);
+
+        if constexpr (config_t::template exists<align_cfg::length_binning>())
+        {
+            if (get<align_cfg::length_binning>(cfg).value == 0u)
+                throw invalid_alignment_configuration{"The align_cfg::length_binning window must not be empty."};
+        }
+    }
+
+    /*!\brief Checks whether the configuration uses the scores of the edit distance.
+     * \tparam config_t The alignment configuration type.
+     * \param[in] cfg   The passed configuration object.
+     *
+     * \returns `true` if the gap open score is 0 and a nucleotide scoring scheme scores matches with 0 and mismatches
+     *          with -1, `false` otherwise.
+     */
+    template <typename config_t>
+    static constexpr bool has_edit_distance_scores(config_t const & cfg)
+    {
+        // Use default edit distance if gaps are not set.
+        auto const & gaps = cfg.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}});
+        auto const & scoring_scheme = get<align_cfg::scoring>(cfg).value;
+
+        // TODO: Instead of relying on nucleotide scoring schemes we need to be able to determine the edit distance
+        //       option via the scheme.
+        if constexpr (is_type_specialisation_of_v<remove_cvref_t<decltype(scoring_scheme)>, nucleotide_scoring_scheme>)
+        {
+            return gaps.get_gap_open_score() == 0 &&
+                   scoring_scheme.score('A'_dna15, 'A'_dna15) == 0 &&
+                   scoring_scheme.score('A'_dna15, 'C'_dna15) == -1;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    /*!\brief Checks the seqan3::align_cfg::x_drop configuration.
+     * \tparam config_t The alignment configuration type.
+     * \param[in] cfg   The passed configuration object.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the X-drop value is negative or if the edit distance scores
+     *         are configured.
+     *
+     * \details
+     *
+     * No score of the edit distance is positive, hence the extension could never leave the origin.
+     */
+    template <typename config_t>
+    static constexpr void check_x_drop(config_t const & cfg)
+    {
+        if (get<align_cfg::x_drop>(cfg).value < 0)
+            throw invalid_alignment_configuration{"The align_cfg::x_drop value must not be negative."};
+
+        if (has_edit_distance_scores(cfg))
+            throw invalid_alignment_configuration{"The align_cfg::x_drop configuration cannot be combined with the "
+                                                  "edit distance, whose scores never improve on the origin."};
+    }
+
+    /*!\brief Checks that seqan3::align_cfg::min_score is not combined with free end gaps.
+     * \tparam align_ends_cfg_t The type of the configured seqan3::end_gaps.
+     * \param[in] align_ends_cfg The configured seqan3::end_gaps.
+     *
+     * \throws seqan3::invalid_alignment_configuration if any end gap is free.
+     *
+     * \details
+     *
+     * Cells are dropped by comparing their score with the best score that can be added until the last cell of the
+     * matrix. With free end gaps the alignment may end or begin elsewhere, which this bound does not cover.
+     */
+    template <typename align_ends_cfg_t>
+    static constexpr void check_min_score_without_free_ends(align_ends_cfg_t const & align_ends_cfg)
+    {
+        if (align_ends_cfg[0] || align_ends_cfg[1] || align_ends_cfg[2] || align_ends_cfg[3])
+            throw invalid_alignment_configuration{"The align_cfg::min_score configuration cannot be combined with "
+                                                  "free end gaps unless the edit distance is computed."};
+    }
+
+    /*!\brief Checks that seqan3::align_cfg::statistics points to an object.
+     * \tparam config_t The alignment configuration type.
+     * \param[in] cfg   The passed configuration object.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the pointer is a nullptr.
+     */
+    template <typename config_t>
+    static constexpr void check_statistics(config_t const & cfg)
+    {
+        if (get<align_cfg::statistics>(cfg).value == nullptr)
+            throw invalid_alignment_configuration{"The align_cfg::statistics must not be a nullptr."};
+    }
+
     /*!\brief Configures the edit distance algorithm.
      * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
      * \tparam config_t           The alignment configuration type.
      * \param[in] cfg             The passed configuration object.
+     *
+     * \throws seqan3::invalid_alignment_configuration if seqan3::align_cfg::on_hit is configured without
+     *         seqan3::align_cfg::max_error or for a global alignment, if seqan3::align_cfg::min_score is positive or
+     *         if seqan3::align_cfg::statistics is a nullptr.
      */
     template <typename function_wrapper_t, typename config_t>
     static constexpr function_wrapper_t configure_edit_distance(config_t const & cfg)
     {
-        using traits_t = alignment_configuration_traits<config_t>;
-
-        // ----------------------------------------------------------------------------
-        // Unsupported configurations
-        // ----------------------------------------------------------------------------
-
-        if constexpr (traits_t::is_banded)
-            throw invalid_alignment_configuration{"Banded alignments are yet not supported."};
+        if constexpr (config_t::template exists<align_cfg::statistics>())
+            check_statistics(cfg);
 
         // ----------------------------------------------------------------------------
         // Configure semi-global alignment
@@ -351,8 +560,29 @@ private:
         auto align_ends_cfg = cfg.template value_or<align_cfg::aligned_ends>(free_ends_none);
         using align_ends_cfg_t = remove_cvref_t<decltype(align_ends_cfg)>;
 
+        if constexpr (config_t::template exists<align_cfg::on_hit>() &&
+                      !config_t::template exists<align_cfg::max_error>())
+        {
+            throw invalid_alignment_configuration{"The align_cfg::on_hit configuration requires "
+                                                  "align_cfg::max_error."};
+        }
+
+        // The minimal score -k is mapped to k errors.
+        if constexpr (config_t::template exists<align_cfg::min_score>())
+        {
+            if (get<align_cfg::min_score>(cfg).value > 0)
+                throw invalid_alignment_configuration{"The align_cfg::min_score value of the edit distance must not "
+                                                      "be positive."};
+        }
+
         auto configure_edit_traits = [&] (auto is_semi_global)
         {
+            if constexpr (config_t::template exists<align_cfg::on_hit>() && !decltype(is_semi_global)::value)
+            {
+                throw invalid_alignment_configuration{"The align_cfg::on_hit configuration requires free end gaps "
+                                                      "in the first sequence."};
+            }
+
             struct edit_traits_type
             {
                 using is_semi_global_type [[maybe_unused]] = remove_cvref_t<decltype(is_semi_global)>;
@@ -400,10 +630,226 @@ private:
         }
     }
 
+    /*!\brief Configures the wavefront alignment algorithm.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function or
+     *                            seqan3::detail::alignment_configurator::static_dispatch_tag.
+     * \tparam config_t           The alignment configuration type.
+     * \param[in] cfg             The passed configuration object.
+     *
+     * \throws seqan3::invalid_alignment_configuration if free end gaps are configured, if the scoring scheme has more
+     *         than one match or mismatch score or if the gap scores cannot be translated into penalties.
+     *
+     * \details
+     *
+     * The match and the mismatch score are the highest and the lowest score of the scoring scheme over all pairs of
+     * its alphabet.
+     */
+    template <typename function_wrapper_t, typename config_t>
+    static auto configure_wavefront(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+        using score_t = typename traits_t::original_score_t;
+        using alphabet_t = typename traits_t::scoring_scheme_alphabet_t;
+
+        static_assert(traits_t::is_global, "The align_cfg::wavefront configuration requires a global alignment.");
+
+        auto const align_ends_cfg = cfg.template value_or<align_cfg::aligned_ends>(free_ends_none);
+        if (align_ends_cfg[0] || align_ends_cfg[1] || align_ends_cfg[2] || align_ends_cfg[3])
+            throw invalid_alignment_configuration{"The align_cfg::wavefront configuration does not support free end "
+                                                  "gaps."};
+
+        auto const & scoring_scheme = get<align_cfg::scoring>(cfg).value;
+        auto score_of = [&] (size_t const rank1, size_t const rank2)
+        {
+            return static_cast<int64_t>(scoring_scheme.score(assign_rank_to(rank1, alphabet_t{}),
+                                                             assign_rank_to(rank2, alphabet_t{})));
+        };
+
+        int64_t match_score = std::numeric_limits<int64_t>::lowest();
+        int64_t mismatch_score = std::numeric_limits<int64_t>::max();
+        for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+        {
+            for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+            {
+                match_score = std::max(match_score, score_of(rank1, rank2));
+                mismatch_score = std::min(mismatch_score, score_of(rank1, rank2));
+            }
+        }
+
+        bool has_two_scores = match_score > mismatch_score;
+        for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+        {
+            for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+            {
+                int64_t const score = score_of(rank1, rank2);
+                has_two_scores &= (score == match_score || score == mismatch_score);
+            }
+        }
+
+        if (!has_two_scores)
+            throw invalid_alignment_configuration{"The align_cfg::wavefront configuration requires a scoring scheme "
+                                                  "with exactly one match and one mismatch score."};
+
+        auto const & gaps = cfg.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}});
+        if (gaps.get_gap_open_score() > 0 || match_score - 2 * static_cast<int64_t>(gaps.get_gap_score()) <= 0)
+            throw invalid_alignment_configuration{"The align_cfg::wavefront configuration requires a gap open score "
+                                                  "that is not positive and a gap score that is less than half of "
+                                                  "the match score."};
+
+        wavefront_alignment_algorithm<remove_cvref_t<config_t>> algorithm{cfg,
+                                                                          static_cast<score_t>(match_score),
+                                                                          static_cast<score_t>(mismatch_score)};
+
+        if constexpr (std::same_as<function_wrapper_t, static_dispatch_tag>)
+            return algorithm;
+        else
+            return function_wrapper_t{std::move(algorithm)};
+    }
+
+    /*!\brief Returns a copy of the configuration with a different score type in seqan3::align_cfg::result.
+     * \tparam score_t  The new score type.
+     * \tparam config_t The alignment configuration type.
+     * \param[in] cfg   The configuration to copy.
+     */
+    template <typename score_t, typename config_t>
+    static constexpr auto with_score_type(config_t const & cfg)
+    {
+        auto replace_score_type = [] (auto const & element)
+        {
+            if constexpr (remove_cvref_t<decltype(element)>::id == align_config_id::result)
+                return align_cfg::result{element.value, using_score_type<score_t>};
+            else
+                return element;
+        };
+
+        return std::apply([&] (auto const & ...elements)
+        {
+            return (configuration<>{} | ... | replace_score_type(elements));
+        }, static_cast<typename config_t::base_type const &>(cfg));
+    }
+
+    /*!\brief Configures the vectorised alignment that adapts the score type to every sequence pair.
+     * \tparam function_wrapper_t            The invocable alignment function type-erased via std::function.
+     * \tparam indexed_sequence_pair_chunk_t The type of the chunk that is passed to the alignment function.
+     * \tparam first_seq_t                   The type of the first sequence.
+     * \tparam second_seq_t                  The type of the second sequence.
+     * \tparam config_t                      The alignment configuration type.
+     *
+     * \param[in] cfg The passed configuration object.
+     *
+     * \returns the configured seqan3::detail::adaptive_score_width_algorithm.
+     *
+     * \details
+     *
+     * Configures a vectorised alignment algorithm for `int8_t`, for `int16_t` if it is narrower than the configured
+     * score type, and for the configured score type (see seqan3::align_cfg::adaptive_score_width). The algorithm for a
+     * narrower type is only configured if it can represent the configured gap and substitution scores.
+     */
+    template <typename function_wrapper_t,
+              typename indexed_sequence_pair_chunk_t,
+              typename first_seq_t,
+              typename second_seq_t,
+              typename config_t>
+    static function_wrapper_t configure_adaptive_score_width(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+        using original_score_t = typename traits_t::original_score_t;
+        using alphabet_t = typename traits_t::scoring_scheme_alphabet_t;
+        using result_value_t = typename align_result_selector<first_seq_t, second_seq_t, config_t>::type;
+
+        // The same defaults and substitution scores as in the vectorised alignment algorithm.
+        auto const & gaps = cfg.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}, gap_open_score{-10}});
+        auto const & scoring_scheme = get<align_cfg::scoring>(cfg).value;
+        int64_t max_match_score = 0;
+        for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+        {
+            for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+            {
+                int64_t const score = scoring_scheme.score(assign_rank_to(rank1, alphabet_t{}),
+                                                           assign_rank_to(rank2, alphabet_t{}));
+                max_match_score = std::max(max_match_score, std::abs(score));
+            }
+        }
+
+        int64_t const abs_gap_open_score = std::abs(static_cast<int64_t>(gaps.get_gap_score()) +
+                                                    static_cast<int64_t>(gaps.get_gap_open_score()));
+        int64_t const abs_gap_extension_score = std::abs(static_cast<int64_t>(gaps.get_gap_score()));
+
+        auto make_tier = [&] (auto scalar_score)
+        {
+            using scalar_score_t = decltype(scalar_score);
+            using batch_t = score_width_batch_t<indexed_sequence_pair_chunk_t>;
+
+            auto const tier_cfg = with_score_type<scalar_score_t>(cfg);
+            using tier_result_value_t = typename align_result_selector<first_seq_t,
+                                                                       second_seq_t,
+                                                                       remove_cvref_t<decltype(tier_cfg)>>::type;
+            using tier_algorithm_t = std::function<std::vector<alignment_result<tier_result_value_t>>(batch_t)>;
+
+            score_width_tier<scalar_score_t, tier_algorithm_t> tier{};
+            if (std::same_as<scalar_score_t, original_score_t> ||
+                max_representable_sequence_size<scalar_score_t>(abs_gap_open_score,
+                                                                abs_gap_extension_score,
+                                                                max_match_score) >= 0)
+            {
+                tier.algorithm = configure_scoring_scheme<tier_algorithm_t>(tier_cfg);
+            }
+
+            return tier;
+        };
+
+        auto make_adaptive_algorithm = [&] (auto ...tiers)
+        {
+            return function_wrapper_t{adaptive_score_width_algorithm<result_value_t, decltype(tiers)...>
+            {
+                abs_gap_open_score,
+                abs_gap_extension_score,
+                max_match_score,
+                traits_t::is_length_binned,
+                std::move(tiers)...
+            }};
+        };
+
+        if constexpr (sizeof(original_score_t) > sizeof(int16_t))
+            return make_adaptive_algorithm(make_tier(int8_t{}), make_tier(int16_t{}), make_tier(original_score_t{}));
+        else
+            return make_adaptive_algorithm(make_tier(int8_t{}), make_tier(original_score_t{}));
+    }
+
+    /*!\brief Configures the vectorised alignment that sorts the sequence pairs of a chunk by length.
+     * \tparam function_wrapper_t            The invocable alignment function type-erased via std::function.
+     * \tparam indexed_sequence_pair_chunk_t The type of the chunk that is passed to the alignment function.
+     * \tparam first_seq_t                   The type of the first sequence.
+     * \tparam second_seq_t                  The type of the second sequence.
+     * \tparam config_t                      The alignment configuration type.
+     *
+     * \param[in] cfg The passed configuration object.
+     *
+     * \returns the configured seqan3::detail::length_binned_algorithm.
+     */
+    template <typename function_wrapper_t,
+              typename indexed_sequence_pair_chunk_t,
+              typename first_seq_t,
+              typename second_seq_t,
+              typename config_t>
+    static function_wrapper_t configure_length_binning(config_t const & cfg)
+    {
+        using result_value_t = typename align_result_selector<first_seq_t, second_seq_t, config_t>::type;
+        using batch_t = length_binned_batch_t<indexed_sequence_pair_chunk_t>;
+        using batch_algorithm_t = std::function<std::vector<alignment_result<result_value_t>>(batch_t)>;
+
+        return function_wrapper_t{length_binned_algorithm<result_value_t, batch_algorithm_t>
+        {
+            configure_scoring_scheme<batch_algorithm_t>(cfg),
+            alignment_configuration_traits<config_t>::alignments_per_vector
+        }};
+    }
+
     /*!\brief Configures the dynamic programming matrix initialisation accoring to seqan3::align_cfg::aligned_ends
      *        settings.
      *
-     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function or
+     *                            seqan3::detail::alignment_configurator::static_dispatch_tag.
      * \tparam policies_t A template parameter pack for the already configured policy types.
      * \tparam config_t The alignment configuration type.
      *
@@ -417,12 +863,13 @@ private:
      * within the seqan3::align_cfg::aligned_ends configuration element.
      */
     template <typename function_wrapper_t, typename ...policies_t, typename config_t>
-    static constexpr function_wrapper_t configure_free_ends_initialisation(config_t const & cfg);
+    static constexpr auto configure_free_ends_initialisation(config_t const & cfg);
 
     /*!\brief Configures the search space for the alignment algorithm according to seqan3::align_cfg::aligned_ends
      *        settings.
      *
-     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function or
+     *                            seqan3::detail::alignment_configurator::static_dispatch_tag.
      * \tparam policies_t A template parameter pack for the already configured policy types.
      * \tparam config_t The alignment configuration type.
      *
@@ -436,11 +883,12 @@ private:
      * the settings for the trailing gaps of the first and the second sequence.
      */
     template <typename function_wrapper_t, typename ...policies_t, typename config_t>
-    static constexpr function_wrapper_t configure_free_ends_optimum_search(config_t const & cfg);
+    static constexpr auto configure_free_ends_optimum_search(config_t const & cfg);
 
     /*!\brief Configures the scoring scheme to use for the alignment computation.
      *
-     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function or
+     *                            seqan3::detail::alignment_configurator::static_dispatch_tag.
      * \tparam config_t The alignment configuration type.
      *
      * \param[in] cfg The passed configuration object.
@@ -455,11 +903,12 @@ private:
      * passed scoring scheme is a matrix or a simple scoring scheme, which has only mismatch and match costs.
      */
     template <typename function_wrapper_t, typename config_t>
-    static constexpr function_wrapper_t configure_scoring_scheme(config_t const & cfg);
+    static constexpr auto configure_scoring_scheme(config_t const & cfg);
 
     /*!\brief Constructs the actual alignment algorithm wrapped in the passed std::function object.
      *
-     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function or
+     *                            seqan3::detail::alignment_configurator::static_dispatch_tag.
      * \tparam policies_t A template parameter pack for the already configured policy types.
      * \tparam config_t The alignment configuration type.
      *
@@ -472,29 +921,41 @@ private:
      * Configures the matrix and the gap policy and constructs the algorithm with the configured policies.
      */
     template <typename function_wrapper_t, typename ...policies_t, typename config_t>
-    static constexpr function_wrapper_t make_algorithm(config_t const & cfg)
+    static constexpr auto make_algorithm(config_t const & cfg)
     {
         using traits_t = alignment_configuration_traits<config_t>;
         using matrix_policy_t = typename select_matrix_policy<traits_t>::type;
         using gap_policy_t = typename select_gap_policy<traits_t>::type;
+        using algorithm_t = alignment_algorithm<config_t, matrix_policy_t, gap_policy_t, policies_t...>;
 
-        return alignment_algorithm<config_t, matrix_policy_t, gap_policy_t, policies_t...>{cfg};
+        if constexpr (std::same_as<function_wrapper_t, static_dispatch_tag>)
+            return algorithm_t{cfg};
+        else
+            return function_wrapper_t{algorithm_t{cfg}};
     }
 };
 
 //!\cond
 template <typename function_wrapper_t, typename config_t>
-constexpr function_wrapper_t alignment_configurator::configure_scoring_scheme(config_t const & cfg)
+constexpr auto alignment_configurator::configure_scoring_scheme(config_t const & cfg)
 {
     using traits_t = alignment_configuration_traits<config_t>;
 
-    using alignment_scoring_scheme_t =
-        lazy_conditional_t<traits_t::is_vectorised,
+    // Substitution matrices are scored with a lookup table; all other schemes only distinguish matches.
+    using simd_scoring_scheme_t =
+        std::conditional_t<is_type_specialisation_of_v<typename traits_t::scoring_scheme_t, aminoacid_scoring_scheme>,
+                           lazy<simd_matrix_scoring_scheme,
+                                typename traits_t::score_t,
+                                typename traits_t::scoring_scheme_alphabet_t,
+                                typename traits_t::alignment_mode_t,
+                                typename traits_t::scoring_scheme_t>,
                            lazy<simd_match_mismatch_scoring_scheme,
                                 typename traits_t::score_t,
                                 typename traits_t::scoring_scheme_alphabet_t,
-                                typename traits_t::alignment_mode_t>,
-                           typename traits_t::scoring_scheme_t>;
+                                typename traits_t::alignment_mode_t>>;
+
+    using alignment_scoring_scheme_t =
+        lazy_conditional_t<traits_t::is_vectorised, simd_scoring_scheme_t, typename traits_t::scoring_scheme_t>;
 
     using scoring_scheme_policy_t = deferred_crtp_base<scoring_scheme_policy, alignment_scoring_scheme_t>;
     return configure_free_ends_initialisation<function_wrapper_t, scoring_scheme_policy_t>(cfg);
@@ -503,7 +964,7 @@ constexpr function_wrapper_t alignment_configurator::configure_scoring_scheme(co
 // This function returns a std::function object which can capture runtime dependent alignment algorithm types through
 // a fixed invocation interface which is already defined by the caller of this function.
 template <typename function_wrapper_t, typename ...policies_t, typename config_t>
-constexpr function_wrapper_t alignment_configurator::configure_free_ends_initialisation(config_t const & cfg)
+constexpr auto alignment_configurator::configure_free_ends_initialisation(config_t const & cfg)
 {
     using traits_t = alignment_configuration_traits<config_t>;
     // Get the value for the sequence ends configuration.
@@ -574,7 +1035,7 @@ constexpr function_wrapper_t alignment_configurator::configure_free_ends_initial
 // This function returns a std::function object which can capture runtime dependent alignment algorithm types through
 // a fixed invocation interface which is already defined by the caller of this function.
 template <typename function_wrapper_t, typename ...policies_t, typename config_t>
-constexpr function_wrapper_t alignment_configurator::configure_free_ends_optimum_search(config_t const & cfg)
+constexpr auto alignment_configurator::configure_free_ends_optimum_search(config_t const & cfg)
 {
     using traits_t = alignment_configuration_traits<config_t>;
 
@@ -588,9 +1049,12 @@ constexpr function_wrapper_t alignment_configurator::configure_free_ends_optimum
     {
         struct policy_trait_type
         {
-            using find_in_every_cell_type  [[maybe_unused]] = std::bool_constant<traits_t::is_local>;
+            // The X-drop extension may end in any cell of the matrix.
+            using find_in_every_cell_type  [[maybe_unused]] = std::bool_constant<traits_t::is_local ||
+                                                                                 traits_t::is_x_drop>;
             using find_in_last_row_type    [[maybe_unused]] = decltype(first_seq);
             using find_in_last_column_type [[maybe_unused]] = decltype(second_seq);
+            using is_banded_type           [[maybe_unused]] = std::bool_constant<traits_t::is_banded>;
         };
 
         // We need to select the correct policy based on the configuration traits.
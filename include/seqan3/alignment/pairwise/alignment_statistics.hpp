@@ -0,0 +1,260 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::alignment_statistics.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3
+{
+class alignment_statistics;
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief The counters of seqan3::alignment_statistics that are collected by a single alignment algorithm instance.
+ * \ingroup pairwise_alignment
+ *
+ * \details
+ *
+ * The alignment algorithms count into this plain record and only add it to the shared seqan3::alignment_statistics
+ * once per chunk of sequence pairs, such that the threads do not contend for the atomic counters.
+ */
+struct alignment_statistics_record
+{
+    //!\copydoc seqan3::alignment_statistics::alignments
+    uint64_t alignments{};
+    //!\copydoc seqan3::alignment_statistics::cells
+    uint64_t cells{};
+    //!\copydoc seqan3::alignment_statistics::simd_lanes
+    uint64_t simd_lanes{};
+    //!\copydoc seqan3::alignment_statistics::padded_simd_lanes
+    uint64_t padded_simd_lanes{};
+    //!\copydoc seqan3::alignment_statistics::traceback_length
+    uint64_t traceback_length{};
+    //!\copydoc seqan3::alignment_statistics::allocations
+    uint64_t allocations{};
+    //!\copydoc seqan3::alignment_statistics::fill_time
+    std::chrono::nanoseconds fill_time{};
+    //!\copydoc seqan3::alignment_statistics::traceback_time
+    std::chrono::nanoseconds traceback_time{};
+    //!\copydoc seqan3::alignment_statistics::result_time
+    std::chrono::nanoseconds result_time{};
+
+    //!\brief Adds this record to the given statistics and resets it.
+    void flush(alignment_statistics & statistics) noexcept;
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Counters that describe where the time of the pairwise alignments is spent.
+ * \ingroup pairwise_alignment
+ *
+ * \details
+ *
+ * An object of this type is passed by pointer to seqan3::align_cfg::statistics. Every alignment computed with this
+ * configuration adds its counters to the object, independent of the thread it is computed in. Hence, the counters are
+ * complete once the seqan3::alignment_range returned by seqan3::align_pairwise has been consumed. The object can be
+ * shared by several calls of seqan3::align_pairwise to aggregate their counters, and #reset clears them again.
+ *
+ * The counters are updated once per chunk of sequence pairs with relaxed atomic operations. Reading them while the
+ * alignments are computed is safe, but only yields a snapshot of the chunks finished so far.
+ *
+ * This type is neither copyable nor movable.
+ */
+class alignment_statistics
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    alignment_statistics() = default;                                          //!< Defaulted.
+    alignment_statistics(alignment_statistics const &) = delete;               //!< Deleted.
+    alignment_statistics(alignment_statistics &&) = delete;                    //!< Deleted.
+    alignment_statistics & operator=(alignment_statistics const &) = delete;   //!< Deleted.
+    alignment_statistics & operator=(alignment_statistics &&) = delete;        //!< Deleted.
+    ~alignment_statistics() = default;                                         //!< Defaulted.
+    //!\}
+
+    /*!\name Counters
+     * \{
+     */
+    //!\brief The number of computed alignments.
+    uint64_t alignments() const noexcept
+    {
+        return _alignments.load(std::memory_order_relaxed);
+    }
+
+    /*!\brief The number of computed cells of the dynamic programming matrices.
+     *
+     * \details
+     *
+     * Dropped cells, e.g. by seqan3::align_cfg::min_score, are not counted. In the vectorised alignment, every lane of a
+     * simd cell counts, including the lanes of padding symbols. The edit distance counts the cells of the machine words
+     * it computes, i.e. only the band or the blocks up to the last active cell of seqan3::align_cfg::max_error. The
+     * traceback in linear space counts every cell of the matrix once, although it recomputes some of them.
+     */
+    uint64_t cells() const noexcept
+    {
+        return _cells.load(std::memory_order_relaxed);
+    }
+
+    //!\brief The number of sequence symbols that were transformed to simd vectors, i.e. vectors times lanes.
+    uint64_t simd_lanes() const noexcept
+    {
+        return _simd_lanes.load(std::memory_order_relaxed);
+    }
+
+    /*!\brief The number of simd lanes that were filled with padding symbols.
+     *
+     * \details
+     *
+     * The sequences of a batch are padded to the length of the longest sequence, and the lanes of a batch that is
+     * smaller than the simd vector only contain padding symbols.
+     */
+    uint64_t padded_simd_lanes() const noexcept
+    {
+        return _padded_simd_lanes.load(std::memory_order_relaxed);
+    }
+
+    //!\brief The ratio of #padded_simd_lanes to #simd_lanes; 0 if no alignment was vectorised.
+    double padding_ratio() const noexcept
+    {
+        uint64_t const lanes = simd_lanes();
+        return (lanes == 0u) ? 0.0 : static_cast<double>(padded_simd_lanes()) / lanes;
+    }
+
+    /*!\brief The number of sequence symbols that are covered by the computed tracebacks.
+     *
+     * \details
+     *
+     * Is the sum of the lengths of both aligned sequence slices, i.e. a match or mismatch counts twice and a gap
+     * counts once. Only alignments that compute the front coordinate or the alignment have a traceback. The edit
+     * distance does not report its traceback.
+     */
+    uint64_t traceback_length() const noexcept
+    {
+        return _traceback_length.load(std::memory_order_relaxed);
+    }
+
+    /*!\brief The number of times the memory of an alignment matrix was allocated.
+     *
+     * \details
+     *
+     * The matrices are reused for the sequence pairs of a thread and only allocated if a sequence pair needs more
+     * memory than all previous ones (see seqan3::detail::reuse_storage).
+     */
+    uint64_t allocations() const noexcept
+    {
+        return _allocations.load(std::memory_order_relaxed);
+    }
+
+    //!\brief The time spent to compute the alignment matrices, summed over all threads.
+    std::chrono::nanoseconds fill_time() const noexcept
+    {
+        return std::chrono::nanoseconds{_fill_time.load(std::memory_order_relaxed)};
+    }
+
+    //!\brief The time spent to follow the traces from the back coordinate, summed over all threads.
+    std::chrono::nanoseconds traceback_time() const noexcept
+    {
+        return std::chrono::nanoseconds{_traceback_time.load(std::memory_order_relaxed)};
+    }
+
+    //!\brief The time spent to create the seqan3::alignment_result objects, summed over all threads.
+    std::chrono::nanoseconds result_time() const noexcept
+    {
+        return std::chrono::nanoseconds{_result_time.load(std::memory_order_relaxed)};
+    }
+    //!\}
+
+    //!\brief Sets all counters to 0.
+    void reset() noexcept
+    {
+        detail::alignment_statistics_record record{};
+        store(record);
+    }
+
+private:
+    //!\brief Befriend the record to add its counters.
+    friend struct detail::alignment_statistics_record;
+
+    //!\brief Overwrites the counters with the ones of the record.
+    void store(detail::alignment_statistics_record const & record) noexcept
+    {
+        _alignments.store(record.alignments, std::memory_order_relaxed);
+        _cells.store(record.cells, std::memory_order_relaxed);
+        _simd_lanes.store(record.simd_lanes, std::memory_order_relaxed);
+        _padded_simd_lanes.store(record.padded_simd_lanes, std::memory_order_relaxed);
+        _traceback_length.store(record.traceback_length, std::memory_order_relaxed);
+        _allocations.store(record.allocations, std::memory_order_relaxed);
+        _fill_time.store(record.fill_time.count(), std::memory_order_relaxed);
+        _traceback_time.store(record.traceback_time.count(), std::memory_order_relaxed);
+        _result_time.store(record.result_time.count(), std::memory_order_relaxed);
+    }
+
+    //!\brief Adds the counters of the record.
+    void add(detail::alignment_statistics_record const & record) noexcept
+    {
+        _alignments.fetch_add(record.alignments, std::memory_order_relaxed);
+        _cells.fetch_add(record.cells, std::memory_order_relaxed);
+        _simd_lanes.fetch_add(record.simd_lanes, std::memory_order_relaxed);
+        _padded_simd_lanes.fetch_add(record.padded_simd_lanes, std::memory_order_relaxed);
+        _traceback_length.fetch_add(record.traceback_length, std::memory_order_relaxed);
+        _allocations.fetch_add(record.allocations, std::memory_order_relaxed);
+        _fill_time.fetch_add(record.fill_time.count(), std::memory_order_relaxed);
+        _traceback_time.fetch_add(record.traceback_time.count(), std::memory_order_relaxed);
+        _result_time.fetch_add(record.result_time.count(), std::memory_order_relaxed);
+    }
+
+    //!\brief The number of computed alignments.
+    std::atomic<uint64_t> _alignments{};
+    //!\brief The number of computed cells.
+    std::atomic<uint64_t> _cells{};
+    //!\brief The number of transformed simd lanes.
+    std::atomic<uint64_t> _simd_lanes{};
+    //!\brief The number of padded simd lanes.
+    std::atomic<uint64_t> _padded_simd_lanes{};
+    //!\brief The length of the tracebacks.
+    std::atomic<uint64_t> _traceback_length{};
+    //!\brief The number of matrix allocations.
+    std::atomic<uint64_t> _allocations{};
+    //!\brief The time of the matrix fill in nanoseconds.
+    std::atomic<int64_t> _fill_time{};
+    //!\brief The time of the traceback in nanoseconds.
+    std::atomic<int64_t> _traceback_time{};
+    //!\brief The time to create the results in nanoseconds.
+    std::atomic<int64_t> _result_time{};
+};
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+//!\cond
+inline void alignment_statistics_record::flush(alignment_statistics & statistics) noexcept
+{
+    statistics.add(*this);
+    *this = alignment_statistics_record{};
+}
+//!\endcond
+
+} // namespace seqan3::detail
@@ -0,0 +1,327 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::adaptive_score_width_algorithm.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+#include <seqan3/core/simd/simd.hpp>
+#include <seqan3/core/type_traits/basic.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Returns the length of the longest sequence for which no score of the vectorised alignment can overflow the
+ *        given scalar score type.
+ * \ingroup pairwise_alignment
+ * \tparam scalar_score_t The scalar type of the simd score vector; must model std::integral.
+ * \param gap_open_score      The absolute score for opening a gap including the score of the first gap extension.
+ * \param gap_extension_score The absolute score for extending a gap.
+ * \param max_match_score     The largest absolute match or mismatch score.
+ * \returns The maximal length of the longer sequence of a pair or `-1` if the scores themselves cannot be represented.
+ *
+ * \details
+ *
+ * Let `d` be the length of the longer sequence of every pair in a batch. Every score of the alignment matrix is the
+ * score of a path that uses at most two gap openings, `2 * d` gap extensions and `d` matches or mismatches. The
+ * intermediate values of the recursion add one more gap opening, gap extension and match score. The coordinates of
+ * the optimum, which are stored in the score vector as well, are bounded by `d + 1`.
+ */
+template <std::integral scalar_score_t>
+constexpr int64_t max_representable_sequence_size(int64_t const gap_open_score,
+                                                  int64_t const gap_extension_score,
+                                                  int64_t const max_match_score) noexcept
+{
+    int64_t const max_score = std::numeric_limits<scalar_score_t>::max();
+    int64_t const offset = 3 * gap_open_score + gap_extension_score + max_match_score;
+    int64_t const slope = 2 * gap_extension_score + max_match_score;
+
+    if (offset > max_score)
+        return -1;
+
+    int64_t const max_size = max_score - 1;
+    return (slope > 0) ? std::min(max_size, (max_score - offset) / slope) : max_size;
+}
+
+/*!\brief A vectorised alignment algorithm with a fixed scalar score type used by
+ *        seqan3::detail::adaptive_score_width_algorithm.
+ * \ingroup pairwise_alignment
+ * \tparam scalar_score_t The scalar type of the simd score vector; must model std::integral.
+ * \tparam algorithm_t    The type-erased alignment algorithm; must be a std::function.
+ */
+template <std::integral scalar_score_t, typename algorithm_t>
+struct score_width_tier
+{
+    //!\brief The scalar score type.
+    using scalar_score_type = scalar_score_t;
+    //!\brief The number of sequence pairs that are computed at once.
+    static constexpr size_t lanes = simd_traits<simd_type_t<scalar_score_t>>::length;
+
+    //!\brief The alignment algorithm; empty if the configured scores cannot be represented by `scalar_score_t`.
+    algorithm_t algorithm{};
+};
+
+/*!\brief Selects the sequence pairs of one batch in seqan3::detail::adaptive_score_width_algorithm.
+ * \ingroup pairwise_alignment
+ */
+struct score_width_batch_selector
+{
+    //!\brief The batch of every sequence pair in the order of the chunk.
+    std::vector<size_t> const * batch_ids{nullptr};
+    //!\brief The index of the first sequence pair of the chunk.
+    size_t first_index{};
+    //!\brief The selected batch.
+    size_t batch_id{};
+
+    //!\brief Returns whether the given indexed sequence pair belongs to the selected batch.
+    template <typename indexed_sequence_pair_t>
+    bool operator()(indexed_sequence_pair_t const & indexed_sequence_pair) const noexcept
+    {
+        using std::get;
+
+        return (*batch_ids)[static_cast<size_t>(get<1>(indexed_sequence_pair)) - first_index] == batch_id;
+    }
+};
+
+/*!\brief The range over the sequence pairs of a chunk that are passed to the algorithm of a
+ *        seqan3::detail::score_width_tier.
+ * \ingroup pairwise_alignment
+ * \tparam indexed_sequence_pair_chunk_t The type of the chunk; must model seqan3::detail::indexed_sequence_pair_range.
+ */
+template <typename indexed_sequence_pair_chunk_t>
+using score_width_batch_t = decltype(std::declval<indexed_sequence_pair_chunk_t &>() |
+                                     std::views::filter(std::declval<score_width_batch_selector>()));
+
+/*!\brief Computes a chunk of sequence pairs with the narrowest simd score type that cannot overflow.
+ * \ingroup pairwise_alignment
+ * \implements std::invocable
+ * \tparam result_value_t The value type of the returned seqan3::alignment_result with the configured score type.
+ * \tparam tier_t         The seqan3::detail::score_width_tier types ordered from the narrowest to the configured score
+ *                        type.
+ *
+ * \details
+ *
+ * The vectorised alignment does not saturate the scores, so an overflow cannot be detected after the computation.
+ * Instead, every sequence pair of a chunk is assigned to the narrowest tier whose score type can represent all scores
+ * of its alignment matrix (see seqan3::detail::max_representable_sequence_size). The bound only depends on the length
+ * of the longer sequence, so it also holds for the padded matrix of a batch. The last tier uses the configured score
+ * type and takes all remaining sequence pairs. The sequence pairs of every tier are computed in batches of
+ * seqan3::detail::score_width_tier::lanes pairs, optionally sorted by length (see seqan3::align_cfg::length_binning),
+ * and the results are converted to the configured score type and returned in the order of the chunk.
+ */
+template <typename result_value_t, typename ...tier_t>
+class adaptive_score_width_algorithm
+{
+private:
+    //!\brief The number of tiers.
+    static constexpr size_t tier_count = sizeof...(tier_t);
+
+    static_assert(tier_count > 0, "Expected at least one tier.");
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    adaptive_score_width_algorithm() = default; //!< Defaulted.
+    adaptive_score_width_algorithm(adaptive_score_width_algorithm const &) = default; //!< Defaulted.
+    adaptive_score_width_algorithm(adaptive_score_width_algorithm &&) = default; //!< Defaulted.
+    adaptive_score_width_algorithm & operator=(adaptive_score_width_algorithm const &) = default; //!< Defaulted.
+    adaptive_score_width_algorithm & operator=(adaptive_score_width_algorithm &&) = default; //!< Defaulted.
+    ~adaptive_score_width_algorithm() = default; //!< Defaulted.
+
+    /*!\brief Constructs the algorithm from the tiers and the configured scores.
+     * \param gap_open_score      The absolute score for opening a gap including the score of the first gap extension.
+     * \param gap_extension_score The absolute score for extending a gap.
+     * \param max_match_score     The largest absolute match or mismatch score.
+     * \param bin_by_length       Whether the sequence pairs of a tier are sorted by length before they are batched.
+     * \param tiers               The tiers ordered from the narrowest to the configured score type.
+     */
+    adaptive_score_width_algorithm(int64_t const gap_open_score,
+                                   int64_t const gap_extension_score,
+                                   int64_t const max_match_score,
+                                   bool const bin_by_length,
+                                   tier_t ...tiers) :
+        tiers{std::move(tiers)...},
+        max_sequence_sizes{max_tier_sequence_size<tier_t>(gap_open_score, gap_extension_score, max_match_score)...},
+        bin_by_length{bin_by_length}
+    {
+        // The configured score type takes every sequence pair, as the standard vectorised alignment does.
+        max_sequence_sizes.back() = std::numeric_limits<int64_t>::max();
+    }
+    //!\}
+
+    /*!\brief Computes the alignments of the given chunk.
+     * \tparam indexed_sequence_pairs_t The type of the chunk; must model seqan3::detail::indexed_sequence_pair_range.
+     * \param[in] indexed_sequence_pairs The chunk over indexed sequence pairs with consecutive indices.
+     * \returns A std::vector over seqan3::alignment_result in the order of the chunk.
+     */
+    template <typename indexed_sequence_pairs_t>
+    std::vector<alignment_result<result_value_t>> operator()(indexed_sequence_pairs_t indexed_sequence_pairs)
+    {
+        using std::get;
+
+        size_t const chunk_size = std::ranges::distance(indexed_sequence_pairs);
+        std::vector<alignment_result<result_value_t>> results(chunk_size);
+
+        if (chunk_size == 0u)
+            return results;
+
+        size_t const first_index = get<1>(*std::ranges::begin(indexed_sequence_pairs));
+
+        // Assign every sequence pair to the narrowest tier.
+        std::vector<std::pair<size_t, int64_t>> tier_and_sizes{};
+        tier_and_sizes.reserve(chunk_size);
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            assert(static_cast<size_t>(idx) - first_index == tier_and_sizes.size());
+            (void) idx;
+
+            int64_t const sequence_size = std::max<int64_t>(std::ranges::distance(get<0>(sequence_pair)),
+                                                            std::ranges::distance(get<1>(sequence_pair)));
+            size_t const tier = std::ranges::find_if(max_sequence_sizes, [sequence_size] (int64_t const max_size)
+                                                     {
+                                                         return sequence_size <= max_size;
+                                                     }) - max_sequence_sizes.begin();
+
+            tier_and_sizes.emplace_back(tier, sequence_size);
+        }
+
+        // Batch the pairs of every tier in the order of the chunk or sorted by length; the batch ids of tier t start
+        // at t * chunk_size.
+        std::vector<size_t> order(chunk_size);
+        std::iota(order.begin(), order.end(), 0u);
+
+        if (bin_by_length)
+        {
+            std::stable_sort(order.begin(), order.end(), [&] (size_t const lhs, size_t const rhs)
+            {
+                return tier_and_sizes[lhs] < tier_and_sizes[rhs];
+            });
+        }
+
+        std::vector<size_t> batch_ids(chunk_size);
+        std::array<size_t, tier_count> tier_sizes{};
+
+        for (size_t const position : order)
+        {
+            size_t const tier = tier_and_sizes[position].first;
+            batch_ids[position] = tier * chunk_size + tier_sizes[tier]++ / lanes[tier];
+        }
+
+        compute_tiers(indexed_sequence_pairs,
+                      score_width_batch_selector{&batch_ids, first_index, 0u},
+                      tier_sizes,
+                      results,
+                      std::index_sequence_for<tier_t...>{});
+
+        return results;
+    }
+
+private:
+    /*!\brief Returns the maximal sequence length of the given tier (see
+     *        seqan3::detail::max_representable_sequence_size).
+     * \tparam tier_type The seqan3::detail::score_width_tier type.
+     */
+    template <typename tier_type>
+    static constexpr int64_t max_tier_sequence_size(int64_t const gap_open_score,
+                                                    int64_t const gap_extension_score,
+                                                    int64_t const max_match_score) noexcept
+    {
+        return max_representable_sequence_size<typename tier_type::scalar_score_type>(gap_open_score,
+                                                                                      gap_extension_score,
+                                                                                      max_match_score);
+    }
+
+    //!\brief Computes the batches of every tier.
+    template <typename indexed_sequence_pairs_t, size_t ...tier_index>
+    void compute_tiers(indexed_sequence_pairs_t & indexed_sequence_pairs,
+                       score_width_batch_selector const selector,
+                       std::array<size_t, tier_count> const & tier_sizes,
+                       std::vector<alignment_result<result_value_t>> & results,
+                       std::index_sequence<tier_index...> const &)
+    {
+        (compute_tier<tier_index>(indexed_sequence_pairs, selector, tier_sizes[tier_index], results), ...);
+    }
+
+    /*!\brief Computes the batches of one tier and stores the converted results at the position of the sequence pair.
+     * \tparam tier_index The index of the tier.
+     */
+    template <size_t tier_index, typename indexed_sequence_pairs_t>
+    void compute_tier(indexed_sequence_pairs_t & indexed_sequence_pairs,
+                      score_width_batch_selector selector,
+                      size_t const tier_size,
+                      std::vector<alignment_result<result_value_t>> & results)
+    {
+        auto & tier = std::get<tier_index>(tiers);
+        size_t const batch_count = (tier_size + lanes[tier_index] - 1) / lanes[tier_index];
+
+        for (size_t batch = 0; batch < batch_count; ++batch)
+        {
+            assert(static_cast<bool>(tier.algorithm));
+
+            selector.batch_id = tier_index * results.size() + batch;
+            for (auto && batch_result : tier.algorithm(indexed_sequence_pairs | std::views::filter(selector)))
+                results[batch_result.id() - selector.first_index] = convert_result(std::move(batch_result));
+        }
+    }
+
+    /*!\brief Converts a result of a narrower tier to the configured score type.
+     * \tparam tier_result_t The type of the seqan3::alignment_result of the tier.
+     */
+    template <typename tier_result_t>
+    static alignment_result<result_value_t> convert_result(tier_result_t && tier_result)
+    {
+        if constexpr (std::same_as<remove_cvref_t<tier_result_t>, alignment_result<result_value_t>>)
+        {
+            return std::forward<tier_result_t>(tier_result);
+        }
+        else
+        {
+            result_value_t value{};
+            value.id = tier_result.id();
+            value.score = tier_result.score();
+
+            if constexpr (!std::same_as<decltype(value.back_coordinate), std::nullopt_t *>)
+                value.back_coordinate = tier_result.back_coordinate();
+            if constexpr (!std::same_as<decltype(value.front_coordinate), std::nullopt_t *>)
+                value.front_coordinate = tier_result.front_coordinate();
+            if constexpr (!std::same_as<decltype(value.alignment), std::nullopt_t *>)
+                value.alignment = tier_result.alignment();
+
+            return alignment_result<result_value_t>{std::move(value)};
+        }
+    }
+
+    //!\brief The tiers ordered from the narrowest to the configured score type.
+    std::tuple<tier_t...> tiers{};
+    //!\brief The number of lanes of every tier.
+    static constexpr std::array<size_t, tier_count> lanes{tier_t::lanes...};
+    //!\brief The maximal length of the longer sequence of a pair for every tier.
+    std::array<int64_t, tier_count> max_sequence_sizes{};
+    //!\brief Whether the sequence pairs of a tier are sorted by length before they are batched.
+    bool bin_by_length{false};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,320 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::affine_gap_anti_diagonal_simd.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <seqan3/alignment/matrix/alignment_optimum.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/simd/concept.hpp>
+#include <seqan3/core/simd/simd_algorithm.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the affine gap alignment of a single sequence pair with simd vectors along the anti-diagonals.
+ * \ingroup pairwise_alignment
+ * \tparam score_t  The simd vector type used for computing the scores; must model seqan3::simd::simd_concept.
+ * \tparam is_local Whether a local alignment is computed.
+ *
+ * \details
+ *
+ * In contrast to the inter-sequence vectorisation of seqan3::detail::alignment_algorithm, where every lane of a simd
+ * vector computes a different sequence pair, this algorithm uses all lanes for one sequence pair. The cells of one
+ * anti-diagonal do not depend on each other, so consecutive cells of an anti-diagonal are computed at once.
+ * Only the last two anti-diagonals are kept, which are indexed by the row of the cell. The first sequence is stored
+ * in reverse order, such that the symbols of both sequences that are compared along an anti-diagonal are adjacent in
+ * memory and can be loaded with one unaligned load per sequence.
+ *
+ * The recursion, the initialisation of the first row and column and the search for the optimum mirror the scalar
+ * policies (seqan3::detail::affine_gap_policy, seqan3::detail::affine_gap_init_policy and
+ * seqan3::detail::find_optimum_policy). This includes the tie-breaking: if multiple cells have the optimal score,
+ * the same coordinate as in the column-wise computation is reported.
+ *
+ * Only the score and the back coordinate can be computed. Since the scores are not saturated, the caller must check
+ * with #is_representable that no score of the matrix can exceed the value range of the scalar type.
+ */
+template <simd_concept score_t, bool is_local>
+class affine_gap_anti_diagonal_simd
+{
+public:
+    //!\brief The scalar type of the simd vector.
+    using scalar_type = typename simd_traits<score_t>::scalar_type;
+
+    //!\brief The number of cells that are computed at once.
+    static constexpr size_t lanes = simd_traits<score_t>::length;
+
+private:
+    //!\brief The score that is used for cells that cannot be reached.
+    static constexpr scalar_type minus_infinity = std::numeric_limits<scalar_type>::lowest() / 2;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    affine_gap_anti_diagonal_simd() = delete;                                                     //!< Deleted
+    affine_gap_anti_diagonal_simd(affine_gap_anti_diagonal_simd const &) = default;               //!< Defaulted
+    affine_gap_anti_diagonal_simd(affine_gap_anti_diagonal_simd &&) = default;                    //!< Defaulted
+    affine_gap_anti_diagonal_simd & operator=(affine_gap_anti_diagonal_simd const &) = default;   //!< Defaulted
+    affine_gap_anti_diagonal_simd & operator=(affine_gap_anti_diagonal_simd &&) = default;        //!< Defaulted
+    ~affine_gap_anti_diagonal_simd() = default;                                                   //!< Defaulted
+
+    /*!\brief Constructs the algorithm.
+     * \param gap_open_score      The score for opening a gap including the score of the first gap extension.
+     * \param gap_extension_score The score for extending a gap.
+     * \param free_ends           Whether the leading and trailing gaps of the first and the second sequence are free;
+     *                            same order as in seqan3::align_cfg::aligned_ends. Ignored for local alignments.
+     */
+    affine_gap_anti_diagonal_simd(scalar_type const gap_open_score,
+                                  scalar_type const gap_extension_score,
+                                  std::array<bool, 4> const free_ends) noexcept :
+        gap_open_score{gap_open_score},
+        gap_extension_score{gap_extension_score},
+        free_first_leading{is_local || free_ends[0]},
+        free_first_trailing{free_ends[1]},
+        free_second_leading{is_local || free_ends[2]},
+        free_second_trailing{free_ends[3]}
+    {}
+    //!\}
+
+    /*!\brief Checks whether all scores of the alignment matrix can be represented by the scalar type.
+     * \param first_size      The size of the first sequence.
+     * \param second_size     The size of the second sequence.
+     * \param max_match_score The maximal absolute score of the scoring scheme.
+     *
+     * \details
+     *
+     * Every cell of the matrix is bounded by the number of cells on a path to it times the largest absolute score a
+     * step can contribute. The bound must stay above #minus_infinity, so that unreachable cells never become reachable
+     * or wrap around.
+     */
+    bool is_representable(size_t const first_size, size_t const second_size, scalar_type const max_match_score) const
+        noexcept
+    {
+        int64_t const step = std::abs(static_cast<int64_t>(gap_open_score)) +
+                             std::abs(static_cast<int64_t>(gap_extension_score)) +
+                             std::abs(static_cast<int64_t>(max_match_score));
+        int64_t const path_length = static_cast<int64_t>(first_size + second_size + 1u);
+
+        return path_length * step < -static_cast<int64_t>(minus_infinity) / 2;
+    }
+
+    /*!\brief Computes the alignment optimum of the given sequences.
+     * \tparam sequence1_t       The type of the first sequence; must model std::ranges::sized_range.
+     * \tparam sequence2_t       The type of the second sequence; must model std::ranges::sized_range.
+     * \tparam scoring_scheme_t  The type of the vectorised scoring scheme.
+     * \param[in] sequence1      The first sequence.
+     * \param[in] sequence2      The second sequence.
+     * \param[in] scoring_scheme The scoring scheme which scores two simd vectors over alphabet ranks
+     *                           (e.g. seqan3::detail::simd_match_mismatch_scoring_scheme).
+     * \returns The seqan3::detail::alignment_optimum with the score and the coordinate of the optimal cell.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * \f$ O(n*m/l) \f$ runtime and \f$ O(n + m) \f$ space, where \f$ l \f$ is #lanes.
+     */
+    template <std::ranges::sized_range sequence1_t, std::ranges::sized_range sequence2_t, typename scoring_scheme_t>
+    alignment_optimum<scalar_type> operator()(sequence1_t && sequence1,
+                                              sequence2_t && sequence2,
+                                              scoring_scheme_t const & scoring_scheme)
+    {
+        size_t const cols = std::ranges::size(sequence1);
+        size_t const rows = std::ranges::size(sequence2);
+
+        // Both sequences are padded by a full simd vector, so the last vector of an anti-diagonal can always be loaded.
+        std::vector<scalar_type> reversed_ranks1(cols + lanes);
+        std::vector<scalar_type> ranks2(rows + lanes);
+        size_t position = cols;
+        for (auto const & symbol : sequence1)
+            reversed_ranks1[--position] = static_cast<scalar_type>(seqan3::to_rank(symbol));
+
+        position = 0u;
+        for (auto const & symbol : sequence2)
+            ranks2[position++] = static_cast<scalar_type>(seqan3::to_rank(symbol));
+
+        // The last two anti-diagonals and the current one, indexed by the row of the cell.
+        std::vector<scalar_type> score_2(rows + 1u + lanes, minus_infinity);
+        std::vector<scalar_type> score_1{score_2};
+        std::vector<scalar_type> score_0{score_2};
+        std::vector<scalar_type> horizontal_1{score_2};
+        std::vector<scalar_type> horizontal_0{score_2};
+        std::vector<scalar_type> vertical_1{score_2};
+        std::vector<scalar_type> vertical_0{score_2};
+
+        // The scores of the last row and the last column, which are searched for the optimum after the recursion.
+        std::vector<scalar_type> last_row(cols + 1u);
+        std::vector<scalar_type> last_column(rows + 1u);
+
+        score_t const gap_open = simd::fill<score_t>(gap_open_score);
+        score_t const gap_extension = simd::fill<score_t>(gap_extension_score);
+        [[maybe_unused]] score_t const zero = simd::fill<score_t>(0);
+
+        // The local optimum is tracked per lane, which starts with the origin cell.
+        [[maybe_unused]] score_t optimum_score = zero;
+        [[maybe_unused]] score_t optimum_column = zero;
+        [[maybe_unused]] score_t optimum_row = zero;
+
+        for (size_t diagonal = 0u; diagonal <= cols + rows; ++diagonal)
+        {
+            size_t const first_row = (diagonal > cols) ? diagonal - cols : 0u;
+
+            // The inner cells of the anti-diagonal, i.e. without the cells in the first row and the first column.
+            size_t const inner_begin = std::max<size_t>(first_row, 1u);
+            size_t const inner_end = std::min(rows + 1u, diagonal);
+
+            for (size_t row = inner_begin; row < inner_end; row += lanes)
+            {
+                score_t const diagonal_score = simd::load<score_t>(score_2.data() + row - 1u);
+                score_t const up_score = simd::load<score_t>(score_1.data() + row - 1u);
+                score_t const left_score = simd::load<score_t>(score_1.data() + row);
+
+                score_t const score = scoring_scheme.score(
+                                          simd::load<score_t>(reversed_ranks1.data() + cols - diagonal + row),
+                                          simd::load<score_t>(ranks2.data() + row - 1u));
+
+                score_t horizontal = simd::load<score_t>(horizontal_1.data() + row) + gap_extension;
+                horizontal = (horizontal < left_score + gap_open) ? left_score + gap_open : horizontal;
+                score_t vertical = simd::load<score_t>(vertical_1.data() + row - 1u) + gap_extension;
+                vertical = (vertical < up_score + gap_open) ? up_score + gap_open : vertical;
+
+                score_t current = diagonal_score + score;
+                current = (current < vertical) ? vertical : current;
+                current = (current < horizontal) ? horizontal : current;
+
+                if constexpr (is_local)
+                {
+                    current = (current < zero) ? zero : current;
+
+                    // Lanes behind the end of the anti-diagonal contain garbage and must not be tracked.
+                    score_t const row_index = simd::iota<score_t>(row);
+                    score_t const column_index = simd::fill<score_t>(diagonal) - row_index;
+                    auto const mask = (row_index < simd::fill<score_t>(inner_end)) &
+                                      ((current > optimum_score) |
+                                       ((current == optimum_score) &
+                                        ((column_index < optimum_column) |
+                                         ((column_index == optimum_column) & (row_index < optimum_row)))));
+
+                    optimum_score = mask ? current : optimum_score;
+                    optimum_column = mask ? column_index : optimum_column;
+                    optimum_row = mask ? row_index : optimum_row;
+                }
+
+                std::memcpy(score_0.data() + row, &current, sizeof(score_t));
+                std::memcpy(horizontal_0.data() + row, &horizontal, sizeof(score_t));
+                std::memcpy(vertical_0.data() + row, &vertical, sizeof(score_t));
+            }
+
+            // The cells in the first row and the first column are written after the inner cells, since the last vector
+            // of the inner cells might have overwritten the cell in the first column.
+            if (first_row == 0u)
+            {
+                score_0[0] = init_score(diagonal, free_first_leading);
+                horizontal_0[0] = minus_infinity;
+                vertical_0[0] = minus_infinity;
+            }
+
+            if (diagonal > 0u && diagonal <= rows)
+            {
+                score_0[diagonal] = init_score(diagonal, free_second_leading);
+                horizontal_0[diagonal] = minus_infinity;
+                vertical_0[diagonal] = minus_infinity;
+            }
+
+            if (diagonal >= rows)
+                last_row[diagonal - rows] = score_0[rows];
+            if (diagonal >= cols)
+                last_column[diagonal - cols] = score_0[diagonal - cols];
+
+            std::swap(score_2, score_1);
+            std::swap(score_1, score_0);
+            std::swap(horizontal_1, horizontal_0);
+            std::swap(vertical_1, vertical_0);
+        }
+
+        alignment_optimum<scalar_type> optimum{};
+
+        if constexpr (is_local)
+        {
+            optimum.score = 0;
+            for (size_t lane = 0u; lane < lanes; ++lane)
+            {
+                size_t const column_index = optimum_column[lane];
+                size_t const row_index = optimum_row[lane];
+
+                if (optimum_score[lane] > optimum.score ||
+                    (optimum_score[lane] == optimum.score &&
+                     (column_index < optimum.column_index ||
+                      (column_index == optimum.column_index && row_index < optimum.row_index))))
+                {
+                    optimum.score = optimum_score[lane];
+                    optimum.column_index = column_index;
+                    optimum.row_index = row_index;
+                }
+            }
+        }
+        else if (!free_first_trailing && !free_second_trailing)
+        {
+            optimum.update_if_new_optimal_score(last_row[cols], column_index_type{cols}, row_index_type{rows});
+        }
+        else
+        {
+            // Same order as the column-wise computation: the last row cell of every column, then the last column.
+            if (free_first_trailing)
+                for (size_t col = 0u; col <= cols; ++col)
+                    optimum.update_if_new_optimal_score(last_row[col], column_index_type{col}, row_index_type{rows});
+
+            if (free_second_trailing)
+                for (size_t row = 0u; row <= rows; ++row)
+                    optimum.update_if_new_optimal_score(last_column[row], column_index_type{cols}, row_index_type{row});
+        }
+
+        return optimum;
+    }
+
+private:
+    /*!\brief Returns the score of a cell in the first row or the first column.
+     * \param index        The index of the cell within the row or column.
+     * \param is_free_gap  Whether leading gaps are free for this row or column.
+     */
+    scalar_type init_score(size_t const index, bool const is_free_gap) const noexcept
+    {
+        if (index == 0u || is_free_gap)
+            return 0;
+
+        return gap_open_score + static_cast<scalar_type>(index - 1u) * gap_extension_score;
+    }
+
+    //!\brief The score for opening a gap including the first gap extension.
+    scalar_type gap_open_score{};
+    //!\brief The score for extending a gap.
+    scalar_type gap_extension_score{};
+    //!\brief Whether leading gaps in the first sequence are free, i.e. the first row is initialised with 0.
+    bool free_first_leading{};
+    //!\brief Whether trailing gaps in the first sequence are free, i.e. the optimum is searched in the last row.
+    bool free_first_trailing{};
+    //!\brief Whether leading gaps in the second sequence are free, i.e. the first column is initialised with 0.
+    bool free_second_leading{};
+    //!\brief Whether trailing gaps in the second sequence are free, i.e. the optimum is searched in the last column.
+    bool free_second_trailing{};
+};
+
+} // namespace seqan3::detail
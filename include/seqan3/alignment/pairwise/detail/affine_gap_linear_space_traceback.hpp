@@ -0,0 +1,694 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::affine_gap_linear_space_traceback.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include <seqan3/alignment/matrix/alignment_optimum.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the optimal affine gap alignment of a sequence pair in linear space.
+ * \ingroup pairwise_alignment
+ * \tparam score_t  The score type; must be a signed integral type.
+ * \tparam is_local Whether a local alignment is computed.
+ *
+ * \details
+ *
+ * The alignment is computed in three phases, each of which keeps only one column of scores:
+ *
+ * 1. The optimum and its back coordinate are computed column by column with the same initialisation, recursion and
+ *    tie-breaking as the scalar policies (seqan3::detail::affine_gap_policy, seqan3::detail::affine_gap_init_policy
+ *    and seqan3::detail::find_optimum_policy).
+ * 2. If the alignment may start at an arbitrary cell, i.e. for local alignments or free leading gaps, the front
+ *    coordinate is found by aligning the reversed prefixes that end in the back coordinate.
+ * 3. The alignment between the front and the back coordinate is computed with the divide-and-conquer algorithm of
+ *    Myers and Miller (Optimal alignments in linear space, 1988). The middle column of the first sequence is computed
+ *    from both ends and the row with the best combined score splits the problem into two halves. A horizontal gap
+ *    that crosses the middle column is merged, such that its opening score is only counted once. Small subproblems
+ *    are solved with the full dynamic programming matrix.
+ *
+ * Phase 3 computes every cell about twice, so the runtime is at most three times the runtime of the score-only
+ * computation, while the memory is \f$ O(n + m) \f$ instead of \f$ O(n * m) \f$.
+ *
+ * Among co-optimal alignments another one than the one of the full trace matrix may be reported.
+ */
+template <typename score_t, bool is_local>
+class affine_gap_linear_space_traceback
+{
+private:
+    //!\brief The score that is used for cells that cannot be reached; the sum of two of them does not overflow.
+    static constexpr score_t minus_infinity = std::numeric_limits<score_t>::lowest() / 4;
+    //!\brief The maximal number of cells of a subproblem that is solved with the full matrix.
+    static constexpr size_t full_matrix_size = 4096u;
+
+public:
+    //!\brief The iterator over the computed trace path from the back to the front coordinate.
+    class trace_path_iterator
+    {
+    public:
+        /*!\name Associated types
+         * \{
+         */
+        using value_type = trace_directions; //!< The value type.
+        using reference = trace_directions const &; //!< The reference type.
+        using pointer = value_type const *; //!< The pointer type.
+        using difference_type = std::ptrdiff_t; //!< The difference type.
+        using iterator_category = std::forward_iterator_tag; //!< Forward iterator tag.
+        //!\}
+
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        trace_path_iterator() = default; //!< Defaulted.
+        trace_path_iterator(trace_path_iterator const &) = default; //!< Defaulted.
+        trace_path_iterator(trace_path_iterator &&) = default; //!< Defaulted.
+        trace_path_iterator & operator=(trace_path_iterator const &) = default; //!< Defaulted.
+        trace_path_iterator & operator=(trace_path_iterator &&) = default; //!< Defaulted.
+        ~trace_path_iterator() = default; //!< Defaulted.
+
+        /*!\brief Constructs the iterator from the trace directions and the back coordinate.
+         * \param trace           The trace directions from the back to the front coordinate.
+         * \param back_coordinate The coordinate of the first trace direction.
+         */
+        trace_path_iterator(std::vector<trace_directions> const & trace, matrix_coordinate const back_coordinate)
+            noexcept :
+            trace_it{trace.begin()},
+            trace_end{trace.end()},
+            current_coordinate{back_coordinate}
+        {}
+        //!\}
+
+        //!\brief Returns the current trace direction.
+        reference operator*() const noexcept
+        {
+            return *trace_it;
+        }
+
+        //!\brief Returns a pointer to the current trace direction.
+        pointer operator->() const noexcept
+        {
+            return &*trace_it;
+        }
+
+        //!\brief Returns the current coordinate in two-dimensional space.
+        matrix_coordinate coordinate() const noexcept
+        {
+            return current_coordinate;
+        }
+
+        //!\brief Advances the iterator by one.
+        trace_path_iterator & operator++() noexcept
+        {
+            if (*trace_it != trace_directions::up)
+                --current_coordinate.col;
+            if (*trace_it != trace_directions::left)
+                --current_coordinate.row;
+
+            ++trace_it;
+            return *this;
+        }
+
+        //!\brief Returns an iterator advanced by one.
+        trace_path_iterator operator++(int) noexcept
+        {
+            trace_path_iterator tmp{*this};
+            ++(*this);
+            return tmp;
+        }
+
+        //!\brief Returns `true` if both iterators are equal, `false` otherwise.
+        friend bool operator==(trace_path_iterator const & lhs, trace_path_iterator const & rhs) noexcept
+        {
+            return lhs.trace_it == rhs.trace_it;
+        }
+
+        //!\brief Returns `true` if the front coordinate is reached.
+        friend bool operator==(trace_path_iterator const & lhs, std::ranges::default_sentinel_t const &) noexcept
+        {
+            return lhs.trace_it == lhs.trace_end;
+        }
+
+        //!\copydoc operator==()
+        friend bool operator==(std::ranges::default_sentinel_t const &, trace_path_iterator const & rhs) noexcept
+        {
+            return rhs == std::ranges::default_sentinel;
+        }
+
+        //!\brief Returns `true` if both iterators are not equal, `false` otherwise.
+        friend bool operator!=(trace_path_iterator const & lhs, trace_path_iterator const & rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        //!\brief Returns `true` if the front coordinate is not reached.
+        friend bool operator!=(trace_path_iterator const & lhs, std::ranges::default_sentinel_t const &) noexcept
+        {
+            return !(lhs == std::ranges::default_sentinel);
+        }
+
+        //!\copydoc operator!=()
+        friend bool operator!=(std::ranges::default_sentinel_t const &, trace_path_iterator const & rhs) noexcept
+        {
+            return !(rhs == std::ranges::default_sentinel);
+        }
+
+    private:
+        //!\brief The current trace direction.
+        std::vector<trace_directions>::const_iterator trace_it{};
+        //!\brief The end of the trace directions.
+        std::vector<trace_directions>::const_iterator trace_end{};
+        //!\brief The coordinate of the current trace direction.
+        matrix_coordinate current_coordinate{};
+    };
+
+    //!\brief The result of the alignment computation.
+    struct result_type
+    {
+        //!\brief The score and the back coordinate of the alignment.
+        alignment_optimum<score_t> optimum{};
+        //!\brief The trace directions from the back to the front coordinate; only diagonal, up or left.
+        std::vector<trace_directions> trace{};
+
+        //!\brief Returns the trace path that can be passed to seqan3::detail::aligned_sequence_builder.
+        auto trace_path() const
+        {
+            matrix_coordinate const back_coordinate{row_index_type{optimum.row_index},
+                                                    column_index_type{optimum.column_index}};
+
+            return std::ranges::subrange<trace_path_iterator, std::ranges::default_sentinel_t>
+            {
+                trace_path_iterator{trace, back_coordinate},
+                std::ranges::default_sentinel
+            };
+        }
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    affine_gap_linear_space_traceback() = delete;                                                       //!< Deleted
+    affine_gap_linear_space_traceback(affine_gap_linear_space_traceback const &) = default;             //!< Defaulted
+    affine_gap_linear_space_traceback(affine_gap_linear_space_traceback &&) = default;                  //!< Defaulted
+    affine_gap_linear_space_traceback & operator=(affine_gap_linear_space_traceback const &) = default; //!< Defaulted
+    affine_gap_linear_space_traceback & operator=(affine_gap_linear_space_traceback &&) = default;      //!< Defaulted
+    ~affine_gap_linear_space_traceback() = default;                                                     //!< Defaulted
+
+    /*!\brief Constructs the algorithm.
+     * \param gap_open_score      The score for opening a gap including the score of the first gap extension.
+     * \param gap_extension_score The score for extending a gap.
+     * \param free_ends           Whether the leading and trailing gaps of the first and the second sequence are free;
+     *                            same order as in seqan3::align_cfg::aligned_ends. Ignored for local alignments.
+     */
+    affine_gap_linear_space_traceback(score_t const gap_open_score,
+                                      score_t const gap_extension_score,
+                                      std::array<bool, 4> const free_ends) noexcept :
+        gap_open_score{gap_open_score},
+        gap_extension_score{gap_extension_score},
+        free_first_leading{is_local || free_ends[0]},
+        free_first_trailing{free_ends[1]},
+        free_second_leading{is_local || free_ends[2]},
+        free_second_trailing{free_ends[3]}
+    {}
+    //!\}
+
+    /*!\brief Computes the optimal alignment of the given sequences.
+     * \tparam sequence1_t       The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t       The type of the second sequence; must model std::ranges::forward_range.
+     * \tparam scoring_scheme_t  The type of the scoring scheme.
+     * \param[in] sequence1      The first sequence.
+     * \param[in] sequence2      The second sequence.
+     * \param[in] scoring_scheme The scoring scheme.
+     * \returns The optimum and the trace directions of the alignment.
+     */
+    template <std::ranges::forward_range sequence1_t,
+              std::ranges::forward_range sequence2_t,
+              typename scoring_scheme_t>
+    result_type operator()(sequence1_t && sequence1, sequence2_t && sequence2, scoring_scheme_t const & scoring_scheme)
+    {
+        std::vector<std::ranges::range_value_t<sequence1_t>> sequence1_values{};
+        std::vector<std::ranges::range_value_t<sequence2_t>> sequence2_values{};
+        std::ranges::copy(sequence1, std::back_inserter(sequence1_values));
+        std::ranges::copy(sequence2, std::back_inserter(sequence2_values));
+
+        auto score = [&] (size_t const col, size_t const row) -> score_t
+        {
+            return scoring_scheme.score(sequence1_values[col], sequence2_values[row]);
+        };
+
+        size_t const rows = sequence2_values.size();
+        column_scores.resize(rows + 1u);
+        column_horizontal_scores.resize(rows + 1u);
+        reverse_scores.resize(rows + 1u);
+        reverse_horizontal_scores.resize(rows + 1u);
+
+        result_type result{};
+        result.optimum = compute_optimum(score, sequence1_values.size(), rows);
+
+        matrix_coordinate const back_coordinate{row_index_type{result.optimum.row_index},
+                                                column_index_type{result.optimum.column_index}};
+        matrix_coordinate const front_coordinate = compute_front_coordinate(score, back_coordinate);
+
+        compute_trace(score,
+                      front_coordinate.col, back_coordinate.col,
+                      front_coordinate.row, back_coordinate.row,
+                      gap_open_only(), gap_open_only(),
+                      result.trace);
+
+        return result;
+    }
+
+private:
+    //!\brief Returns the score for opening a gap without the score of the first gap extension.
+    score_t gap_open_only() const noexcept
+    {
+        return gap_open_score - gap_extension_score;
+    }
+
+    //!\brief Returns the score of a cell in the first row or column if the leading gaps are not free.
+    score_t leading_gap_score(size_t const length) const noexcept
+    {
+        return (length == 0u) ? 0 : gap_open_score + static_cast<score_t>(length - 1u) * gap_extension_score;
+    }
+
+    /*!\brief Computes the optimum of the whole matrix with the same semantics as the column-wise algorithm.
+     * \param score The function that returns the score of a column and a row.
+     * \param cols  The size of the first sequence.
+     * \param rows  The size of the second sequence.
+     */
+    template <typename score_fn_t>
+    alignment_optimum<score_t> compute_optimum(score_fn_t & score, size_t const cols, size_t const rows)
+    {
+        alignment_optimum<score_t> optimum{};
+        auto & current = column_scores;
+        auto & horizontal = column_horizontal_scores;
+
+        // Checks the last cell of a column; the cells are visited in the same order as by the column-wise algorithm.
+        auto check_last_row_cell = [&] (size_t const col)
+        {
+            if constexpr (!is_local)
+                if (free_first_trailing)
+                    optimum.update_if_new_optimal_score(current[rows], column_index_type{col}, row_index_type{rows});
+        };
+
+        for (size_t row = 0u; row <= rows; ++row)
+        {
+            current[row] = free_second_leading ? 0 : leading_gap_score(row);
+            horizontal[row] = minus_infinity;
+
+            if constexpr (is_local)
+                optimum.update_if_new_optimal_score(current[row], column_index_type{0u}, row_index_type{row});
+        }
+        check_last_row_cell(0u);
+
+        for (size_t col = 1u; col <= cols; ++col)
+        {
+            score_t diagonal = current[0];
+            current[0] = free_first_leading ? 0 : leading_gap_score(col);
+            score_t vertical = minus_infinity;
+
+            if constexpr (is_local)
+                optimum.update_if_new_optimal_score(current[0], column_index_type{col}, row_index_type{0u});
+
+            for (size_t row = 1u; row <= rows; ++row)
+            {
+                horizontal[row] = std::max<score_t>(current[row] + gap_open_score,
+                                                    horizontal[row] + gap_extension_score);
+                vertical = std::max<score_t>(current[row - 1u] + gap_open_score, vertical + gap_extension_score);
+
+                score_t const cell = std::max({static_cast<score_t>(diagonal + score(col - 1u, row - 1u)),
+                                               horizontal[row],
+                                               vertical});
+                diagonal = current[row];
+                current[row] = is_local ? std::max<score_t>(cell, 0) : cell;
+
+                if constexpr (is_local)
+                    optimum.update_if_new_optimal_score(current[row], column_index_type{col}, row_index_type{row});
+            }
+
+            check_last_row_cell(col);
+        }
+
+        if constexpr (!is_local)
+        {
+            if (free_second_trailing)
+            {
+                for (size_t row = 0u; row <= rows; ++row)
+                    optimum.update_if_new_optimal_score(current[row], column_index_type{cols}, row_index_type{row});
+            }
+            else if (!free_first_trailing)
+            {
+                optimum.update_if_new_optimal_score(current[rows], column_index_type{cols}, row_index_type{rows});
+            }
+        }
+
+        return optimum;
+    }
+
+    /*!\brief Finds the front coordinate of an optimal alignment that ends in the back coordinate.
+     * \param score           The function that returns the score of a column and a row.
+     * \param back_coordinate The back coordinate of the alignment.
+     *
+     * \details
+     *
+     * The prefixes of both sequences that end in the back coordinate are aligned in reverse direction starting with
+     * the back coordinate. The front coordinate is a cell with the maximal score among the cells where the alignment
+     * may start, i.e. the origin, the first row if the leading gaps of the first sequence are free, the first column if
+     * the leading gaps of the second sequence are free, or any cell for local alignments.
+     */
+    template <typename score_fn_t>
+    matrix_coordinate compute_front_coordinate(score_fn_t & score, matrix_coordinate const back_coordinate)
+    {
+        matrix_coordinate front_coordinate{row_index_type{0u}, column_index_type{0u}};
+
+        if (!free_first_leading && !free_second_leading)
+            return front_coordinate;
+
+        size_t const cols = back_coordinate.col;
+        size_t const rows = back_coordinate.row;
+        auto & current = column_scores;
+        auto & horizontal = column_horizontal_scores;
+        score_t best_score = std::numeric_limits<score_t>::lowest();
+
+        // The reversed column `col` and row `row` correspond to the forward coordinate (cols - col, rows - row).
+        auto update = [&] (score_t const value, size_t const col, size_t const row)
+        {
+            bool const is_candidate = is_local ||
+                                      (free_first_leading && row == rows) ||
+                                      (free_second_leading && col == cols);
+
+            if (is_candidate && value > best_score)
+            {
+                best_score = value;
+                front_coordinate = matrix_coordinate{row_index_type{rows - row}, column_index_type{cols - col}};
+            }
+        };
+
+        for (size_t row = 0u; row <= rows; ++row)
+        {
+            current[row] = leading_gap_score(row);
+            horizontal[row] = minus_infinity;
+            update(current[row], 0u, row);
+        }
+
+        for (size_t col = 1u; col <= cols; ++col)
+        {
+            score_t diagonal = current[0];
+            current[0] = leading_gap_score(col);
+            score_t vertical = minus_infinity;
+            update(current[0], col, 0u);
+
+            for (size_t row = 1u; row <= rows; ++row)
+            {
+                horizontal[row] = std::max<score_t>(current[row] + gap_open_score,
+                                                    horizontal[row] + gap_extension_score);
+                vertical = std::max<score_t>(current[row - 1u] + gap_open_score, vertical + gap_extension_score);
+
+                score_t const cell = std::max({static_cast<score_t>(diagonal + score(cols - col, rows - row)),
+                                               horizontal[row],
+                                               vertical});
+                diagonal = current[row];
+                current[row] = cell;
+                update(cell, col, row);
+            }
+        }
+
+        return front_coordinate;
+    }
+
+    /*!\brief Computes the last column of the subproblem in forward or reverse direction.
+     * \tparam is_reverse Whether the sequences are processed from the back.
+     * \param score        The function that returns the score of a column and a row.
+     * \param col_begin    The first column of the subproblem.
+     * \param col_end      The column behind the last column of the subproblem.
+     * \param row_begin    The first row of the subproblem.
+     * \param row_end      The row behind the last row of the subproblem.
+     * \param leading_gap  The score for opening a horizontal gap at the start (in processing direction).
+     * \param current      The scores of the last column, indexed by the number of processed rows.
+     * \param horizontal   The scores of the last column ending with a horizontal gap.
+     */
+    template <bool is_reverse, typename score_fn_t>
+    void compute_column(score_fn_t & score,
+                        size_t const col_begin, size_t const col_end,
+                        size_t const row_begin, size_t const row_end,
+                        score_t const leading_gap,
+                        std::vector<score_t> & current,
+                        std::vector<score_t> & horizontal)
+    {
+        size_t const cols = col_end - col_begin;
+        size_t const rows = row_end - row_begin;
+
+        current[0] = 0;
+        horizontal[0] = minus_infinity;
+        for (size_t row = 1u; row <= rows; ++row)
+        {
+            current[row] = leading_gap_score(row);
+            horizontal[row] = minus_infinity;
+        }
+
+        for (size_t col = 1u; col <= cols; ++col)
+        {
+            score_t diagonal = current[0];
+            current[0] = leading_gap + static_cast<score_t>(col) * gap_extension_score;
+            horizontal[0] = current[0];
+            score_t vertical = minus_infinity;
+
+            size_t const seq1_pos = is_reverse ? col_end - col : col_begin + col - 1u;
+
+            for (size_t row = 1u; row <= rows; ++row)
+            {
+                size_t const seq2_pos = is_reverse ? row_end - row : row_begin + row - 1u;
+
+                horizontal[row] = std::max<score_t>(current[row] + gap_open_score,
+                                                    horizontal[row] + gap_extension_score);
+                vertical = std::max<score_t>(current[row - 1u] + gap_open_score, vertical + gap_extension_score);
+
+                score_t const cell = std::max({static_cast<score_t>(diagonal + score(seq1_pos, seq2_pos)),
+                                               horizontal[row],
+                                               vertical});
+                diagonal = current[row];
+                current[row] = cell;
+            }
+        }
+    }
+
+    /*!\brief Computes the trace of the global alignment of the given subproblem and appends it in reverse order.
+     * \param score        The function that returns the score of a column and a row.
+     * \param col_begin    The first column of the subproblem.
+     * \param col_end      The column behind the last column of the subproblem.
+     * \param row_begin    The first row of the subproblem.
+     * \param row_end      The row behind the last row of the subproblem.
+     * \param leading_gap  The score for opening a horizontal gap at the start of the subproblem; `0` if the gap
+     *                     continues a gap of the enclosing problem.
+     * \param trailing_gap The score for opening a horizontal gap at the end of the subproblem; `0` if the gap
+     *                     continues a gap of the enclosing problem.
+     * \param[out] trace   The trace to append to.
+     */
+    template <typename score_fn_t>
+    void compute_trace(score_fn_t & score,
+                       size_t const col_begin, size_t const col_end,
+                       size_t const row_begin, size_t const row_end,
+                       score_t const leading_gap, score_t const trailing_gap,
+                       std::vector<trace_directions> & trace)
+    {
+        size_t const cols = col_end - col_begin;
+        size_t const rows = row_end - row_begin;
+
+        if (rows == 0u)
+        {
+            trace.insert(trace.end(), cols, trace_directions::left);
+            return;
+        }
+
+        if (cols == 0u)
+        {
+            trace.insert(trace.end(), rows, trace_directions::up);
+            return;
+        }
+
+        if (cols == 1u || (cols + 1u) * (rows + 1u) <= full_matrix_size)
+        {
+            compute_trace_full_matrix(score, col_begin, col_end, row_begin, row_end, leading_gap, trailing_gap, trace);
+            return;
+        }
+
+        size_t const col_middle = col_begin + cols / 2u;
+
+        compute_column<false>(score, col_begin, col_middle, row_begin, row_end, leading_gap,
+                              column_scores, column_horizontal_scores);
+        compute_column<true>(score, col_middle, col_end, row_begin, row_end, trailing_gap,
+                             reverse_scores, reverse_horizontal_scores);
+
+        // Find the row in which an optimal alignment crosses the middle column.
+        size_t best_row = 0u;
+        bool crosses_with_gap = false;
+        score_t best_score = std::numeric_limits<score_t>::lowest();
+
+        for (size_t row = 0u; row <= rows; ++row)
+        {
+            score_t const without_gap = column_scores[row] + reverse_scores[rows - row];
+            score_t const with_gap = column_horizontal_scores[row] + reverse_horizontal_scores[rows - row] -
+                                     gap_open_only();
+
+            if (without_gap > best_score)
+            {
+                best_score = without_gap;
+                best_row = row;
+                crosses_with_gap = false;
+            }
+
+            if (with_gap > best_score)
+            {
+                best_score = with_gap;
+                best_row = row;
+                crosses_with_gap = true;
+            }
+        }
+
+        // The trace is built from the back, so the second half is computed first.
+        if (crosses_with_gap)
+        {
+            compute_trace(score, col_middle + 1u, col_end, row_begin + best_row, row_end, 0, trailing_gap, trace);
+            trace.insert(trace.end(), 2u, trace_directions::left);
+            compute_trace(score, col_begin, col_middle - 1u, row_begin, row_begin + best_row, leading_gap, 0, trace);
+        }
+        else
+        {
+            compute_trace(score, col_middle, col_end, row_begin + best_row, row_end, gap_open_only(), trailing_gap,
+                          trace);
+            compute_trace(score, col_begin, col_middle, row_begin, row_begin + best_row, leading_gap, gap_open_only(),
+                          trace);
+        }
+    }
+
+    //!\brief Computes the trace of a small subproblem with the full matrix; see #compute_trace.
+    template <typename score_fn_t>
+    void compute_trace_full_matrix(score_fn_t & score,
+                                   size_t const col_begin, size_t const col_end,
+                                   size_t const row_begin, size_t const row_end,
+                                   score_t const leading_gap, score_t const trailing_gap,
+                                   std::vector<trace_directions> & trace)
+    {
+        size_t const cols = col_end - col_begin;
+        size_t const rows = row_end - row_begin;
+        size_t const matrix_size = (cols + 1u) * (rows + 1u);
+        auto index = [rows] (size_t const col, size_t const row) { return col * (rows + 1u) + row; };
+
+        std::vector<score_t> scores(matrix_size);
+        std::vector<score_t> horizontal(matrix_size, minus_infinity);
+        std::vector<score_t> vertical(matrix_size, minus_infinity);
+
+        for (size_t row = 1u; row <= rows; ++row)
+            scores[index(0u, row)] = vertical[index(0u, row)] = leading_gap_score(row);
+
+        for (size_t col = 1u; col <= cols; ++col)
+        {
+            scores[index(col, 0u)] = horizontal[index(col, 0u)] = leading_gap +
+                                                                  static_cast<score_t>(col) * gap_extension_score;
+
+            for (size_t row = 1u; row <= rows; ++row)
+            {
+                horizontal[index(col, row)] = std::max<score_t>(scores[index(col - 1u, row)] + gap_open_score,
+                                                                horizontal[index(col - 1u, row)] +
+                                                                gap_extension_score);
+                vertical[index(col, row)] = std::max<score_t>(scores[index(col, row - 1u)] + gap_open_score,
+                                                              vertical[index(col, row - 1u)] + gap_extension_score);
+                scores[index(col, row)] =
+                    std::max({static_cast<score_t>(scores[index(col - 1u, row - 1u)] +
+                                                   score(col_begin + col - 1u, row_begin + row - 1u)),
+                              horizontal[index(col, row)],
+                              vertical[index(col, row)]});
+            }
+        }
+
+        // A horizontal gap at the end only pays the trailing gap open score.
+        trace_directions state = trace_directions::diagonal;
+        if (horizontal[index(cols, rows)] - gap_open_only() + trailing_gap > scores[index(cols, rows)])
+            state = trace_directions::left;
+
+        size_t col = cols;
+        size_t row = rows;
+        while (col > 0u && row > 0u)
+        {
+            size_t const current = index(col, row);
+
+            if (state == trace_directions::left)
+            {
+                trace.push_back(trace_directions::left);
+                if (col == 1u || horizontal[current] != horizontal[index(col - 1u, row)] + gap_extension_score)
+                    state = trace_directions::diagonal;
+                --col;
+            }
+            else if (state == trace_directions::up)
+            {
+                trace.push_back(trace_directions::up);
+                if (row == 1u || vertical[current] != vertical[index(col, row - 1u)] + gap_extension_score)
+                    state = trace_directions::diagonal;
+                --row;
+            }
+            else if (scores[current] == scores[index(col - 1u, row - 1u)] +
+                                        score(col_begin + col - 1u, row_begin + row - 1u))
+            {
+                trace.push_back(trace_directions::diagonal);
+                --col;
+                --row;
+            }
+            else if (scores[current] == horizontal[current])
+            {
+                state = trace_directions::left;
+            }
+            else
+            {
+                assert(scores[current] == vertical[current]);
+                state = trace_directions::up;
+            }
+        }
+
+        trace.insert(trace.end(), col, trace_directions::left);
+        trace.insert(trace.end(), row, trace_directions::up);
+    }
+
+    //!\brief The score for opening a gap including the first gap extension.
+    score_t gap_open_score{};
+    //!\brief The score for extending a gap.
+    score_t gap_extension_score{};
+    //!\brief Whether leading gaps in the first sequence are free, i.e. the first row is initialised with 0.
+    bool free_first_leading{};
+    //!\brief Whether trailing gaps in the first sequence are free, i.e. the optimum is searched in the last row.
+    bool free_first_trailing{};
+    //!\brief Whether leading gaps in the second sequence are free, i.e. the first column is initialised with 0.
+    bool free_second_leading{};
+    //!\brief Whether trailing gaps in the second sequence are free, i.e. the optimum is searched in the last column.
+    bool free_second_trailing{};
+
+    //!\brief The scores of the current column.
+    std::vector<score_t> column_scores{};
+    //!\brief The scores of the current column that end with a horizontal gap.
+    std::vector<score_t> column_horizontal_scores{};
+    //!\brief The scores of the current column in reverse direction.
+    std::vector<score_t> reverse_scores{};
+    //!\brief The scores of the current column in reverse direction that end with a horizontal gap.
+    std::vector<score_t> reverse_horizontal_scores{};
+};
+
+} // namespace seqan3::detail
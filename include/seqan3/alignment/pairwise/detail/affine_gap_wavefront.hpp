@@ -0,0 +1,434 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::affine_gap_wavefront.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/detail/affine_gap_linear_space_traceback.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the optimal global affine gap alignment of a sequence pair with the wavefront algorithm.
+ * \ingroup pairwise_alignment
+ * \tparam score_t The score type; must be a signed integral type.
+ *
+ * \details
+ *
+ * The wavefront alignment algorithm (WFA) of Marco-Sola et al. (Fast gap-affine pairwise alignment using the
+ * wavefront algorithm, 2021) computes, in increasing order of the penalty \f$ s \f$, the furthest reaching cell on
+ * every diagonal of the alignment matrix that is reachable with penalty \f$ s \f$. After a cell was reached, it is
+ * extended along its diagonal as long as the characters match, which is free. Hence, the runtime is
+ * \f$ O((n + m) s) \f$ and not \f$ O(n m) \f$, which is much faster for similar sequences.
+ *
+ * The WFA requires that a match has no penalty. The scores are therefore translated into penalties: Since every
+ * column of a global alignment consumes two characters, except for the gap columns which consume one,
+ * \f$ 2 S = M (n + m) - P \f$ holds for the score \f$ S \f$ of every alignment, where \f$ M \f$ is the match score and
+ * \f$ P \f$ its penalty with a mismatch penalty of \f$ 2 (M - X) \f$, a gap open penalty of \f$ -2 G \f$ and a gap
+ * extension penalty of \f$ M - 2 E \f$ for the mismatch score \f$ X \f$, the gap open score \f$ G \f$ and the gap
+ * extension score \f$ E \f$. Thus, minimising the penalty maximises the score.
+ *
+ * The wavefronts of the last few penalties suffice to compute the score. If the trace is requested, all wavefronts
+ * are stored, which requires \f$ O(s^2) \f$ memory. Among co-optimal alignments another one than the one of the
+ * dynamic programming algorithm may be reported.
+ */
+template <typename score_t>
+class affine_gap_wavefront
+{
+private:
+    //!\brief The offset of a cell that cannot be reached; adding one to it is still invalid.
+    static constexpr int32_t no_offset = std::numeric_limits<int32_t>::lowest() / 2;
+
+    //!\brief The wavefronts of one penalty, which store the furthest reaching column index per diagonal.
+    struct wavefront
+    {
+        //!\brief Whether any cell can be reached with this penalty.
+        bool exists{false};
+        //!\brief The lowest diagonal.
+        int32_t lo{0};
+        //!\brief The highest diagonal.
+        int32_t hi{-1};
+        //!\brief The offsets of the alignments that end with a match or mismatch.
+        std::vector<int32_t> match{};
+        //!\brief The offsets of the alignments that end with a gap in the second sequence.
+        std::vector<int32_t> insertion{};
+        //!\brief The offsets of the alignments that end with a gap in the first sequence.
+        std::vector<int32_t> deletion{};
+    };
+
+public:
+    //!\brief The result of the alignment computation.
+    using result_type = typename affine_gap_linear_space_traceback<score_t, false>::result_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    affine_gap_wavefront() = delete;                                                  //!< Deleted
+    affine_gap_wavefront(affine_gap_wavefront const &) = default;                     //!< Defaulted
+    affine_gap_wavefront(affine_gap_wavefront &&) = default;                          //!< Defaulted
+    affine_gap_wavefront & operator=(affine_gap_wavefront const &) = default;         //!< Defaulted
+    affine_gap_wavefront & operator=(affine_gap_wavefront &&) = default;              //!< Defaulted
+    ~affine_gap_wavefront() = default;                                                //!< Defaulted
+
+    /*!\brief Constructs the algorithm.
+     * \param match_score         The score of a match; must be greater than the mismatch score.
+     * \param mismatch_score      The score of a mismatch.
+     * \param gap_open_score      The score for opening a gap, which is added once per gap; must not be positive.
+     * \param gap_extension_score The score for every character of a gap; must not be positive and must be less than
+     *                            the match score if both are 0.
+     * \param with_trace          Whether the trace of the alignment is computed.
+     */
+    affine_gap_wavefront(score_t const match_score,
+                         score_t const mismatch_score,
+                         score_t const gap_open_score,
+                         score_t const gap_extension_score,
+                         bool const with_trace) noexcept :
+        match_score{match_score},
+        mismatch_penalty{2 * (static_cast<int64_t>(match_score) - mismatch_score)},
+        gap_open_penalty{-2 * static_cast<int64_t>(gap_open_score)},
+        gap_extension_penalty{static_cast<int64_t>(match_score) - 2 * static_cast<int64_t>(gap_extension_score)},
+        with_trace{with_trace}
+    {
+        assert(mismatch_penalty > 0);
+        assert(gap_open_penalty >= 0);
+        assert(gap_extension_penalty > 0);
+    }
+    //!\}
+
+    /*!\brief Computes the optimal global alignment of the given sequences.
+     * \tparam sequence1_t       The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t       The type of the second sequence; must model std::ranges::forward_range.
+     * \tparam scoring_scheme_t  The type of the scoring scheme.
+     * \param[in] sequence1      The first sequence.
+     * \param[in] sequence2      The second sequence.
+     * \param[in] scoring_scheme The scoring scheme, which returns the match score for the characters that match.
+     * \returns The optimum and, if requested, the trace directions of the alignment.
+     */
+    template <std::ranges::forward_range sequence1_t,
+              std::ranges::forward_range sequence2_t,
+              typename scoring_scheme_t>
+    result_type operator()(sequence1_t && sequence1, sequence2_t && sequence2, scoring_scheme_t const & scoring_scheme)
+    {
+        std::vector<std::ranges::range_value_t<sequence1_t>> sequence1_values{};
+        std::vector<std::ranges::range_value_t<sequence2_t>> sequence2_values{};
+        std::ranges::copy(sequence1, std::back_inserter(sequence1_values));
+        std::ranges::copy(sequence2, std::back_inserter(sequence2_values));
+
+        columns = static_cast<int32_t>(sequence1_values.size());
+        rows = static_cast<int32_t>(sequence2_values.size());
+
+        auto extend = [&] (int32_t offset, int32_t const diagonal)
+        {
+            while (offset < columns && offset - diagonal < rows &&
+                   scoring_scheme.score(sequence1_values[offset], sequence2_values[offset - diagonal]) == match_score)
+            {
+                ++offset;
+            }
+
+            return offset;
+        };
+
+        // Only the last wavefronts are accessed while computing the score.
+        size_t const max_distance = std::max(mismatch_penalty, gap_open_penalty + gap_extension_penalty);
+        wavefronts.resize(with_trace ? 1u : max_distance + 1u);
+
+        int32_t const last_diagonal = columns - rows;
+        size_t penalty = 0;
+
+        initialise_wavefront(slot(0), 0, 0);
+        slot(0).match[0] = extend(0, 0);
+
+        while (!reaches_end(slot(penalty), last_diagonal))
+        {
+            ++penalty;
+            if (with_trace)
+                wavefronts.resize(penalty + 1u);
+
+            compute_wavefront(penalty, extend);
+        }
+
+        result_type result{};
+        result.optimum.score = static_cast<score_t>((static_cast<int64_t>(match_score) * (columns + rows) -
+                                                     static_cast<int64_t>(penalty)) / 2);
+        result.optimum.column_index = columns;
+        result.optimum.row_index = rows;
+
+        if (with_trace)
+            result.trace = compute_trace(penalty, last_diagonal);
+
+        return result;
+    }
+
+private:
+    //!\brief Returns the wavefront that stores the given penalty.
+    wavefront & slot(size_t const penalty) noexcept
+    {
+        return wavefronts[with_trace ? penalty : penalty % wavefronts.size()];
+    }
+
+    //!\brief Returns the wavefront of the given penalty or `nullptr` if no cell can be reached with it.
+    wavefront const * find(int64_t const penalty) const noexcept
+    {
+        if (penalty < 0)
+            return nullptr;
+
+        size_t const index = with_trace ? penalty : penalty % wavefronts.size();
+        return wavefronts[index].exists ? &wavefronts[index] : nullptr;
+    }
+
+    //!\brief Returns the offset of the given component on the given diagonal or seqan3::detail::no_offset.
+    static int32_t offset(wavefront const * front, std::vector<int32_t> wavefront::*component, int32_t const diagonal)
+    {
+        if (front == nullptr || diagonal < front->lo || diagonal > front->hi)
+            return no_offset;
+
+        return (front->*component)[diagonal - front->lo];
+    }
+
+    //!\brief Returns the offset if the cell lies inside the alignment matrix, otherwise seqan3::detail::no_offset.
+    int32_t validate(int32_t const offset, int32_t const diagonal) const noexcept
+    {
+        return (offset >= 0 && offset >= diagonal && offset <= columns && offset - diagonal <= rows) ? offset
+                                                                                                     : no_offset;
+    }
+
+    //!\brief Resets the given wavefront to the diagonals in `[lo, hi]`.
+    static void initialise_wavefront(wavefront & front, int32_t const lo, int32_t const hi)
+    {
+        size_t const size = hi - lo + 1;
+        front.exists = true;
+        front.lo = lo;
+        front.hi = hi;
+        front.match.assign(size, no_offset);
+        front.insertion.assign(size, no_offset);
+        front.deletion.assign(size, no_offset);
+    }
+
+    //!\brief Returns whether the wavefront reached the last cell of the alignment matrix.
+    bool reaches_end(wavefront const & front, int32_t const last_diagonal) const noexcept
+    {
+        return front.exists && offset(&front, &wavefront::match, last_diagonal) == columns;
+    }
+
+    //!\brief The offsets of the three components on one diagonal before the matches are extended.
+    struct candidates
+    {
+        //!\brief The offset after a mismatch.
+        int32_t mismatch;
+        //!\brief The offset after opening an insertion.
+        int32_t insertion_open;
+        //!\brief The offset after extending an insertion.
+        int32_t insertion_extend;
+        //!\brief The offset after opening a deletion.
+        int32_t deletion_open;
+        //!\brief The offset after extending a deletion.
+        int32_t deletion_extend;
+
+        //!\brief The offset of the alignments ending with a gap in the second sequence.
+        int32_t insertion() const noexcept
+        {
+            return std::max(insertion_open, insertion_extend);
+        }
+
+        //!\brief The offset of the alignments ending with a gap in the first sequence.
+        int32_t deletion() const noexcept
+        {
+            return std::max(deletion_open, deletion_extend);
+        }
+
+        //!\brief The offset of the alignments ending in a match or mismatch column or a gap.
+        int32_t match() const noexcept
+        {
+            return std::max({mismatch, insertion(), deletion()});
+        }
+    };
+
+    //!\brief The wavefronts a wavefront is computed from.
+    struct sources
+    {
+        //!\brief The wavefront whose penalty is less by the mismatch penalty.
+        wavefront const * mismatch;
+        //!\brief The wavefront whose penalty is less by the gap open and gap extension penalty.
+        wavefront const * open;
+        //!\brief The wavefront whose penalty is less by the gap extension penalty.
+        wavefront const * extend;
+    };
+
+    //!\brief Returns the wavefronts the wavefront of the given penalty is computed from.
+    sources find_sources(int64_t const penalty) const noexcept
+    {
+        return sources{find(penalty - mismatch_penalty),
+                       find(penalty - gap_open_penalty - gap_extension_penalty),
+                       find(penalty - gap_extension_penalty)};
+    }
+
+    //!\brief Returns the candidates for the cell on the given diagonal.
+    candidates compute_candidates(sources const & from, int32_t const diagonal) const noexcept
+    {
+        return candidates
+        {
+            validate(offset(from.mismatch, &wavefront::match, diagonal) + 1, diagonal),
+            validate(offset(from.open, &wavefront::match, diagonal - 1) + 1, diagonal),
+            validate(offset(from.extend, &wavefront::insertion, diagonal - 1) + 1, diagonal),
+            validate(offset(from.open, &wavefront::match, diagonal + 1), diagonal),
+            validate(offset(from.extend, &wavefront::deletion, diagonal + 1), diagonal)
+        };
+    }
+
+    /*!\brief Computes the wavefront of the given penalty from the previous ones and extends its matches.
+     * \param penalty The penalty of the wavefront.
+     * \param extend  Extends an offset on a diagonal along the matching characters.
+     */
+    template <typename extend_t>
+    void compute_wavefront(size_t const penalty, extend_t && extend)
+    {
+        sources const from = find_sources(penalty);
+
+        wavefront & front = slot(penalty);
+        front.exists = false;
+
+        if (from.mismatch == nullptr && from.open == nullptr && from.extend == nullptr)
+            return;
+
+        // Only a gap moves to a neighbouring diagonal.
+        int32_t lo = std::numeric_limits<int32_t>::max();
+        int32_t hi = std::numeric_limits<int32_t>::lowest();
+        if (from.mismatch != nullptr)
+        {
+            lo = from.mismatch->lo;
+            hi = from.mismatch->hi;
+        }
+
+        for (wavefront const * source : {from.open, from.extend})
+        {
+            if (source != nullptr)
+            {
+                lo = std::min(lo, source->lo - 1);
+                hi = std::max(hi, source->hi + 1);
+            }
+        }
+        lo = std::max(lo, -rows);
+        hi = std::min(hi, columns);
+
+        initialise_wavefront(front, lo, hi);
+        for (int32_t diagonal = lo; diagonal <= hi; ++diagonal)
+        {
+            candidates const cell = compute_candidates(from, diagonal);
+            size_t const index = diagonal - lo;
+
+            front.insertion[index] = cell.insertion();
+            front.deletion[index] = cell.deletion();
+            front.match[index] = (cell.match() == no_offset) ? no_offset : extend(cell.match(), diagonal);
+        }
+    }
+
+    //!\brief Follows the stored wavefronts from the last cell back to the first cell.
+    std::vector<trace_directions> compute_trace(size_t penalty, int32_t diagonal) const
+    {
+        enum struct component { match, insertion, deletion };
+
+        std::vector<trace_directions> trace{};
+        int32_t current_offset = columns;
+        component current = component::match;
+
+        for (;;)
+        {
+            if (current == component::match)
+            {
+                if (penalty == 0)
+                {
+                    trace.insert(trace.end(), current_offset, trace_directions::diagonal);
+                    break;
+                }
+
+                candidates const cell = compute_candidates(find_sources(penalty), diagonal);
+                int32_t const before_extension = cell.match();
+                trace.insert(trace.end(), current_offset - before_extension, trace_directions::diagonal);
+                current_offset = before_extension;
+
+                if (cell.mismatch == before_extension)
+                {
+                    trace.push_back(trace_directions::diagonal);
+                    --current_offset;
+                    penalty -= mismatch_penalty;
+                }
+                else
+                {
+                    current = (cell.insertion() == before_extension) ? component::insertion : component::deletion;
+                }
+            }
+            else if (current == component::insertion)
+            {
+                candidates const cell = compute_candidates(find_sources(penalty), diagonal);
+                trace.push_back(trace_directions::left);
+                --current_offset;
+                --diagonal;
+
+                if (cell.insertion_open == cell.insertion())
+                {
+                    penalty -= gap_open_penalty + gap_extension_penalty;
+                    current = component::match;
+                }
+                else
+                {
+                    penalty -= gap_extension_penalty;
+                }
+            }
+            else
+            {
+                candidates const cell = compute_candidates(find_sources(penalty), diagonal);
+                trace.push_back(trace_directions::up);
+                ++diagonal;
+
+                if (cell.deletion_open == cell.deletion())
+                {
+                    penalty -= gap_open_penalty + gap_extension_penalty;
+                    current = component::match;
+                }
+                else
+                {
+                    penalty -= gap_extension_penalty;
+                }
+            }
+        }
+
+        return trace;
+    }
+
+    //!\brief The score of a match.
+    score_t match_score{};
+    //!\brief The penalty of a mismatch.
+    int64_t mismatch_penalty{};
+    //!\brief The penalty for opening a gap.
+    int64_t gap_open_penalty{};
+    //!\brief The penalty for every character of a gap.
+    int64_t gap_extension_penalty{};
+    //!\brief Whether the trace is computed.
+    bool with_trace{};
+    //!\brief The size of the first sequence.
+    int32_t columns{};
+    //!\brief The size of the second sequence.
+    int32_t rows{};
+    //!\brief The wavefronts of all penalties if the trace is computed, otherwise only the last ones.
+    std::vector<wavefront> wavefronts{};
+};
+
+} // namespace seqan3::detail
@@ -132,7 +132,7 @@ SEQAN3_CONCEPT align_pairwise_single_input =
 //!\cond
 template <typename t>
 SEQAN3_CONCEPT align_pairwise_range_input =
-    std::ranges::forward_range<t> &&
+    std::ranges::input_range<t> &&
     sequence_pair<std::ranges::range_value_t<t>> &&
     ((std::ranges::viewable_range<t> && std::is_lvalue_reference_v<std::ranges::range_reference_t<t>>) ||
      align_pairwise_single_input<std::remove_reference_t<std::ranges::range_reference_t<t>>>);
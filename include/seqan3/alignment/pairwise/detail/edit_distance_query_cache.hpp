@@ -0,0 +1,191 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::edit_distance_query_cache.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/core/type_traits/basic.hpp>
+#include <seqan3/core/type_traits/range.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Keeps the bit masks of the last query of the edit distance, such that consecutive sequence pairs with the
+ *        same query share them.
+ * \ingroup pairwise_alignment
+ * \tparam word_t The type of one machine word; must be unsigned.
+ *
+ * \details
+ *
+ * seqan3::detail::edit_distance_unbanded encodes every symbol of the alphabet as a bit mask over the query positions
+ * in which it occurs. If one query is verified against many database sequences, e.g. a read against its candidate
+ * loci, the bit masks are the same for every pair. This cache compares the query with the bit masks of the last
+ * query, which have exactly one bit set per query position, and only encodes it again if they differ. Otherwise the
+ * shared bit masks are returned without any allocation.
+ *
+ * Comparing the query symbol by symbol is linear in its size. If the caller knows that the last query is still alive,
+ * a query that models std::ranges::contiguous_range and occupies the same memory as the last one is the same query
+ * and is not compared at all.
+ *
+ * A new query is encoded into the memory of the last bit masks if no one else holds them anymore. Bit masks that are
+ * still shared, e.g. with a copy of the cache or a running edit distance, are never modified. A single cache must not
+ * be used concurrently.
+ */
+template <typename word_t>
+class edit_distance_query_cache
+{
+public:
+    static_assert(std::is_unsigned_v<word_t>, "The word type of the edit distance must be unsigned.");
+
+    //!\brief The type of the bit masks.
+    using bit_masks_type = std::vector<word_t>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_query_cache() = default;                                              //!< Defaulted.
+    edit_distance_query_cache(edit_distance_query_cache const &) = default;             //!< Defaulted.
+    edit_distance_query_cache(edit_distance_query_cache &&) = default;                  //!< Defaulted.
+    edit_distance_query_cache & operator=(edit_distance_query_cache const &) = default; //!< Defaulted.
+    edit_distance_query_cache & operator=(edit_distance_query_cache &&) = default;      //!< Defaulted.
+    ~edit_distance_query_cache() = default;                                             //!< Defaulted.
+    //!\}
+
+    /*!\brief Returns the bit masks of the given query, encoding it only if it differs from the last query.
+     * \tparam query_t The type of the query; must model std::ranges::forward_range and std::ranges::sized_range.
+     * \param[in] query            The query sequence.
+     * \param[in] last_query_alive Whether the last query is guaranteed to be alive, such that a query in the same
+     *                             memory is the same query; defaults to `false`.
+     * \returns A shared pointer to the bit masks of the query (see #encode).
+     */
+    template <std::ranges::forward_range query_t>
+    //!\cond
+        requires std::ranges::sized_range<query_t>
+    //!\endcond
+    std::shared_ptr<bit_masks_type const> bit_masks(query_t && query, bool const last_query_alive = false)
+    {
+        if (!(last_query_alive && is_same_memory(query)) && !is_cached(query))
+        {
+            if (cached_bit_masks == nullptr || cached_bit_masks.use_count() > 1)
+                cached_bit_masks = std::make_shared<bit_masks_type>();
+
+            encode_into(query, *cached_bit_masks);
+            query_size = std::ranges::size(query);
+        }
+
+        if constexpr (std::ranges::contiguous_range<query_t>)
+            query_data = std::ranges::data(query);
+        else
+            query_data = nullptr;
+
+        return cached_bit_masks;
+    }
+
+    /*!\brief Encodes the query as one bit mask per symbol of the alphabet.
+     * \tparam query_t The type of the query; must model std::ranges::forward_range and std::ranges::sized_range.
+     * \param[in] query The query sequence.
+     * \returns The bit masks.
+     *
+     * \details
+     *
+     * The query is split into blocks of one machine word. The bit mask of a symbol with rank `r` occupies the words
+     * `[r * block_count, (r + 1) * block_count)` and has a bit set at every position of the query with this symbol.
+     * The bit masks of the alphabet are followed by one additional, empty bit mask.
+     */
+    template <std::ranges::forward_range query_t>
+    //!\cond
+        requires std::ranges::sized_range<query_t>
+    //!\endcond
+    static bit_masks_type encode(query_t && query)
+    {
+        bit_masks_type masks{};
+        encode_into(query, masks);
+        return masks;
+    }
+
+private:
+    //!\brief The number of words per bit mask of a query of the given size.
+    static constexpr size_t block_count(size_t const query_size) noexcept
+    {
+        return (query_size - 1u + sizeof_bits<word_t>) / sizeof_bits<word_t>;
+    }
+
+    //!\brief Encodes the query into the given bit masks, keeping their capacity (see #encode).
+    template <typename query_t>
+    static void encode_into(query_t && query, bit_masks_type & masks)
+    {
+        using query_alphabet_t = remove_cvref_t<reference_t<query_t>>;
+        constexpr size_t word_size = sizeof_bits<word_t>;
+
+        size_t const blocks = block_count(std::ranges::size(query));
+        masks.assign((alphabet_size<query_alphabet_t> + 1u) * blocks, 0u);
+
+        size_t position = 0u;
+        for (auto && symbol : query)
+        {
+            masks[blocks * seqan3::to_rank(symbol) + position / word_size] |= word_t{1u} << (position % word_size);
+            ++position;
+        }
+    }
+
+    //!\brief Whether the given query occupies the memory of the last query, whose bit masks are cached.
+    template <typename query_t>
+    bool is_same_memory(query_t && query) const noexcept
+    {
+        if constexpr (std::ranges::contiguous_range<query_t>)
+        {
+            return cached_bit_masks != nullptr && query_data != nullptr && query_data == std::ranges::data(query) &&
+                   static_cast<size_t>(std::ranges::size(query)) == query_size;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    //!\brief Whether the bit masks of the given query are cached, i.e. every symbol has its bit set in the cache.
+    template <typename query_t>
+    bool is_cached(query_t && query) const
+    {
+        if (cached_bit_masks == nullptr || static_cast<size_t>(std::ranges::size(query)) != query_size)
+            return false;
+
+        constexpr size_t word_size = sizeof_bits<word_t>;
+        size_t const blocks = block_count(query_size);
+        bit_masks_type const & masks = *cached_bit_masks;
+
+        size_t position = 0u;
+        for (auto && symbol : query)
+        {
+            if (!(masks[blocks * seqan3::to_rank(symbol) + position / word_size] >> (position % word_size) & 1u))
+                return false;
+            ++position;
+        }
+
+        return true;
+    }
+
+    //!\brief The size of the last query.
+    size_t query_size{};
+    //!\brief The memory of the last query if it models std::ranges::contiguous_range, otherwise `nullptr`.
+    void const * query_data{nullptr};
+    //!\brief The bit masks of the last query.
+    std::shared_ptr<bit_masks_type> cached_bit_masks{};
+};
+
+} // namespace seqan3::detail
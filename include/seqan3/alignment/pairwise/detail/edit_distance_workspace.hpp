@@ -0,0 +1,39 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::edit_distance_workspace.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace seqan3::detail
+{
+
+/*!\brief The memory of the column state of seqan3::detail::edit_distance_unbanded.
+ * \ingroup pairwise_alignment
+ * \tparam word_t The type of one machine word.
+ *
+ * \details
+ *
+ * seqan3::detail::edit_distance_unbanded is constructed for every sequence pair. It takes the workspace on
+ * construction and hands it back with seqan3::detail::edit_distance_unbanded::release_workspace, such that the
+ * caller can pass it on to the instance of the next sequence pair and the vectors are only allocated once.
+ */
+template <typename word_t>
+struct edit_distance_workspace
+{
+    //!\brief The memory of the vertical positive delta.
+    std::vector<word_t> vp{};
+    //!\brief The memory of the vertical negative delta.
+    std::vector<word_t> vn{};
+};
+
+} // namespace seqan3::detail
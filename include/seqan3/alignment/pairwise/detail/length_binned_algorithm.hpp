@@ -0,0 +1,146 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::length_binned_algorithm.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+//!\brief Dereferences an iterator into the chunk of a seqan3::detail::length_binned_algorithm.
+//!\ingroup pairwise_alignment
+struct length_binned_dereference
+{
+    //!\brief Returns the indexed sequence pair the iterator points to.
+    template <typename iterator_t>
+    decltype(auto) operator()(iterator_t const & it) const
+    {
+        return *it;
+    }
+};
+
+/*!\brief The range over the sequence pairs of one simd batch of a seqan3::detail::length_binned_algorithm.
+ * \ingroup pairwise_alignment
+ * \tparam indexed_sequence_pair_chunk_t The type of the chunk; must model seqan3::detail::indexed_sequence_pair_range.
+ */
+template <typename indexed_sequence_pair_chunk_t>
+using length_binned_batch_t =
+    decltype(std::declval<std::ranges::subrange<typename std::vector<std::ranges::iterator_t<
+                                                    indexed_sequence_pair_chunk_t>>::iterator>>() |
+             std::views::transform(length_binned_dereference{}));
+
+/*!\brief Computes a chunk of sequence pairs in simd batches of similar length.
+ * \ingroup pairwise_alignment
+ * \implements std::invocable
+ * \tparam result_value_t The value type of the returned seqan3::alignment_result.
+ * \tparam algorithm_t    The type-erased vectorised alignment algorithm; must be a std::function invocable with a
+ *                        seqan3::detail::length_binned_batch_t.
+ *
+ * \details
+ *
+ * The vectorised alignment pads all sequence pairs of a batch to the longest sequences of the batch. This wrapper
+ * sorts the sequence pairs of a chunk by the length of their longer sequence and passes consecutive runs of at most
+ * #lanes pairs to the wrapped algorithm, such that pairs of similar length share a simd vector. The results are stored
+ * at the position of their sequence pair, i.e. they are returned in the order of the chunk.
+ */
+template <typename result_value_t, typename algorithm_t>
+class length_binned_algorithm
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    length_binned_algorithm() = default; //!< Defaulted.
+    length_binned_algorithm(length_binned_algorithm const &) = default; //!< Defaulted.
+    length_binned_algorithm(length_binned_algorithm &&) = default; //!< Defaulted.
+    length_binned_algorithm & operator=(length_binned_algorithm const &) = default; //!< Defaulted.
+    length_binned_algorithm & operator=(length_binned_algorithm &&) = default; //!< Defaulted.
+    ~length_binned_algorithm() = default; //!< Defaulted.
+
+    /*!\brief Constructs the wrapper from the vectorised algorithm.
+     * \param algorithm The vectorised alignment algorithm.
+     * \param lanes     The number of sequence pairs that are computed at once by `algorithm`.
+     */
+    length_binned_algorithm(algorithm_t algorithm, size_t const lanes) :
+        algorithm{std::move(algorithm)},
+        lanes{lanes}
+    {
+        assert(lanes > 0u);
+    }
+    //!\}
+
+    /*!\brief Computes the alignments of the given chunk.
+     * \tparam indexed_sequence_pairs_t The type of the chunk; must model seqan3::detail::indexed_sequence_pair_range.
+     * \param[in] indexed_sequence_pairs The chunk over indexed sequence pairs with consecutive indices.
+     * \returns A std::vector over seqan3::alignment_result in the order of the chunk.
+     */
+    template <typename indexed_sequence_pairs_t>
+    std::vector<alignment_result<result_value_t>> operator()(indexed_sequence_pairs_t indexed_sequence_pairs)
+    {
+        using std::get;
+        using chunk_iterator_t = std::ranges::iterator_t<indexed_sequence_pairs_t>;
+
+        std::vector<chunk_iterator_t> sorted_pairs{};
+        for (auto it = std::ranges::begin(indexed_sequence_pairs); it != std::ranges::end(indexed_sequence_pairs); ++it)
+            sorted_pairs.push_back(it);
+
+        std::vector<alignment_result<result_value_t>> results(sorted_pairs.size());
+
+        if (sorted_pairs.empty())
+            return results;
+
+        size_t const first_index = get<1>(*sorted_pairs.front());
+
+        auto sequence_size = [] (chunk_iterator_t const & it)
+        {
+            auto && [sequence_pair, idx] = *it;
+            return std::max<size_t>(std::ranges::distance(get<0>(sequence_pair)),
+                                    std::ranges::distance(get<1>(sequence_pair)));
+        };
+
+        std::stable_sort(sorted_pairs.begin(), sorted_pairs.end(), [&] (auto const & lhs, auto const & rhs)
+        {
+            return sequence_size(lhs) < sequence_size(rhs);
+        });
+
+        for (auto batch_begin = sorted_pairs.begin(); batch_begin != sorted_pairs.end();)
+        {
+            auto batch_end = batch_begin + std::min<std::ptrdiff_t>(lanes, sorted_pairs.end() - batch_begin);
+
+            for (auto && batch_result : algorithm(std::ranges::subrange{batch_begin, batch_end} |
+                                                  std::views::transform(length_binned_dereference{})))
+            {
+                assert(batch_result.id() - first_index < results.size());
+                results[batch_result.id() - first_index] = std::move(batch_result);
+            }
+
+            batch_begin = batch_end;
+        }
+
+        return results;
+    }
+
+private:
+    //!\brief The wrapped vectorised alignment algorithm.
+    algorithm_t algorithm{};
+    //!\brief The number of sequence pairs per batch.
+    size_t lanes{1u};
+};
+
+} // namespace seqan3::detail
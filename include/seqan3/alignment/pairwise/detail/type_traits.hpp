@@ -12,6 +12,9 @@
 
 #pragma once
 
+#include <type_traits>
+#include <vector>
+
 #include <seqan3/alignment/configuration/all.hpp>
 #include <seqan3/alignment/matrix/trace_directions.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
@@ -22,6 +25,7 @@
 #include <seqan3/core/type_traits/template_inspection.hpp>
 #include <seqan3/range/views/chunk.hpp>
 #include <seqan3/range/views/zip.hpp>
+#include <seqan3/std/concepts>
 #include <seqan3/std/ranges>
 
 namespace seqan3::detail
@@ -31,22 +35,34 @@ namespace seqan3::detail
  * \ingroup pairwise_alignment
  * \implements seqan3::transformation_trait
  *
- * \tparam sequence_pairs_t The type of the sequences to be transformed; must model seqan3::detail::sequence_pair_range.
+ * \tparam sequence_pairs_t The type of the sequences to be transformed; must model std::ranges::input_range over
+ *                          seqan3::detail::sequence_pair.
  *
  * \details
  *
  * This transformation trait transforms a range over sequence pairs into a range over indexed sequence pairs.
  * In addition, the range is chunked which is the common interface for alignment algorithms.
  * The returned type models seqan3::detail::indexed_sequence_pair_range.
+ *
+ * If the range does not model std::ranges::forward_range, the sequence pairs are buffered in a std::vector over its
+ * value type by seqan3::detail::alignment_executor_two_way, which is chunked instead.
  */
 template <typename sequence_pairs_t>
 //!\cond
-    requires sequence_pair_range<std::remove_reference_t<sequence_pairs_t>>
+    requires std::ranges::input_range<std::remove_reference_t<sequence_pairs_t>> &&
+             sequence_pair<std::ranges::range_value_t<std::remove_reference_t<sequence_pairs_t>>>
 //!\endcond
 struct chunked_indexed_sequence_pairs
 {
+private:
+    //!\brief The range that is chunked; a buffer of the sequence pairs if the range is single-pass.
+    using chunked_range_type =
+        std::conditional_t<std::ranges::forward_range<std::remove_reference_t<sequence_pairs_t>>,
+                           sequence_pairs_t,
+                           std::vector<std::ranges::range_value_t<std::remove_reference_t<sequence_pairs_t>>> &>;
+public:
     //!\brief The transformed type that models seqan3::detail::indexed_sequence_pair_range.
-    using type = decltype(views::zip(std::declval<sequence_pairs_t>(), std::views::iota(0)) | views::chunk(1));
+    using type = decltype(views::zip(std::declval<chunked_range_type>(), std::views::iota(0)) | views::chunk(1));
 };
 
 /*!\brief A traits type for the alignment algorithm that exposes static information stored within the alignment
@@ -65,6 +81,8 @@ struct alignment_configuration_traits
     static constexpr bool is_vectorised = config_t::template exists<remove_cvref_t<decltype(align_cfg::vectorise)>>();
     //!\brief Flag indicating whether parallel alignment mode is enabled.
     static constexpr bool is_parallel = config_t::template exists<align_cfg::parallel>();
+    //!\brief Flag indicating whether the alignments are computed on a persistent seqan3::thread_pool.
+    static constexpr bool uses_thread_pool = config_t::template exists<align_cfg::thread_pool>();
     //!\brief Flag indicating whether global alignment mode is enabled.
     static constexpr bool is_global = config_t::template exists<align_cfg::mode<detail::global_alignment_type>>();
     //!\brief Flag indicating whether global alignment mode with free ends is enabled.
@@ -75,6 +93,14 @@ struct alignment_configuration_traits
     static constexpr bool is_banded = config_t::template exists<align_cfg::band>();
     //!\brief Flag indicating whether debug mode is enabled.
     static constexpr bool is_debug = config_t::template exists<detail::debug_mode>();
+    //!\brief Flag indicating whether the X-drop extension mode is enabled.
+    static constexpr bool is_x_drop = config_t::template exists<align_cfg::x_drop>();
+    //!\brief Flag indicating whether cells that cannot reach a minimal score are dropped.
+    static constexpr bool uses_min_score = config_t::template exists<align_cfg::min_score>();
+    //!\brief Flag indicating whether the wavefront alignment algorithm is selected.
+    static constexpr bool is_wavefront = config_t::template exists<detail::wavefront_tag>();
+    //!\brief Flag indicating whether the algorithm collects seqan3::alignment_statistics.
+    static constexpr bool collects_statistics = config_t::template exists<align_cfg::statistics>();
 
     //!\brief The configured alignment mode.
     using alignment_mode_t = decltype(get<align_cfg::mode>(std::declval<config_t>()).value);
@@ -88,8 +114,16 @@ struct alignment_configuration_traits
     using original_score_t = typename result_t::score_type;
     //!\brief The score type for the alignment algorithm.
     using score_t = std::conditional_t<is_vectorised, simd_type_t<original_score_t>, original_score_t>;
-    //!\brief The trace directions type for the alignment algorithm.
-    using trace_t = std::conditional_t<is_vectorised, simd_type_t<original_score_t>, trace_directions>;
+    /*!\brief The trace directions type for the alignment algorithm.
+     *
+     * \details
+     *
+     * In vectorised mode the trace directions are stored in a simd vector over `int8_t` with the same number of
+     * elements as seqan3::detail::alignment_configuration_traits::score_t, which keeps the trace matrix compact.
+     */
+    using trace_t = std::conditional_t<is_vectorised,
+                                       simd_type_t<int8_t, simd_traits<simd_type_t<original_score_t>>::length>,
+                                       trace_directions>;
 
     //!\brief The number of alignments that can be computed in one simd vector.
     static constexpr size_t alignments_per_vector = [] () constexpr
@@ -99,6 +133,26 @@ struct alignment_configuration_traits
                                                         else
                                                             return 1;
                                                     }();
+    /*!\brief Flag indicating whether the score type of the vectorised alignment is adapted to every sequence pair.
+     *
+     * \details
+     *
+     * Only enabled if seqan3::align_cfg::adaptive_score_width is set in vectorised mode and the original score type is
+     * an integral type wider than `int8_t`.
+     */
+    static constexpr bool is_score_width_adaptive =
+        is_vectorised && config_t::template exists<remove_cvref_t<decltype(align_cfg::adaptive_score_width)>>() &&
+        std::integral<original_score_t> && (sizeof(original_score_t) > sizeof(int8_t));
+    //!\brief The number of sequence pairs that are passed to the alignment algorithm at once.
+    static constexpr size_t alignments_per_chunk = [] () constexpr
+                                                   {
+                                                       if constexpr (is_score_width_adaptive)
+                                                           return simd_traits<simd_type_t<int8_t>>::length;
+                                                       else
+                                                           return alignments_per_vector;
+                                                   }();
+    //!\brief Flag indicating whether the sequence pairs of a vectorised alignment are grouped by their length.
+    static constexpr bool is_length_binned = is_vectorised && config_t::template exists<align_cfg::length_binning>();
     //!\brief The rank of the selected result type.
     static constexpr int8_t result_type_rank = static_cast<int8_t>(decltype(std::declval<result_t>().value)::rank);
     //!\brief The padding symbol to use for the computation of the alignment.
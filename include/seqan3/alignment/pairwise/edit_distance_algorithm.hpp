@@ -12,10 +12,24 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <optional>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
+#include <seqan3/alignment/configuration/align_config_statistics.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorise.hpp>
+#include <seqan3/alignment/matrix/detail/reuse_storage.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/edit_distance_query_cache.hpp>
+#include <seqan3/alignment/pairwise/detail/edit_distance_workspace.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded_simd.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
 
 namespace seqan3::detail
 {
@@ -75,6 +89,14 @@ public:
      *
      * Computes for each contained sequence pair the respective alignment and returns all alignment results in a
      * vector.
+     *
+     * If seqan3::align_cfg::vectorise is configured, no band is given and only the score and the back coordinate are
+     * requested, the sequence pairs are computed in batches by seqan3::detail::edit_distance_unbanded_simd.
+     * Sequence pairs whose query does not fit into a single machine word are computed one by one.
+     *
+     * If seqan3::align_cfg::statistics is configured, the whole computation of the given range is measured as matrix
+     * fill. Every pair counts the cells of the machine words that were actually computed, i.e. only the band or the
+     * blocks up to the last active cell, and a batch counts the simd lanes of its longest first sequence.
      */
     template <indexed_sequence_pair_range indexed_sequence_pairs_t>
     constexpr auto operator()(indexed_sequence_pairs_t && indexed_sequence_pairs)
@@ -84,16 +106,166 @@ public:
         using sequence1_t = std::remove_reference_t<std::tuple_element_t<0, sequence_pair_t>>;
         using sequence2_t = std::remove_reference_t<std::tuple_element_t<1, sequence_pair_t>>;
         using alignment_result_value_t = typename align_result_selector<sequence1_t, sequence2_t, config_t>::type;
+        using edit_traits = default_edit_distance_trait_type<sequence1_t &,
+                                                             sequence2_t &,
+                                                             config_t,
+                                                             typename traits_t::is_semi_global_type>;
+        using simd_algorithm_t = edit_distance_unbanded_simd<sequence1_t &, sequence2_t &, config_t, edit_traits>;
+        using sequence_pair_reference_t =
+            std::tuple_element_t<0, std::remove_reference_t<std::ranges::range_reference_t<indexed_sequence_pairs_t>>>;
+
+        // The second sequences are not owned by a temporary sequence pair, hence outlive the iteration over it.
+        constexpr bool references_queries =
+            std::is_lvalue_reference_v<sequence_pair_reference_t> ||
+            std::is_lvalue_reference_v<std::tuple_element_t<1, std::remove_reference_t<sequence_pair_reference_t>>>;
 
         using std::get;
 
+        [[maybe_unused]] auto const fill_start = collects_statistics ? std::chrono::steady_clock::now()
+                                                                     : std::chrono::steady_clock::time_point{};
+        // Counts the matrix allocations only if the statistics are collected.
+        uint64_t allocations{};
+        reuse_storage_allocation_counter const allocation_counter{collects_statistics ? &allocations : nullptr};
+
         std::vector<alignment_result<alignment_result_value_t>> result_vector{};  // Stores the results.
-        for (auto && [sequence_pair, index] : indexed_sequence_pairs)
-            result_vector.push_back(compute_single_pair(index, get<0>(sequence_pair), get<1>(sequence_pair)));
+
+        if constexpr (is_vectorised && !config_t::template exists<align_cfg::band>() && simd_algorithm_t::is_supported)
+        {
+            using indexed_sequence_pair_reference_t = std::ranges::range_reference_t<indexed_sequence_pairs_t>;
+            // Sequence pairs that are returned by value only live until the next iteration, so the batch keeps them.
+            using batch_element_t =
+                std::conditional_t<std::is_lvalue_reference_v<indexed_sequence_pair_reference_t>,
+                                   std::reference_wrapper<std::remove_reference_t<indexed_sequence_pair_reference_t>>,
+                                   remove_cvref_t<indexed_sequence_pair_reference_t>>;
+
+            std::vector<batch_element_t> batch_elements{};
+            std::vector<std::tuple<sequence1_t &, sequence2_t &, size_t>> batch{};
+            batch_elements.reserve(simd_algorithm_t::lanes);
+            batch.reserve(simd_algorithm_t::lanes);
+
+            auto compute_batch = [&] ()
+            {
+                for (std::remove_reference_t<indexed_sequence_pair_reference_t> & element : batch_elements)
+                {
+                    auto & [sequence_pair, index] = element;
+                    batch.emplace_back(get<0>(sequence_pair), get<1>(sequence_pair), index);
+                }
+
+                for (auto && result : simd_algorithm_t{*cfg_ptr}(batch))
+                    result_vector.push_back(std::move(result));
+
+                count_statistics_batch<simd_algorithm_t>(batch);
+
+                batch.clear();
+                batch_elements.clear();
+            };
+
+            for (auto && indexed_sequence_pair : indexed_sequence_pairs)
+            {
+                auto && [sequence_pair, index] = indexed_sequence_pair;
+
+                if (!simd_algorithm_t::fits_into_lane(get<1>(sequence_pair)))
+                {
+                    result_vector.push_back(compute_single_pair(index,
+                                                                get<0>(sequence_pair),
+                                                                get<1>(sequence_pair),
+                                                                references_queries));
+                    continue;
+                }
+
+                batch_elements.emplace_back(std::forward<decltype(indexed_sequence_pair)>(indexed_sequence_pair));
+
+                if (batch_elements.size() == simd_algorithm_t::lanes)
+                    compute_batch();
+            }
+
+            if (!batch_elements.empty())
+                compute_batch();
+
+            // Restore the order of the sequence pairs if some of them were computed one by one.
+            std::sort(result_vector.begin(), result_vector.end(), [] (auto const & lhs, auto const & rhs)
+            {
+                return lhs.id() < rhs.id();
+            });
+        }
+        else
+        {
+            for (auto && [sequence_pair, index] : indexed_sequence_pairs)
+            {
+                result_vector.push_back(compute_single_pair(index,
+                                                            get<0>(sequence_pair),
+                                                            get<1>(sequence_pair),
+                                                            references_queries));
+            }
+        }
+
+        if constexpr (collects_statistics)
+            flush_statistics(result_vector.size(), fill_start, allocations);
 
         return result_vector;
     }
 private:
+    //!\brief Whether seqan3::align_cfg::vectorise is configured.
+    static constexpr bool is_vectorised = config_t::template exists<remove_cvref_t<decltype(align_cfg::vectorise)>>();
+    //!\brief Whether seqan3::align_cfg::statistics is configured.
+    static constexpr bool collects_statistics = config_t::template exists<align_cfg::statistics>();
+
+    /*!\brief Adds the counters of the computed sequence pairs to the configured seqan3::alignment_statistics.
+     * \param[in] alignments  The number of computed sequence pairs.
+     * \param[in] fill_start  The time before the first sequence pair was computed.
+     * \param[in] allocations The number of matrix allocations of the computed sequence pairs.
+     */
+    void flush_statistics(size_t const alignments,
+                          std::chrono::steady_clock::time_point const fill_start,
+                          uint64_t const allocations) noexcept
+    {
+        statistics_record.alignments += alignments;
+        statistics_record.allocations += allocations;
+        statistics_record.fill_time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                           std::chrono::steady_clock::now() - fill_start);
+        statistics_record.flush(*seqan3::get<align_cfg::statistics>(*cfg_ptr).value);
+    }
+
+    //!\brief Counts the cells of the given number of computed machine words.
+    constexpr void count_statistics_blocks([[maybe_unused]] size_t const blocks,
+                                           [[maybe_unused]] size_t const word_size) noexcept
+    {
+        if constexpr (collects_statistics)
+            statistics_record.cells += blocks * word_size;
+    }
+
+    /*!\brief Counts the cells and the simd lanes of a batch computed by seqan3::detail::edit_distance_unbanded_simd.
+     * \tparam simd_algorithm_t The type of the vectorised edit distance.
+     * \tparam batch_t          The type of the batch of sequence pairs.
+     * \param[in] batch The computed batch.
+     *
+     * \details
+     *
+     * Every lane computes one machine word per symbol of the longest first sequence of the batch. The lanes beyond the
+     * end of a shorter first sequence and the lanes of a batch that is smaller than the simd vector are padded.
+     */
+    template <typename simd_algorithm_t, typename batch_t>
+    void count_statistics_batch([[maybe_unused]] batch_t const & batch) noexcept
+    {
+        if constexpr (collects_statistics)
+        {
+            using std::get;
+
+            uint64_t max_size = 0u;
+            uint64_t symbols = 0u;
+            for (auto const & sequence_pair : batch)
+            {
+                uint64_t const size = std::ranges::distance(get<0>(sequence_pair));
+                max_size = std::max(max_size, size);
+                symbols += size;
+            }
+
+            uint64_t const lanes = max_size * simd_algorithm_t::lanes;
+            statistics_record.cells += lanes * simd_algorithm_t::word_size;
+            statistics_record.simd_lanes += lanes;
+            statistics_record.padded_simd_lanes += lanes - symbols;
+        }
+    }
 
     /*!\brief Invokes the actual alignment computation for a single pair of sequences.
      * \tparam    first_range_t  The type of the first sequence (or packed sequences); must model
@@ -103,20 +275,70 @@ private:
      * \param[in] idx            The index of the current sequence pair.
      * \param[in] first_range    The first sequence (or packed sequences).
      * \param[in] second_range   The second sequence (or packed sequences).
+     * \param[in] references_query Whether the second sequence outlives the iteration over its sequence pair.
+     *
+     * \details
+     *
+     * If a seqan3::align_cfg::band is configured, the banded edit distance is used unless the band covers the whole
+     * alignment matrix. In this case the unbanded edit distance computes the same result. The unbanded edit distance
+     * takes the bit masks of the second sequence from #query_cache, such that they are only computed once if
+     * consecutive sequence pairs share the second sequence. Its column state is kept in #workspace between the
+     * sequence pairs.
+     *
+     * The second sequence of the directly preceding sequence pair is still alive if it is referenced: the executor
+     * keeps at least the sequence pairs of the current and the previous window. Then, a second sequence in the same
+     * memory is the same sequence and the cache does not compare it symbol by symbol.
      */
     template <std::ranges::forward_range first_range_t, std::ranges::forward_range second_range_t>
-    constexpr auto compute_single_pair(size_t const idx, first_range_t && first_range, second_range_t && second_range)
+    constexpr auto compute_single_pair(size_t const idx,
+                                       first_range_t && first_range,
+                                       second_range_t && second_range,
+                                       bool const references_query)
     {
         using edit_traits = default_edit_distance_trait_type<first_range_t,
                                                              second_range_t,
                                                              config_t,
                                                              typename traits_t::is_semi_global_type>;
-        edit_distance_unbanded algo{first_range, second_range, *cfg_ptr, edit_traits{}};
-        return algo(idx);
+
+        if constexpr (config_t::template exists<align_cfg::band>())
+        {
+            static_band const & band = get<align_cfg::band>(*cfg_ptr).value;
+
+            if (band.lower_bound > -static_cast<int64_t>(std::ranges::distance(second_range)) ||
+                band.upper_bound < static_cast<int64_t>(std::ranges::distance(first_range)))
+            {
+                edit_distance_banded algo{first_range, second_range, *cfg_ptr, edit_traits{}};
+                auto result = algo(idx);
+                count_statistics_blocks(algo.computed_blocks(), edit_traits::word_size);
+                return result;
+            }
+        }
+
+        bool const last_query_alive = references_query && cached_query_index.has_value() &&
+                                      *cached_query_index + 1u == idx;
+        edit_distance_unbanded algo{first_range,
+                                    second_range,
+                                    *cfg_ptr,
+                                    edit_traits{},
+                                    query_cache.bit_masks(second_range, last_query_alive),
+                                    std::move(workspace)};
+        cached_query_index = idx;
+        auto result = algo(idx);
+        count_statistics_blocks(algo.computed_blocks(), edit_traits::word_size);
+        workspace = algo.release_workspace();
+        return result;
     }
 
     //!\brief The alignment configuration stored on the heap.
     std::shared_ptr<remove_cvref_t<config_t>> cfg_ptr{};
+    //!\brief The bit masks of the last second sequence; every copy of this algorithm has its own.
+    edit_distance_query_cache<uint_fast64_t> query_cache{};
+    //!\brief The index of the sequence pair whose second sequence was passed to #query_cache last.
+    std::optional<size_t> cached_query_index{};
+    //!\brief The memory of the column state of the unbanded edit distance, reused for every sequence pair.
+    edit_distance_workspace<uint_fast64_t> workspace{};
+    //!\brief The counters of the computed sequence pairs that are not yet added to the seqan3::alignment_statistics.
+    std::conditional_t<collects_statistics, alignment_statistics_record, empty_type> statistics_record{};
 };
 
 } // namespace seqan3::detail
@@ -0,0 +1,535 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides a pairwise alignment algorithm for edit distance with a band.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+#include <seqan3/alignment/band/static_band.hpp>
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/alignment_trace_algorithms.hpp>
+#include <seqan3/alignment/matrix/edit_distance_trace_matrix_banded.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_fwd.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief This calculates an alignment using the edit distance and a seqan3::static_band.
+ * \ingroup pairwise_alignment
+ * \tparam database_t     \copydoc default_edit_distance_trait_type::database_type
+ * \tparam query_t        \copydoc default_edit_distance_trait_type::query_type
+ * \tparam align_config_t The configuration type; must be of type seqan3::configuration.
+ * \tparam edit_traits    The traits type; must be of type seqan3::detail::default_edit_distance_trait_type.
+ *
+ * \details
+ *
+ * This is the banded variant of the bit-parallel algorithm of Myers as described by Hyyrö. Instead of storing the
+ * vertical differences of a whole column, only the cells covered by the band are stored. The stored bit-vectors are
+ * aligned to the diagonals, i.e. the bit at position `k` of column `j` corresponds to the cell in row
+ * `j - upper_diagonal + k`. When moving to the next column the band moves one row down, which is achieved by shifting
+ * the vertical differences by one position. Thus, only `(upper_bound - lower_bound + 1) / word_size` machine words
+ * are computed per column independent of the length of the query.
+ *
+ * Cells outside of the band are treated as infinity. The cells above the band and to the left of the band are
+ * emulated by assuming a horizontal respectively vertical difference of `+1`, which can never be part of an
+ * optimal path. Rows above the first row that are covered by the band are filled such that the first row has the
+ * values of the global respectively semi-global initialisation.
+ *
+ * For a global alignment the band must contain the origin and the sink of the matrix and for a semi-global alignment
+ * the band must intersect the first row, otherwise there is no valid alignment.
+ */
+template <std::ranges::viewable_range database_t,
+          std::ranges::viewable_range query_t,
+          typename align_config_t,
+          typename edit_traits>
+class edit_distance_banded
+{
+public:
+    //!\copydoc default_edit_distance_trait_type::word_type
+    using word_type = typename edit_traits::word_type;
+    //!\copydoc default_edit_distance_trait_type::score_type
+    using score_type = typename edit_traits::score_type;
+    //!\copydoc default_edit_distance_trait_type::database_type
+    using database_type = typename edit_traits::database_type;
+    //!\copydoc default_edit_distance_trait_type::query_type
+    using query_type = typename edit_traits::query_type;
+    //!\copydoc default_edit_distance_trait_type::align_config_type
+    using align_config_type = typename edit_traits::align_config_type;
+    //!\copydoc default_edit_distance_trait_type::word_size
+    static constexpr uint8_t word_size = edit_traits::word_size;
+
+private:
+    //!\copydoc default_edit_distance_trait_type::query_alphabet_type
+    using query_alphabet_type = typename edit_traits::query_alphabet_type;
+    //!\copydoc default_edit_distance_trait_type::result_value_type
+    using result_value_type = typename edit_traits::result_value_type;
+    //!\brief The type of the trace matrix.
+    using trace_matrix_type = edit_distance_trace_matrix_banded<word_type, edit_traits::is_semi_global>;
+
+    //!\copydoc default_edit_distance_trait_type::use_max_errors
+    static constexpr bool use_max_errors = edit_traits::use_max_errors;
+    //!\copydoc default_edit_distance_trait_type::is_semi_global
+    static constexpr bool is_semi_global = edit_traits::is_semi_global;
+    //!\copydoc default_edit_distance_trait_type::is_global
+    static constexpr bool is_global = edit_traits::is_global;
+    //!\copydoc default_edit_distance_trait_type::compute_score
+    static constexpr bool compute_score = edit_traits::compute_score;
+    //!\copydoc default_edit_distance_trait_type::compute_back_coordinate
+    static constexpr bool compute_back_coordinate = edit_traits::compute_back_coordinate;
+    //!\copydoc default_edit_distance_trait_type::compute_front_coordinate
+    static constexpr bool compute_front_coordinate = edit_traits::compute_front_coordinate;
+    //!\copydoc default_edit_distance_trait_type::compute_sequence_alignment
+    static constexpr bool compute_sequence_alignment = edit_traits::compute_sequence_alignment;
+    //!\copydoc default_edit_distance_trait_type::compute_trace_matrix
+    static constexpr bool compute_trace_matrix = edit_traits::compute_trace_matrix;
+
+    //!\brief The horizontal/database sequence.
+    database_t database;
+    //!\brief The vertical/query sequence.
+    query_t query;
+    //!\brief The configuration.
+    align_config_t config;
+
+    //!\brief The upper diagonal of the band clipped to the alignment matrix.
+    int64_t upper_diagonal{};
+    //!\brief The lower diagonal of the band clipped to the alignment matrix.
+    int64_t lower_diagonal{};
+    //!\brief The number of cells covered by the band in one column.
+    size_t band_size{};
+    //!\brief The number of machine words needed to store one banded column.
+    size_t block_count{};
+    //!\brief The number of machine words needed to store the bit mask of one symbol.
+    size_t mask_block_count{};
+    //!\brief Whether the band contains a path that forms a valid alignment.
+    bool has_valid_band{};
+    //!\brief The number of columns of the database that were computed.
+    size_t computed_columns{};
+
+    //!\brief Which score value is considered as a hit? Only used if #use_max_errors is true.
+    score_type max_errors{};
+    //!\brief The score of the first cell of the band in the current column.
+    score_type _top_score{};
+    //!\brief The best score found in the last row.
+    score_type _best_score{};
+    //!\brief The column of the best score found in the last row.
+    size_t _best_score_col{};
+    //!\brief Whether the last row was reached within the band.
+    bool _has_best_score{};
+
+    //!\brief The machine words which store the positive vertical differences of the current banded column.
+    std::vector<word_type> vp{};
+    //!\brief The machine words which store the negative vertical differences of the current banded column.
+    std::vector<word_type> vn{};
+    //!\brief The machine words which store the positive horizontal differences of the current banded column.
+    std::vector<word_type> hp{};
+    //!\brief The machine words which store if trace_directions::diagonal is true in the current banded column.
+    std::vector<word_type> db{};
+    /*!\brief The machine words which translate a letter of the query into a bit mask.
+     *
+     * \details
+     *
+     * The bit at position `e` corresponds to the row `e - upper_diagonal`, such that the band of column `j` can be
+     * read starting at bit `j`. The rows above the first row are set for semi-global alignments in order to keep the
+     * first row at zero.
+     */
+    std::vector<word_type> bit_masks{};
+
+    //!\brief The trace matrix if needed.
+    trace_matrix_type _trace_matrix{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+     //!\brief The class template parameter may resolve to an lvalue reference which prohibits default constructibility.
+     edit_distance_banded() = delete;
+     edit_distance_banded(edit_distance_banded const &) = default;             //!< Defaulted.
+     edit_distance_banded(edit_distance_banded &&) = default;                  //!< Defaulted.
+     edit_distance_banded & operator=(edit_distance_banded const &) = default; //!< Defaulted.
+     edit_distance_banded & operator=(edit_distance_banded &&) = default;      //!< Defaulted.
+     ~edit_distance_banded() = default;                                        //!< Defaulted.
+
+    /*!\brief Constructor
+     * \param[in] _database \copydoc database
+     * \param[in] _query    \copydoc query
+     * \param[in] _config   \copydoc config
+     * \param[in] _traits   The traits object. Only the type information will be used.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band does not intersect with the alignment matrix.
+     */
+    edit_distance_banded(database_t _database,
+                         query_t _query,
+                         align_config_t _config,
+                         edit_traits const & SEQAN3_DOXYGEN_ONLY(_traits) = edit_traits{}) :
+        database{std::forward<database_t>(_database)},
+        query{std::forward<query_t>(_query)},
+        config{std::forward<align_config_t>(_config)}
+    {
+        static constexpr size_t alphabet_size_ = alphabet_size<query_alphabet_type>;
+
+        int64_t const database_size = std::ranges::size(database);
+        int64_t const query_size = std::ranges::size(query);
+        static_band const & band = get<align_cfg::band>(config).value;
+
+        if (band.lower_bound > database_size)
+            throw invalid_alignment_configuration{"Invalid band error: The lower bound excludes the whole alignment "
+                                                  "matrix."};
+
+        if (band.upper_bound < -query_size)
+            throw invalid_alignment_configuration{"Invalid band error: The upper bound excludes the whole alignment "
+                                                  "matrix."};
+
+        if constexpr(use_max_errors)
+            max_errors = edit_traits::max_errors_of(config);
+
+        // Diagonals outside of the alignment matrix can never be reached.
+        upper_diagonal = std::min<int64_t>(band.upper_bound, database_size);
+        lower_diagonal = std::max<int64_t>(band.lower_bound, -query_size);
+
+        has_valid_band = upper_diagonal >= 0;
+        if constexpr(is_global)
+            has_valid_band = has_valid_band && lower_diagonal <= 0 &&
+                             lower_diagonal <= database_size - query_size &&
+                             database_size - query_size <= upper_diagonal;
+
+        if (!has_valid_band)
+            return;
+
+        band_size = upper_diagonal - lower_diagonal + 1;
+        block_count = (band_size - 1u + word_size) / word_size;
+        // One additional block to read the band of the last column at an arbitrary bit offset.
+        mask_block_count = (upper_diagonal + query_size) / word_size + block_count + 1u;
+
+        vp.resize(block_count, 0u);
+        vn.resize(block_count, 0u);
+        bit_masks.resize(alphabet_size_ * mask_block_count, 0u);
+
+        // encoding the rows above the first row as matches for semi-global alignments
+        if constexpr(is_semi_global)
+        {
+            for (size_t i = 0u; i < alphabet_size_; ++i)
+                for (int64_t e = 0; e <= upper_diagonal; ++e)
+                    bit_masks[i * mask_block_count + e / word_size] |= word_type{1u} << (e % word_size);
+        }
+
+        // encoding the letters as bit-vectors
+        for (size_t j = 0u; j < std::ranges::size(query); j++)
+        {
+            size_t const e = upper_diagonal + j + 1u;
+            size_t const i = mask_block_count * seqan3::to_rank(query[j]) + e / word_size;
+            bit_masks[i] |= word_type{1u} << (e % word_size);
+        }
+
+        // The first column has the vertical difference +1 below the first row.
+        for (size_t k = upper_diagonal + 1u; k < band_size; ++k)
+            vp[k / word_size] |= word_type{1u} << (k % word_size);
+
+        if constexpr(compute_trace_matrix)
+        {
+            hp.resize(block_count, 0u);
+            db.resize(block_count, 0u);
+            _trace_matrix = trace_matrix_type{std::ranges::size(query) + 1u,
+                                              upper_diagonal,
+                                              band_size};
+            _trace_matrix.reserve(std::ranges::size(database) + 1u);
+            _trace_matrix.add_column(hp, db, vp);
+        }
+
+        if constexpr(is_semi_global)
+            update_best_score(0u);
+    }
+    //!\}
+
+private:
+    //!\brief Moves the band one row down by shifting the vertical differences of the previous column.
+    void shift_band() noexcept
+    {
+        for (size_t block = 0u; block + 1u < block_count; ++block)
+        {
+            vp[block] = (vp[block] >> 1u) | (vp[block + 1u] << (word_size - 1u));
+            vn[block] = (vn[block] >> 1u) | (vn[block + 1u] << (word_size - 1u));
+        }
+
+        // The cell left of the last cell of the band is outside of the band and is treated as vertical difference +1.
+        word_type const last_cell_mask = word_type{1u} << ((band_size - 1u) % word_size);
+        vp.back() = (vp.back() >> 1u) | last_cell_mask;
+        vn.back() = (vn.back() >> 1u) & ~last_cell_mask;
+    }
+
+    //!\brief Computes the banded column for the given database position.
+    void compute_column(size_t const column, size_t const symbol_offset) noexcept
+    {
+        word_type carry_d0{0u};
+        // The cell above the band is outside of the band and is treated as horizontal difference +1.
+        word_type carry_hp{1u};
+        word_type carry_hn{0u};
+
+        for (size_t block = 0u; block < block_count; ++block)
+        {
+            size_t const bit_position = column + block * word_size;
+            size_t const mask_position = symbol_offset + bit_position / word_size;
+            size_t const offset = bit_position % word_size;
+
+            word_type b = bit_masks[mask_position] >> offset;
+            if (offset != 0u)
+                b |= bit_masks[mask_position + 1u] << (word_size - offset);
+
+            word_type x = b | vn[block];
+            word_type const t = vp[block] + (x & vp[block]) + carry_d0;
+
+            word_type const d0 = (t ^ vp[block]) | x;
+            word_type const hn = vp[block] & d0;
+            word_type const h = vn[block] | ~(vp[block] | d0);
+
+            carry_d0 = (carry_d0 != 0u) ? t <= vp[block] : t < vp[block];
+
+            x = (h << 1u) | carry_hp;
+            vn[block] = x & d0;
+            vp[block] = (hn << 1u) | ~(x | d0) | carry_hn;
+
+            carry_hp = h >> (word_size - 1u);
+            carry_hn = hn >> (word_size - 1u);
+
+            // The first cell of the band continues the diagonal of the first cell of the previous band.
+            if (block == 0u)
+                _top_score += (d0 & word_type{1u}) ? 0 : 1;
+
+            if constexpr(compute_trace_matrix)
+            {
+                hp[block] = h;
+                db[block] = ~(b ^ d0);
+            }
+        }
+    }
+
+    //!\brief Returns the score of the cell at the given position of the current banded column.
+    score_type score_at(size_t const band_position) const noexcept
+    {
+        assert(band_position < band_size);
+
+        int64_t score = _top_score;
+        size_t const last_block = band_position / word_size;
+
+        for (size_t block = 0u; block <= last_block; ++block)
+        {
+            word_type mask = ~word_type{0u};
+            if (block == last_block && (band_position % word_size) + 1u < word_size)
+                mask = (word_type{1u} << ((band_position % word_size) + 1u)) - 1u;
+
+            // The vertical difference of the first cell refers to a cell outside of the band.
+            if (block == 0u)
+                mask &= ~word_type{1u};
+
+            score += popcount(static_cast<word_type>(vp[block] & mask));
+            score -= popcount(static_cast<word_type>(vn[block] & mask));
+        }
+
+        return static_cast<score_type>(score);
+    }
+
+    //!\brief Update the current best known score if the last row of the given column is covered by the band.
+    void update_best_score(size_t const column) noexcept
+    {
+        int64_t const band_position = static_cast<int64_t>(std::ranges::size(query)) -
+                                      static_cast<int64_t>(column) + upper_diagonal;
+
+        if (band_position < 0 || !(static_cast<size_t>(band_position) < band_size))
+            return;
+
+        score_type const score = score_at(band_position);
+        if (!_has_best_score || score <= _best_score)
+        {
+            _best_score = score;
+            _best_score_col = column;
+            _has_best_score = true;
+        }
+    }
+
+    //!\brief Compute the alignment.
+    void compute()
+    {
+        if (!has_valid_band)
+            return;
+
+        size_t const query_size = std::ranges::size(query);
+        size_t column_count = std::ranges::size(database);
+
+        // For semi-global alignments the band leaves the last row after |query| + upper_diagonal columns.
+        if constexpr(is_semi_global)
+            column_count = std::min<size_t>(column_count, query_size + upper_diagonal);
+
+        computed_columns = column_count;
+
+        auto database_it = std::ranges::begin(database);
+        for (size_t column = 1u; column <= column_count; ++column, ++database_it)
+        {
+            shift_band();
+            compute_column(column, mask_block_count * seqan3::to_rank((query_alphabet_type) *database_it));
+
+            if constexpr(is_semi_global)
+                update_best_score(column);
+
+            if constexpr(compute_trace_matrix)
+                _trace_matrix.add_column(hp, db, vp);
+        }
+
+        if constexpr(is_global)
+            update_best_score(column_count);
+    }
+
+    //!\brief Returns true if the computation produced a valid alignment.
+    bool is_valid() const noexcept
+    {
+        if constexpr(use_max_errors)
+            return _has_best_score && _best_score <= max_errors;
+        else
+            return _has_best_score;
+    }
+
+    //!\brief Returns an invalid_coordinate for this alignment.
+    alignment_coordinate invalid_coordinate() const noexcept
+    {
+        return {column_index_type{std::ranges::size(database)}, row_index_type{std::ranges::size(query)}};
+    }
+
+public:
+    /*!\brief The number of machine words of the band that were computed, summed over all computed columns.
+     *
+     * \details
+     *
+     * Every column computes all blocks of the band, each covering #word_size cells. Nothing is computed if the band
+     * contains no valid alignment.
+     */
+    size_t computed_blocks() const noexcept
+    {
+        return computed_columns * block_count;
+    }
+
+    //!\brief Return the score of the alignment.
+    std::optional<score_type> score() const noexcept
+    {
+        if (!is_valid())
+            return std::nullopt;
+
+        return -_best_score;
+    }
+
+    //!\brief Return the end position of the alignment.
+    alignment_coordinate back_coordinate() const noexcept
+    {
+        if (!is_valid())
+            return invalid_coordinate();
+
+        return {column_index_type{_best_score_col}, row_index_type{std::ranges::size(query)}};
+    }
+
+    //!\brief Return the trace matrix of the alignment.
+    trace_matrix_type const & trace_matrix() const noexcept
+    {
+        static_assert(compute_trace_matrix, "trace_matrix() can only be computed if you specify the "
+                                            "result type within your alignment config.");
+        return _trace_matrix;
+    }
+
+    //!\brief Return the begin position of the alignment.
+    alignment_coordinate front_coordinate() const noexcept
+    {
+        static_assert(compute_front_coordinate, "front_coordinate() can only be computed if you specify the "
+                                                "result type within your alignment config.");
+        if (!is_valid())
+            return invalid_coordinate();
+
+        return alignment_front_coordinate(trace_matrix(), back_coordinate());
+    }
+
+    //!\brief Return the alignment, i.e. the actual base pair matching.
+    auto alignment() const noexcept
+    {
+        using alignment_t = decltype(result_value_type{}.alignment);
+
+        static_assert(compute_sequence_alignment, "alignment() can only be computed if you specify the "
+                                                  "result type within your alignment config.");
+
+        if (!is_valid())
+            return alignment_t{};
+
+        return alignment_trace<alignment_t>(database, query, trace_matrix(), back_coordinate(), front_coordinate());
+    }
+
+    /*!\brief Generic invocable interface.
+     * \param[in]     idx The index of the currently processed sequence pair.
+     * \returns A reference to the filled alignment result.
+     */
+    alignment_result<result_value_type> operator()(size_t const idx)
+    {
+        compute();
+        result_value_type res_vt{};
+        res_vt.id = idx;
+        if constexpr (compute_score)
+        {
+            res_vt.score = score().value_or(edit_traits::invalid_score);
+        }
+
+        if constexpr (compute_back_coordinate)
+        {
+            res_vt.back_coordinate = back_coordinate();
+        }
+
+        if constexpr (compute_front_coordinate)
+        {
+            if (is_valid())
+                res_vt.front_coordinate = alignment_front_coordinate(trace_matrix(), res_vt.back_coordinate);
+            else
+                res_vt.front_coordinate = invalid_coordinate();
+        }
+
+        if constexpr (compute_sequence_alignment)
+        {
+            if (is_valid())
+            {
+                using alignment_t = decltype(res_vt.alignment);
+                res_vt.alignment = alignment_trace<alignment_t>(database,
+                                                                query,
+                                                                trace_matrix(),
+                                                                res_vt.back_coordinate,
+                                                                res_vt.front_coordinate);
+            }
+        }
+        return alignment_result<result_value_type>{std::move(res_vt)};
+    }
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::detail::edit_distance_banded
+ * \{
+ */
+
+//!\brief Deduce the type from the provided arguments.
+template <typename database_t, typename query_t, typename config_t>
+edit_distance_banded(database_t && database, query_t && query, config_t config)
+    -> edit_distance_banded<database_t, query_t, config_t>;
+
+//!\brief Deduce the type from the provided arguments.
+template <typename database_t, typename query_t, typename config_t, typename traits_t>
+edit_distance_banded(database_t && database, query_t && query, config_t config, traits_t)
+    -> edit_distance_banded<database_t, query_t, config_t, traits_t>;
+//!\}
+
+} // namespace seqan3::detail
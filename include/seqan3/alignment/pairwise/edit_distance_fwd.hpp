@@ -12,8 +12,12 @@
 
 #pragma once
 
+#include <limits>
+
 #include <seqan3/alignment/configuration/align_config_max_error.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
 #include <seqan3/alignment/configuration/align_config_result.hpp>
+#include <seqan3/alignment/matrix/matrix_concept.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
 #include <seqan3/core/bit_manipulation.hpp>
 #include <seqan3/core/platform.hpp>
@@ -29,6 +33,9 @@ class edit_distance_score_matrix_full; //forward declaration
 template <typename word_t, bool is_semi_global, bool use_max_errors>
 class edit_distance_trace_matrix_full; //forward declaration
 
+template <typename word_t, bool is_semi_global>
+class edit_distance_trace_matrix_checkpointed; //forward declaration
+
 //!\brief Store no state for state_t.
 template <typename state_t, typename ...>
 struct empty_state
@@ -69,7 +76,7 @@ struct default_edit_distance_trait_type
     //!\brief The type of the score.
     static_assert(align_config_type::template exists<align_cfg::result>(), "We assume the result type was configured.");
     using score_type = typename std::remove_reference_t<
-                           decltype(get<align_cfg::result>(align_config_type{}))>::score_type;
+                           decltype(get<align_cfg::result>(std::declval<align_config_type>()))>::score_type;
     //!\brief The type of the database sequence.
     using database_type = std::remove_reference_t<database_t>;
     //!\brief The type of the query sequence.
@@ -86,9 +93,25 @@ struct default_edit_distance_trait_type
     //!\brief The intermediate result type of the execution of this function object.
     using result_value_type = typename align_result_selector<database_type, query_type, align_config_type>::type;
 
+    //!\brief Whether the error bound is given by seqan3::align_cfg::min_score instead of seqan3::align_cfg::max_error.
+    static constexpr bool use_min_score = align_config_type::template exists<align_cfg::min_score>();
     //!\brief When true the computation will use the ukkonen trick with the last active cell and bounds the error to
     //!       config.max_errors.
-    static constexpr bool use_max_errors = align_config_type::template exists<align_cfg::max_error>();
+    static constexpr bool use_max_errors = align_config_type::template exists<align_cfg::max_error>() ||
+                                           use_min_score;
+    //!\brief The score of a sequence pair without an alignment within the error bound.
+    //!\details Is lower than any minimal score if seqan3::align_cfg::min_score is configured.
+    static constexpr score_type invalid_score = use_min_score ? std::numeric_limits<score_type>::lowest()
+                                                              : matrix_inf<score_type>;
+
+    //!\brief Returns the maximal number of errors, i.e. the negated seqan3::align_cfg::min_score if it is configured.
+    static constexpr score_type max_errors_of(align_config_type const & config)
+    {
+        if constexpr (use_min_score)
+            return -static_cast<score_type>(get<align_cfg::min_score>(config).value);
+        else
+            return get<align_cfg::max_error>(config).value;
+    }
     //!\brief Whether the alignment is a semi-global alignment or not.
     static constexpr bool is_semi_global = is_semi_global_t::value;
     //!\brief Whether the alignment is a global alignment or not.
@@ -110,9 +133,17 @@ struct default_edit_distance_trait_type
     static constexpr bool compute_trace_matrix = compute_front_coordinate || compute_sequence_alignment;
     //!\brief Whether the alignment configuration indicates to compute and/or store the score or trace matrix.
     static constexpr bool compute_matrix = compute_score_matrix || compute_trace_matrix;
+    //!\brief Whether the traces of long alignments may be recomputed from checkpoints instead of being stored.
+    //!\details The number of rows of a column depends on the previous columns if #use_max_errors is true.
+    static constexpr bool use_checkpoints = compute_trace_matrix && !use_max_errors;
+    //!\brief The number of machine words of the full trace matrix above which only checkpoints are stored
+    //!       (256 MiB for 64 bit words).
+    static constexpr size_t checkpoint_min_trace_size = size_t{1u} << 25;
 
     //!\brief The type of the trace matrix.
     using trace_matrix_type = edit_distance_trace_matrix_full<word_type, is_semi_global, use_max_errors>;
+    //!\brief The type of the trace matrix that recomputes the traces from checkpoints.
+    using checkpointed_trace_matrix_type = edit_distance_trace_matrix_checkpointed<word_type, is_semi_global>;
     //!\brief The type of the score matrix.
     using score_matrix_type = edit_distance_score_matrix_full<word_type, score_type, is_semi_global, use_max_errors>;
 };
@@ -133,6 +164,12 @@ template <std::ranges::viewable_range database_t,
           typename align_config_t,
           typename traits_t = default_edit_distance_trait_type<database_t, query_t, align_config_t, std::false_type>>
 class edit_distance_unbanded; //forward declaration
+
+template <std::ranges::viewable_range database_t,
+          std::ranges::viewable_range query_t,
+          typename align_config_t,
+          typename traits_t = default_edit_distance_trait_type<database_t, query_t, align_config_t, std::false_type>>
+class edit_distance_banded; //forward declaration
 //!\endcond
 
 } // namespace seqan3::detail
@@ -14,15 +14,24 @@
 
 #include <algorithm>
 #include <bitset>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
 #include <utility>
 
 #include <range/v3/algorithm/copy.hpp>
 
+#include <seqan3/alignment/configuration/align_config_on_hit.hpp>
 #include <seqan3/alignment/matrix/alignment_coordinate.hpp>
 #include <seqan3/alignment/matrix/alignment_trace_algorithms.hpp>
 #include <seqan3/alignment/matrix/edit_distance_score_matrix_full.hpp>
+#include <seqan3/alignment/matrix/edit_distance_trace_matrix_checkpointed.hpp>
 #include <seqan3/alignment/matrix/edit_distance_trace_matrix_full.hpp>
+#include <seqan3/alignment/matrix/detail/reuse_storage.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/edit_distance_query_cache.hpp>
+#include <seqan3/alignment/pairwise/detail/edit_distance_workspace.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_fwd.hpp>
 #include <seqan3/core/algorithm/configuration.hpp>
 #include <seqan3/range/shortcuts.hpp>
@@ -84,7 +93,7 @@ protected:
     {
         derived_t * self = static_cast<derived_t *>(this);
 
-        max_errors = get<align_cfg::max_error>(self->config).value;
+        max_errors = edit_traits::max_errors_of(self->config);
         assert(max_errors >= score_type{0});
 
         if (std::ranges::empty(self->query)) // [[unlikely]]
@@ -149,7 +158,7 @@ protected:
     /*!\brief Use the ukkonen trick and update the last active cell.
      * \returns `true` if computation should be aborted, `false` if computation should continue.
      */
-    bool update_last_active_cell() noexcept
+    bool update_last_active_cell()
     {
         derived_t * self = static_cast<derived_t *>(this);
         // update the last active cell
@@ -522,6 +531,7 @@ protected:
 
     using typename edit_traits::word_type;
     using typename edit_traits::trace_matrix_type;
+    using typename edit_traits::checkpointed_trace_matrix_type;
     using typename edit_traits::result_value_type;
 
     /*!\name Trace matrix Policy: Protected Attributes
@@ -535,6 +545,17 @@ protected:
 
     //!\brief The trace matrix of the edit distance alignment.
     trace_matrix_type _trace_matrix{};
+    //!\brief The trace matrix of the edit distance alignment if #uses_checkpoints is true.
+    checkpointed_trace_matrix_type _checkpointed_trace_matrix{};
+    /*!\brief Whether the traces are recomputed from checkpoints.
+     *
+     * \details
+     *
+     * Is `true` if the full trace matrix would have more than
+     * seqan3::detail::default_edit_distance_trait_type::checkpoint_min_trace_size machine words and
+     * seqan3::detail::default_edit_distance_trait_type::use_checkpoints is `true`.
+     */
+    bool uses_checkpoints{false};
     //!\}
 
     /*!\name Trace matrix Policy: Protected Member Functions
@@ -553,12 +574,42 @@ protected:
     {
         derived_t const * self = static_cast<derived_t const *>(this);
 
-        _trace_matrix = trace_matrix_type{std::ranges::size(self->query) + 1u};
-        _trace_matrix.reserve(std::ranges::size(self->database) + 1u);
+        size_t const rows_size = std::ranges::size(self->query) + 1u;
+        size_t const cols_size = std::ranges::size(self->database) + 1u;
+
+        if constexpr (edit_traits::use_checkpoints)
+        {
+            uses_checkpoints = 3u * block_count * cols_size > edit_traits::checkpoint_min_trace_size;
+
+            if (uses_checkpoints)
+                _checkpointed_trace_matrix = checkpointed_trace_matrix_type{rows_size,
+                                                                            cols_size,
+                                                                            self->bit_masks,
+                                                                            &derived_t::compute_trace_column};
+        }
+
+        if (!uses_checkpoints)
+        {
+            _trace_matrix = trace_matrix_type{rows_size};
+            _trace_matrix.reserve(cols_size);
+        }
 
         hp.resize(block_count, 0u);
         db.resize(block_count, 0u);
     }
+
+    //!\brief Invokes the callable with the trace matrix that stores the traces of the current alignment.
+    template <typename callable_t>
+    auto visit_trace_matrix(callable_t && callable) const
+    {
+        if constexpr (edit_traits::use_checkpoints)
+        {
+            if (uses_checkpoints)
+                return callable(_checkpointed_trace_matrix);
+        }
+
+        return callable(_trace_matrix);
+    }
     //!\}
 
 public:
@@ -566,11 +617,17 @@ public:
      * \copydoc edit_distance_unbanded_trace_matrix_policy
      * \{
      */
-    //!\brief Return the trace matrix of the alignment.
-    trace_matrix_type const & trace_matrix() const noexcept
+    /*!\brief Return the trace matrix of the alignment.
+     * \throws std::logic_error if the traces are recomputed from checkpoints, since the full trace matrix is not
+     *                          stored then.
+     */
+    trace_matrix_type const & trace_matrix() const
     {
         static_assert(edit_traits::compute_trace_matrix, "trace_matrix() can only be computed if you specify the "
                                                          "result type within your alignment config.");
+        if (uses_checkpoints)
+            throw std::logic_error{"The trace matrix is not stored if the traces are recomputed from checkpoints."};
+
         return _trace_matrix;
     }
 
@@ -585,7 +642,7 @@ public:
             return self->invalid_coordinate();
 
         alignment_coordinate const back = self->back_coordinate();
-        return alignment_front_coordinate(trace_matrix(), back);
+        return visit_trace_matrix([&] (auto const & matrix) { return alignment_front_coordinate(matrix, back); });
     }
 
     //!\brief Return the alignment, i.e. the actual base pair matching.
@@ -601,11 +658,13 @@ public:
         if (!self->is_valid())
             return alignment_t{};
 
-        return alignment_trace<alignment_t>(self->database,
-                                            self->query,
-                                            trace_matrix(),
-                                            self->back_coordinate(),
-                                            front_coordinate());
+        return visit_trace_matrix([&] (auto const & matrix)
+        {
+            return alignment_trace_and_front_coordinate<alignment_t>(self->database,
+                                                                     self->query,
+                                                                     matrix,
+                                                                     self->back_coordinate()).first;
+        });
     }
     //!\}
 };
@@ -784,13 +843,21 @@ private:
      * \details
      *
      * Each bit position which is true (= 1) corresponds to a match of a letter in the query at this position.
+     * The bit masks might be shared with other instances that have the same query
+     * (see seqan3::detail::edit_distance_query_cache).
      */
-    std::vector<word_type> bit_masks{};
+    std::shared_ptr<std::vector<word_type> const> bit_masks{};
 
+    //!\brief The index of the sequence pair which is reported to seqan3::align_cfg::on_hit.
+    size_t sequence_pair_id{};
     //!\brief The current position in the database.
     database_iterator database_it{};
     //!\brief The end position of the database.
     database_iterator database_it_end{};
+    //!\brief The distance of #database_it from the begin of the database.
+    size_t database_position{};
+    //!\brief The number of machine words computed so far, summed over all columns (see #computed_blocks).
+    size_t _computed_blocks{};
 
     //!\brief The internal state needed to compute the trace matrix.
     struct compute_state_trace_matrix
@@ -832,7 +899,20 @@ private:
             this->_score_matrix.add_column(vp, vn);
 
         if constexpr(!use_max_errors && compute_trace_matrix)
-            this->_trace_matrix.add_column(this->hp, this->db, vp);
+        {
+            if (this->uses_checkpoints)
+            {
+                // The first column is added before the database is traversed.
+                size_t const rank = (this->_checkpointed_trace_matrix.cols() == 0u)
+                                  ? 0u
+                                  : seqan3::to_rank((query_alphabet_type) *database_it);
+                this->_checkpointed_trace_matrix.add_column(vp, vn, rank);
+            }
+            else
+            {
+                this->_trace_matrix.add_column(this->hp, this->db, vp);
+            }
+        }
 
         if constexpr(use_max_errors && compute_matrix)
         {
@@ -858,27 +938,40 @@ public:
      ~edit_distance_unbanded() = default;                                          //!< Defaulted.
 
     /*!\brief Constructor
-     * \param[in] _database \copydoc database
-     * \param[in] _query    \copydoc query
-     * \param[in] _config   \copydoc config
-     * \param[in] _traits   The traits object. Only the type information will be used.
+     * \param[in] _database  \copydoc database
+     * \param[in] _query     \copydoc query
+     * \param[in] _config    \copydoc config
+     * \param[in] _traits    The traits object. Only the type information will be used.
+     * \param[in] _bit_masks The bit masks of the query as computed by seqan3::detail::edit_distance_query_cache; if
+     *                       `nullptr`, the query is encoded by this instance.
+     * \param[in] _workspace The memory released by a previous instance (see #release_workspace); empty by default.
      */
     edit_distance_unbanded(database_t _database,
                            query_t _query,
                            align_config_t _config,
-                           edit_traits const & SEQAN3_DOXYGEN_ONLY(_traits) = edit_traits{}) :
+                           edit_traits const & SEQAN3_DOXYGEN_ONLY(_traits) = edit_traits{},
+                           std::shared_ptr<std::vector<word_type> const> _bit_masks = nullptr,
+                           edit_distance_workspace<word_type> _workspace = {}) :
         database{std::forward<database_t>(_database)},
         query{std::forward<query_t>(_query)},
         config{std::forward<align_config_t>(_config)},
         _score{static_cast<score_type>(std::ranges::size(query))},
+        vp{std::move(_workspace.vp)},
+        vn{std::move(_workspace.vn)},
+        bit_masks{std::move(_bit_masks)},
         database_it{ranges::begin(database)},
         database_it_end{ranges::end(database)}
     {
-        static constexpr size_t alphabet_size_ = alphabet_size<query_alphabet_type>;
-
         size_t const block_count = (std::ranges::size(query) - 1u + word_size) / word_size;
         score_mask = word_type{1u} << ((std::ranges::size(query) - 1u + word_size) % word_size);
 
+        // encoding the letters as bit-vectors
+        if (bit_masks == nullptr)
+            bit_masks = std::make_shared<std::vector<word_type> const>(
+                            edit_distance_query_cache<word_type>::encode(query));
+
+        assert(bit_masks->size() == (alphabet_size<query_alphabet_type> + 1u) * block_count);
+
         this->score_init();
         if constexpr(use_max_errors)
             this->max_errors_init(block_count);
@@ -886,24 +979,41 @@ public:
         if constexpr(compute_score_matrix)
             this->score_matrix_init();
 
+        // The checkpointed trace matrix shares the bit masks.
         if constexpr(compute_trace_matrix)
             this->trace_matrix_init(block_count);
 
-        vp.resize(block_count, vp0);
-        vn.resize(block_count, vn0);
-        bit_masks.resize((alphabet_size_ + 1u) * block_count, 0u);
-
-        // encoding the letters as bit-vectors
-        for (size_t j = 0u; j < std::ranges::size(query); j++)
-        {
-            size_t const i = block_count * seqan3::to_rank(query[j]) + j / word_size;
-            bit_masks[i] |= word_type{1u} << (j % word_size);
-        }
+        reuse_storage(vp, block_count, vp0);
+        reuse_storage(vn, block_count, vn0);
 
         add_state();
     }
     //!\}
 
+    /*!\brief Moves the memory of the column state out of this instance.
+     * \returns The workspace that can be passed to the instance of the next sequence pair.
+     *
+     * \details
+     *
+     * This instance must not be used for the computation afterwards.
+     */
+    edit_distance_workspace<word_type> release_workspace() noexcept
+    {
+        return {std::move(vp), std::move(vn)};
+    }
+
+    /*!\brief The number of machine words of the query that were computed, summed over all computed columns.
+     *
+     * \details
+     *
+     * With seqan3::align_cfg::max_error only the blocks up to the last active cell are computed, and the computation
+     * might stop before the end of the database. Every block covers #word_size cells.
+     */
+    size_t computed_blocks() const noexcept
+    {
+        return _computed_blocks;
+    }
+
 private:
     //!\brief A single compute step in the current column.
     template <bool with_carry>
@@ -946,13 +1056,44 @@ private:
             state.hp = proxy_reference<word_type>{this->hp[current_block]};
             state.db = proxy_reference<word_type>{this->db[current_block]};
         }
-        state.b = bit_masks[block_offset + current_block];
+        state.b = (*bit_masks)[block_offset + current_block];
 
         compute_step<with_carry>(state);
         if constexpr(compute_trace_matrix)
             state.db = ~(state.b ^ state.d0);
     }
 
+    /*!\brief Computes the traces of a single column for seqan3::detail::edit_distance_trace_matrix_checkpointed.
+     * \param[in]     symbol_bit_masks The bit masks of the database symbol of the column.
+     * \param[in,out] vp               The positive vertical differences of the previous and then the current column.
+     * \param[in,out] vn               The negative vertical differences of the previous and then the current column.
+     * \param[out]    hp               The positive horizontal differences, i.e. the trace_directions::left.
+     * \param[out]    db               The trace_directions::diagonal.
+     *
+     * \details
+     *
+     * Computes every block of the column in the same way as #large_patterns without seqan3::align_cfg::max_error.
+     */
+    static void compute_trace_column(word_type const * symbol_bit_masks,
+                                     std::vector<word_type> & vp,
+                                     std::vector<word_type> & vn,
+                                     word_type * hp,
+                                     word_type * db) noexcept
+    {
+        compute_state state{};
+        for (size_t current_block = 0u; current_block < vp.size(); ++current_block)
+        {
+            state.vp = proxy_reference<word_type>{vp[current_block]};
+            state.vn = proxy_reference<word_type>{vn[current_block]};
+            state.hp = proxy_reference<word_type>{hp[current_block]};
+            state.db = proxy_reference<word_type>{db[current_block]};
+            state.b = symbol_bit_masks[current_block];
+
+            compute_step<true>(state);
+            state.db = ~(state.b ^ state.d0);
+        }
+    }
+
     //!\brief Increase or decrease the score.
     void advance_score(word_type P, word_type N, word_type mask) noexcept
     {
@@ -962,13 +1103,41 @@ private:
             _score--;
     }
 
-    //!\brief Will be called if a hit was found (e.g., score <= max_errors).
-    bool on_hit() noexcept
+    /*!\brief Will be called if a hit was found (e.g., score <= max_errors).
+     * \returns `true` if computation should be aborted, `false` if computation should continue.
+     *
+     * \details
+     *
+     * Invokes the callback of seqan3::align_cfg::on_hit with the end position of the hit in the current column. If
+     * the callback is not configured or the alignment is global, nothing is reported.
+     */
+    bool on_hit()
     {
-        // TODO: call external on_hit functor
+        if constexpr (is_semi_global && align_config_type::template exists<align_cfg::on_hit>())
+        {
+            auto & callback = get<align_cfg::on_hit>(config).value;
+            alignment_coordinate const back_coordinate{column_index_type{database_position + 1u},
+                                                       row_index_type{std::ranges::size(query)}};
+            score_type const score = -_score;
+
+            using callback_result_t = std::invoke_result_t<decltype(callback) &, size_t, alignment_coordinate,
+                                                           score_type>;
+            if constexpr (std::same_as<callback_result_t, void>)
+                std::invoke(callback, sequence_pair_id, back_coordinate, score);
+            else
+                return static_cast<bool>(std::invoke(callback, sequence_pair_id, back_coordinate, score));
+        }
+
         return false;
     }
 
+    //!\brief Moves to the next symbol of the database.
+    void next_database_symbol() noexcept
+    {
+        ++database_it;
+        ++database_position;
+    }
+
     //!\brief Pattern is small enough that it fits into one machine word. Use faster computation with less overhead.
     inline bool small_patterns();
 
@@ -982,7 +1151,7 @@ private:
 
         bool abort_computation = false;
 
-        for (; database_it != database_it_end; ++database_it)
+        for (; database_it != database_it_end; next_database_symbol())
         {
             if constexpr(is_global)
                 ++_score;
@@ -1041,12 +1210,13 @@ public:
      */
     alignment_result<result_value_type> operator()(size_t const idx)
     {
+        sequence_pair_id = idx;
         compute();
         result_value_type res_vt{};
         res_vt.id = idx;
         if constexpr (compute_score)
         {
-            res_vt.score = this->score().value_or(matrix_inf<score_type>);
+            res_vt.score = this->score().value_or(edit_traits::invalid_score);
         }
 
         if constexpr (compute_back_coordinate)
@@ -1054,25 +1224,34 @@ public:
             res_vt.back_coordinate = this->back_coordinate();
         }
 
-        if constexpr (compute_front_coordinate)
+        if constexpr (compute_sequence_alignment)
         {
+            // The front coordinate is found while following the trace, so the trace is followed only once.
             if (this->is_valid())
-                res_vt.front_coordinate = alignment_front_coordinate(this->trace_matrix(), res_vt.back_coordinate);
+            {
+                using alignment_t = decltype(res_vt.alignment);
+                std::tie(res_vt.alignment, res_vt.front_coordinate) = this->visit_trace_matrix([&] (auto const & matrix)
+                {
+                    return alignment_trace_and_front_coordinate<alignment_t>(database,
+                                                                             query,
+                                                                             matrix,
+                                                                             res_vt.back_coordinate);
+                });
+            }
             else
+            {
                 res_vt.front_coordinate = this->invalid_coordinate();
+            }
         }
-
-        if constexpr (compute_sequence_alignment)
+        else if constexpr (compute_front_coordinate)
         {
             if (this->is_valid())
-            {
-                using alignment_t = decltype(res_vt.alignment);
-                res_vt.alignment = alignment_trace<alignment_t>(database,
-                                                                query,
-                                                                this->trace_matrix(),
-                                                                res_vt.back_coordinate,
-                                                                res_vt.front_coordinate);
-            }
+                res_vt.front_coordinate = this->visit_trace_matrix([&] (auto const & matrix)
+                {
+                    return alignment_front_coordinate(matrix, res_vt.back_coordinate);
+                });
+            else
+                res_vt.front_coordinate = this->invalid_coordinate();
         }
         return alignment_result<result_value_type>{std::move(res_vt)};
     }
@@ -1091,6 +1270,7 @@ bool edit_distance_unbanded<database_t, query_t, align_config_t, traits_t>::smal
 
         compute_kernel<false>(state, block_offset, 0u);
         advance_score(state.hp, state.hn, score_mask);
+        ++_computed_blocks;
 
         // semi-global without max_errors guarantees that the score stays within the last row
         if constexpr(is_semi_global && !use_max_errors)
@@ -1101,7 +1281,7 @@ bool edit_distance_unbanded<database_t, query_t, align_config_t, traits_t>::smal
             abort_computation = this->update_last_active_cell();
 
         add_state();
-        ++database_it;
+        next_database_symbol();
         if (abort_computation)
             return true;
     }
@@ -1126,6 +1306,7 @@ bool edit_distance_unbanded<database_t, query_t, align_config_t, traits_t>::larg
         // compute each block in the current column; carries between blocks will be propagated.
         for (size_t current_block = 0u; current_block < block_count; current_block++)
             compute_kernel<true>(state, block_offset, current_block);
+        _computed_blocks += block_count;
 
         advance_score(state.hp, state.hn, score_mask);
 
@@ -1149,6 +1330,7 @@ bool edit_distance_unbanded<database_t, query_t, align_config_t, traits_t>::larg
                 vp[current_block] = vp0;
                 vn[current_block] = vn0;
                 compute_kernel<false>(state, block_offset, current_block);
+                ++_computed_blocks;
             }
 
             // updating the last active cell
@@ -1156,7 +1338,7 @@ bool edit_distance_unbanded<database_t, query_t, align_config_t, traits_t>::larg
         }
 
         add_state();
-        ++database_it;
+        next_database_symbol();
 
         if (abort_computation)
             return true;
@@ -1179,6 +1361,21 @@ edit_distance_unbanded(database_t && database, query_t && query, config_t config
 template <typename database_t, typename query_t, typename config_t, typename traits_t>
 edit_distance_unbanded(database_t && database, query_t && query, config_t config, traits_t)
     -> edit_distance_unbanded<database_t, query_t, config_t, traits_t>;
+
+//!\brief Deduce the type from the provided arguments.
+template <typename database_t, typename query_t, typename config_t, typename traits_t, typename bit_masks_t>
+edit_distance_unbanded(database_t && database, query_t && query, config_t config, traits_t, bit_masks_t)
+    -> edit_distance_unbanded<database_t, query_t, config_t, traits_t>;
+
+//!\brief Deduce the type from the provided arguments.
+template <typename database_t,
+          typename query_t,
+          typename config_t,
+          typename traits_t,
+          typename bit_masks_t,
+          typename workspace_t>
+edit_distance_unbanded(database_t && database, query_t && query, config_t config, traits_t, bit_masks_t, workspace_t)
+    -> edit_distance_unbanded<database_t, query_t, config_t, traits_t>;
 //!\}
 
 } // namespace seqan3::detail
@@ -0,0 +1,230 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::edit_distance_unbanded_simd.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <array>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_fwd.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+#include <seqan3/core/simd/simd_algorithm.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+#include <seqan3/core/simd/simd.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief This calculates the edit distance of multiple sequence pairs at once, where every query fits into a single
+ *        machine word.
+ * \ingroup pairwise_alignment
+ * \tparam database_t     \copydoc default_edit_distance_trait_type::database_type
+ * \tparam query_t        \copydoc default_edit_distance_trait_type::query_type
+ * \tparam align_config_t \copydoc default_edit_distance_trait_type::align_config_type
+ * \tparam edit_traits    The traits object for the edit distance algorithm.
+ *
+ * \details
+ *
+ * This is the inter-sequence vectorisation of the algorithm of Myers. Every lane of a seqan3::simd::simd_type over
+ * seqan3::detail::default_edit_distance_trait_type::word_type holds the bit-vectors of one sequence pair, i.e. all
+ * pairs of a batch are computed column by column in lockstep. A lane whose database is already exhausted keeps on
+ * computing but its result is not updated anymore.
+ *
+ * The algorithm requires that every query of a batch is not empty and fits into a single machine word
+ * (see #fits_into_lane). Only the score and the back coordinate can be computed, since no trace matrix is stored
+ * (see #is_supported).
+ */
+template <std::ranges::viewable_range database_t,
+          std::ranges::viewable_range query_t,
+          typename align_config_t,
+          typename edit_traits>
+class edit_distance_unbanded_simd
+{
+public:
+    //!\copydoc default_edit_distance_trait_type::word_type
+    using word_type = typename edit_traits::word_type;
+    //!\copydoc default_edit_distance_trait_type::score_type
+    using score_type = typename edit_traits::score_type;
+    //!\copydoc default_edit_distance_trait_type::query_alphabet_type
+    using query_alphabet_type = typename edit_traits::query_alphabet_type;
+    //!\copydoc default_edit_distance_trait_type::result_value_type
+    using result_value_type = typename edit_traits::result_value_type;
+    //!\brief The simd vector type holding one word per sequence pair.
+    using simd_type = simd_type_t<word_type>;
+
+    //!\brief The number of sequence pairs that are computed at once.
+    static constexpr size_t lanes = simd_traits<simd_type>::length;
+    //!\copydoc default_edit_distance_trait_type::word_size
+    static constexpr auto word_size = edit_traits::word_size;
+    //!\brief Whether the configured result can be computed by this algorithm.
+    static constexpr bool is_supported = !edit_traits::compute_trace_matrix && !edit_traits::compute_score_matrix;
+
+private:
+    //!\copydoc default_edit_distance_trait_type::is_semi_global
+    static constexpr bool is_semi_global = edit_traits::is_semi_global;
+    //!\copydoc default_edit_distance_trait_type::use_max_errors
+    static constexpr bool use_max_errors = edit_traits::use_max_errors;
+    //!\brief The size of the alphabet.
+    static constexpr size_t sigma{alphabet_size<query_alphabet_type>};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_unbanded_simd() = delete;                                                   //!< Deleted
+    edit_distance_unbanded_simd(edit_distance_unbanded_simd const &) = default;               //!< Defaulted
+    edit_distance_unbanded_simd(edit_distance_unbanded_simd &&) = default;                    //!< Defaulted
+    edit_distance_unbanded_simd & operator=(edit_distance_unbanded_simd const &) = default;   //!< Defaulted
+    edit_distance_unbanded_simd & operator=(edit_distance_unbanded_simd &&) = default;        //!< Defaulted
+    ~edit_distance_unbanded_simd() = default;                                                 //!< Defaulted
+
+    /*!\brief The constructor.
+     * \param config The configuration.
+     */
+    edit_distance_unbanded_simd(align_config_t const & config) :
+        config{config}
+    {}
+    //!\}
+
+    //!\brief Returns whether the `query` can be computed within a lane, i.e. it is not empty and fits into a word.
+    template <std::ranges::sized_range sequence_t>
+    static constexpr bool fits_into_lane(sequence_t && query) noexcept
+    {
+        size_t const query_size = std::ranges::size(query);
+        return query_size > 0u && query_size <= word_size;
+    }
+
+    /*!\brief Computes the alignments of the given batch.
+     * \tparam batch_t The type of the batch; a std::ranges::random_access_range over
+     *                 `std::tuple<database_t, query_t, size_t>`.
+     * \param[in] batch The database, the query and the index of every sequence pair; at most #lanes many.
+     * \returns A std::vector over seqan3::alignment_result in the order of the `batch`.
+     *
+     * \details
+     *
+     * Every query of the `batch` must satisfy #fits_into_lane.
+     */
+    template <std::ranges::random_access_range batch_t>
+    std::vector<alignment_result<result_value_type>> operator()(batch_t && batch)
+    {
+        using std::get;
+
+        size_t const batch_size = std::ranges::size(batch);
+        assert(batch_size <= lanes);
+
+        // Initialise the bit masks and the per lane scalars.
+        std::array<word_type, lanes * sigma> bit_masks{};
+        std::array<size_t, lanes> database_sizes{};
+        simd_type score{};
+        simd_type score_shift{};
+        simd_type database_size{};
+        size_t max_database_size{0u};
+
+        for (size_t lane = 0u; lane < batch_size; ++lane)
+        {
+            auto && query = get<1>(batch[lane]);
+            assert(fits_into_lane(query));
+
+            size_t pos = 0u;
+            for (auto const & symbol : query)
+                bit_masks[lane * sigma + seqan3::to_rank(symbol)] |= word_type{1u} << pos++;
+
+            score[lane] = pos;
+            score_shift[lane] = pos - 1u;
+            database_sizes[lane] = std::ranges::size(get<0>(batch[lane]));
+            database_size[lane] = database_sizes[lane];
+            max_database_size = std::max(max_database_size, database_sizes[lane]);
+        }
+
+        // The first row is 0 for semi-global alignments and increases by one in every column for global alignments.
+        simd_type const hp0 = simd::fill<simd_type>(is_semi_global ? 0u : 1u);
+        simd_type const one = simd::fill<simd_type>(1u);
+        simd_type vp = simd::fill<simd_type>(~word_type{0u});
+        simd_type vn{};
+        simd_type best_score = score;
+        simd_type best_column{};
+
+        std::array<std::ranges::iterator_t<std::remove_reference_t<database_t>>, lanes> database_it{};
+        for (size_t lane = 0u; lane < batch_size; ++lane)
+            database_it[lane] = std::ranges::begin(get<0>(batch[lane]));
+
+        for (size_t column = 1u; column <= max_database_size; ++column)
+        {
+            simd_type b{};
+            for (size_t lane = 0u; lane < batch_size; ++lane)
+            {
+                if (column <= database_sizes[lane])
+                {
+                    b[lane] = bit_masks[lane * sigma + seqan3::to_rank((query_alphabet_type) *database_it[lane])];
+                    ++database_it[lane];
+                }
+            }
+
+            simd_type x = b | vn;
+            simd_type const d0 = (((x & vp) + vp) ^ vp) | x;
+            simd_type const hn = vp & d0;
+            simd_type const hp = vn | ~(vp | d0);
+            x = (hp << 1) | hp0;
+            vn = x & d0;
+            vp = (hn << 1) | ~(x | d0);
+
+            score += ((hp >> score_shift) & one) - ((hn >> score_shift) & one);
+
+            // Semi-global alignments keep the last column with the minimal score, as the unbanded version does.
+            // Global alignments only keep the score of the last column.
+            simd_type const current_column = simd::fill<simd_type>(column);
+            auto const mask = is_semi_global ? (score <= best_score) & (current_column <= database_size)
+                                             : (current_column == database_size);
+            best_score = mask ? score : best_score;
+            best_column = mask ? current_column : best_column;
+        }
+
+        [[maybe_unused]] score_type max_errors{};
+        if constexpr (use_max_errors)
+            max_errors = edit_traits::max_errors_of(config);
+
+        std::vector<alignment_result<result_value_type>> results{};
+        results.reserve(batch_size);
+        for (size_t lane = 0u; lane < batch_size; ++lane)
+        {
+            size_t const query_size = std::ranges::size(get<1>(batch[lane]));
+            score_type const lane_score = static_cast<score_type>(best_score[lane]);
+            bool const is_valid = !use_max_errors || lane_score <= max_errors;
+
+            result_value_type res_vt{};
+            res_vt.id = get<2>(batch[lane]);
+            res_vt.score = is_valid ? -lane_score : edit_traits::invalid_score;
+
+            if constexpr (edit_traits::compute_back_coordinate)
+            {
+                size_t const back_column = is_valid ? static_cast<size_t>(best_column[lane]) : database_sizes[lane];
+                res_vt.back_coordinate = alignment_coordinate{column_index_type{back_column},
+                                                              row_index_type{query_size}};
+            }
+
+            results.emplace_back(std::move(res_vt));
+        }
+
+        return results;
+    }
+
+private:
+    //!\brief The configuration.
+    align_config_t const & config;
+};
+
+} // namespace seqan3::detail
@@ -12,14 +12,21 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <seqan3/alignment/pairwise/alignment_range.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/alignment/pairwise/execution/execution_handler_parallel.hpp>
 #include <seqan3/alignment/pairwise/execution/execution_handler_sequential.hpp>
+#include <seqan3/alignment/pairwise/execution/execution_handler_thread_pool.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/core/parallel/execution.hpp>
 #include <seqan3/core/type_traits/range.hpp>
 #include <seqan3/range/shortcuts.hpp>
@@ -43,12 +50,23 @@ namespace seqan3::detail
  * This alignment executor provides an additional buffer over the computed alignments to allow
  * a two-way execution flow. The alignment results can then be accessed in an order-preserving manner using the
  * alignment_executor_two_way::bump() member function.
+ *
+ * If the execution handler is not sequential, the buffer consists of two windows of at most
+ * alignment_executor_two_way::default_window_size results each. While the results of one window are consumed, the
+ * alignments of the next window are computed in the background. The next window is only scheduled once the consumer
+ * has drained the current one, such that the memory stays bounded independent of the size of the resource, which
+ * does not need to model std::ranges::sized_range.
+ *
+ * If the resource does not model std::ranges::forward_range, e.g. a view over a seqan3::sequence_file_input, the
+ * sequence pairs of every window are moved or copied into a buffer before they are handed to the execution handler,
+ * since the resource can be iterated only once. The alignments in the results of such a window refer to the buffered
+ * sequences, which are valid until the consumer requests the first result of the next window.
  */
 template <std::ranges::viewable_range resource_t,
           typename alignment_algorithm_t,
           typename execution_handler_t = execution_handler_sequential>
 //!\cond
-    requires std::ranges::forward_range<resource_t> &&
+    requires std::ranges::input_range<resource_t> &&
              std::copy_constructible<alignment_algorithm_t>
 //!\endcond
 class alignment_executor_two_way
@@ -61,8 +79,25 @@ private:
     using chunked_resource_type = typename chunked_indexed_sequence_pairs<resource_t>::type;
     //!\brief The iterator over the underlying resource.
     using chunked_resource_iterator = std::ranges::iterator_t<chunked_resource_type>;
+    //!\brief The sequence pairs of one window if the resource is not a std::ranges::forward_range.
+    using input_window_type = std::vector<std::ranges::range_value_t<resource_t>>;
     //!\}
 
+    //!\brief The single-pass resource and the buffered sequence pairs of the last two scheduled windows.
+    struct input_state
+    {
+        //!\brief The underlying resource.
+        std::ranges::all_view<resource_t> resource;
+        //!\brief The iterator over the resource that stores the current state of the executor.
+        std::ranges::iterator_t<std::ranges::all_view<resource_t>> resource_it{std::ranges::begin(resource)};
+        //!\brief The sequence pairs of the last two scheduled windows.
+        std::array<input_window_type, 2> windows{};
+        //!\brief The element of #windows that receives the sequence pairs of the next window.
+        size_t next_window{0u};
+        //!\brief The index of the next sequence pair.
+        int next_index{0};
+    };
+
     /*!\name Buffer types
      * \{
      */
@@ -89,6 +124,9 @@ public:
     using difference_type = typename buffer_type::difference_type;
     //!\}
 
+    //!\brief The maximal number of results per window if the execution handler is not sequential.
+    static constexpr size_t default_window_size{4096u};
+
     /*!\name Constructors, destructor and assignment
      * \brief The class is move-only, i.e. it is not copy-constructible or copy-assignable.
      * \{
@@ -131,8 +169,19 @@ public:
         return *this;
     }
 
-    //!\brief Defaulted.
-    ~alignment_executor_two_way() = default;
+    /*!\brief Waits for the window that is computed ahead before the buffer is destroyed.
+     *
+     * \details
+     *
+     * The executor can be destroyed before all alignments were consumed, e.g. if the iteration over the
+     * seqan3::alignment_range is stopped early. The window that is still computed by the execution handler writes
+     * into the buffer, which is destroyed before the execution handler.
+     */
+    ~alignment_executor_two_way()
+    {
+        if (scheduled_count > 0u)
+            exec_handler.wait();
+    }
 
     /*!\brief Constructs this executor with the passed range of alignment instances.
      * \tparam exec_policy_t The type of the execution policy; seqan3::is_execution_policy must return `true`. Defaults
@@ -146,9 +195,7 @@ public:
      *
      * \details
      *
-     * Forwards the resource range as a zipped view with an index view to provide internal ids for the alignments.
-     * If the execution handler is parallel, it allocates a buffer of the size of the given resource range.
-     * Otherwise the buffer size is 1.
+     * Default constructs the execution handler and delegates to the constructor below.
      */
     template <typename exec_policy_t = sequenced_policy>
     //!\cond
@@ -158,6 +205,31 @@ public:
                                alignment_algorithm_t fn,
                                size_t chunk_size = 1u,
                                exec_policy_t const & SEQAN3_DOXYGEN_ONLY(exec) = seq) :
+        alignment_executor_two_way{std::forward<resource_t>(resrc), std::move(fn), chunk_size,
+                                   execution_handler_t{}}
+    {}
+
+    /*!\brief Constructs this executor with the passed range of alignment instances and execution handler.
+     * \param[in] resrc The underlying resource containing the sequence pairs to align.
+     * \param[in] fn The alignment kernel to invoke on the sequences pairs.
+     * \param[in] chunk_size The number of sequence pairs to invoke the alignment algorithm with.
+     * \param[in] handler The execution handler, e.g. a seqan3::detail::execution_handler_thread_pool that refers to
+     *                    a persistent seqan3::thread_pool.
+     *
+     * \throws std::invalid_argument if the chunk size is less than 1.
+     *
+     * \details
+     *
+     * Forwards the resource range as a zipped view with an index view to provide internal ids for the alignments.
+     * If the execution handler is not sequential, it allocates a buffer of two windows, whose size is the minimum of
+     * the size of a sized resource range and alignment_executor_two_way::default_window_size, rounded up to a
+     * multiple of the chunk size. Otherwise the buffer holds a single chunk.
+     */
+    alignment_executor_two_way(resource_t resrc,
+                               alignment_algorithm_t fn,
+                               size_t chunk_size,
+                               execution_handler_t handler) :
+        exec_handler{std::move(handler)},
         kernel{std::move(fn)},
         _chunk_size{chunk_size}
     {
@@ -165,13 +237,29 @@ public:
         if (chunk_size == 0u)
             throw std::invalid_argument{"The chunk size must be greater than 0."};
 
-        chunked_resource = views::zip(std::forward<resource_t>(resrc), std::views::iota(0)) | views::chunk(_chunk_size);
-        chunked_resource_it = chunked_resource.begin();
+        window_size = _chunk_size;
+        if constexpr (computes_ahead)
+        {
+            size_t max_window_size = default_window_size;
+            if constexpr (std::ranges::sized_range<resource_t>)
+                max_window_size = std::min<size_t>(max_window_size, std::ranges::size(resrc));
 
-        if constexpr (std::same_as<execution_handler_t, execution_handler_parallel>)
-            init_buffer(std::ranges::distance(resrc));
+            window_size *= std::max<size_t>((max_window_size + _chunk_size - 1) / _chunk_size, 1u);
+        }
+
+        if constexpr (buffers_input)
+        {
+            // Constructed in place, since the iterator refers to the resource.
+            input.reset(new input_state{std::views::all(std::forward<resource_t>(resrc))});
+        }
         else
-            init_buffer(_chunk_size);
+        {
+            chunked_resource = views::zip(std::forward<resource_t>(resrc), std::views::iota(0)) |
+                               views::chunk(_chunk_size);
+            chunked_resource_it = chunked_resource.begin();
+        }
+
+        init_buffer(computes_ahead ? 2 * window_size : window_size);
     }
 
     //!}
@@ -214,7 +302,10 @@ public:
     //!\brief Checks whether the end of the input resource was reached.
     bool is_eof() noexcept
     {
-        return chunked_resource_it == std::ranges::end(chunked_resource);
+        if constexpr (buffers_input)
+            return input->resource_it == std::ranges::end(input->resource);
+        else
+            return chunked_resource_it == std::ranges::end(chunked_resource);
     }
 
     //!\brief Returns the selected chunk size.
@@ -237,44 +328,92 @@ private:
         egptr = end;
     }
 
-    //!\brief Refills the buffer with new alignment results.
+    /*!\brief Refills the buffer with new alignment results.
+     *
+     * \details
+     *
+     * Waits for the scheduled window and exposes it in the get area. If the execution handler is not sequential, the
+     * next window is scheduled into the other half of the buffer before returning, such that it is computed while
+     * the current window is consumed.
+     */
     size_t underflow()
     {
         if (gptr < egptr)  // Case: buffer not completely consumed
             return in_avail();
 
-        if (is_eof())  // Case: reached end of resource.
-            return eof;
+        if (scheduled_count == 0u)
+        {
+            if (is_eof())  // Case: reached end of resource.
+                return eof;
 
-        // Reset the get pointer.
-        setg(std::ranges::begin(buffer), std::ranges::end(buffer));
+            schedule_window(std::ranges::begin(buffer));
+        }
 
-        using std::get;
+        exec_handler.wait();
 
-        // Apply the alignment execution.
-        size_t count = 0;
-        size_t buffer_limit = in_avail();
+        // Update the available get positions to cover the part of the buffer that was filled.
+        setg(scheduled_window, scheduled_window + scheduled_count);
+        scheduled_count = 0u;
 
-        for (size_t current_chunk_size = std::ranges::distance(*chunked_resource_it);
-             count < buffer_limit && !is_eof();
-             count += current_chunk_size, gptr += current_chunk_size, ++chunked_resource_it)
+        if constexpr (computes_ahead)
         {
-            auto && current_chunk = std::ranges::iter_move(chunked_resource_it);
-            current_chunk_size = std::ranges::distance(current_chunk);
-            assert(in_avail() >= current_chunk_size);
+            if (!is_eof())
+                schedule_window(std::ranges::begin(buffer) + ((gptr == std::ranges::begin(buffer)) ? window_size : 0));
+        }
 
-            exec_handler.execute(kernel, std::move(current_chunk), [write_to = gptr] (auto && alignment_results)
+        return in_avail();
+    }
+
+    /*!\brief Hands the alignments of the next window to the execution handler.
+     * \param window The first buffer position of the window to fill.
+     */
+    void schedule_window(buffer_pointer const window)
+    {
+        scheduled_window = window;
+
+        if constexpr (buffers_input)
+        {
+            // The sequence pairs of the previous window might still be referenced, also by the sequential handler.
+            input_window_type & input_window = input->windows[input->next_window];
+            input->next_window ^= 1u;
+            input_window.clear();
+            for (; input_window.size() < window_size && !is_eof(); ++input->resource_it)
+                input_window.emplace_back(*input->resource_it);
+
+            auto chunked_window = views::zip(input_window, std::views::iota(input->next_index)) |
+                                  views::chunk(_chunk_size);
+            input->next_index += static_cast<int>(input_window.size());
+
+            for (auto chunked_window_it = chunked_window.begin();
+                 chunked_window_it != std::ranges::end(chunked_window);
+                 ++chunked_window_it)
             {
-                std::ranges::move(alignment_results, write_to);
-            });
+                execute_chunk(std::ranges::iter_move(chunked_window_it));
+            }
         }
+        else
+        {
+            for (; scheduled_count < window_size && !is_eof(); ++chunked_resource_it)
+                execute_chunk(std::ranges::iter_move(chunked_resource_it));
+        }
+    }
 
-        exec_handler.wait();
+    /*!\brief Hands a chunk of the scheduled window to the execution handler.
+     * \param current_chunk The chunk of indexed sequence pairs to compute.
+     */
+    void execute_chunk(std::ranges::range_value_t<chunked_resource_type> current_chunk)
+    {
+        size_t const current_chunk_size = std::ranges::distance(current_chunk);
+        assert(window_size - scheduled_count >= current_chunk_size);
 
-        // Update the available get positions to cover the part of the buffer that was filled.
-        setg(std::ranges::begin(buffer), std::ranges::begin(buffer) + count);
+        exec_handler.execute(kernel,
+                             std::move(current_chunk),
+                             [write_to = scheduled_window + scheduled_count] (auto && alignment_results)
+        {
+            std::ranges::move(alignment_results, write_to);
+        });
 
-        return in_avail();
+        scheduled_count += current_chunk_size;
     }
     //!\}
 
@@ -295,34 +434,59 @@ private:
     //!\copydetails seqan3::detail::alignment_executor_two_way::alignment_executor_two_way(alignment_executor_two_way && other)
     void move_initialise(alignment_executor_two_way && other) noexcept
     {
+        // The results of a window that is computed ahead must not be written into a moved buffer.
+        if (scheduled_count > 0u)
+            exec_handler.wait();
+        if (other.scheduled_count > 0u)
+            other.exec_handler.wait();
+
         kernel = std::move(other.kernel);
         _chunk_size = std::move(other._chunk_size);
-        // Get the old resource position.
-        std::ptrdiff_t old_resource_pos = std::ranges::distance(other.chunked_resource.begin(),
-                                                                other.chunked_resource_it);
-        // Move the resource and set the iterator state accordingly.
-        chunked_resource = std::move(other.chunked_resource);
-        chunked_resource_it = std::ranges::next(chunked_resource.begin(), old_resource_pos);
+        window_size = std::move(other.window_size);
+        exec_handler = std::move(other.exec_handler);
+        if constexpr (buffers_input)
+        {
+            // The resource and its iterator are stored on the heap and stay valid.
+            input = std::move(other.input);
+        }
+        else
+        {
+            // Get the old resource position.
+            std::ptrdiff_t old_resource_pos = std::ranges::distance(other.chunked_resource.begin(),
+                                                                    other.chunked_resource_it);
+            // Move the resource and set the iterator state accordingly.
+            chunked_resource = std::move(other.chunked_resource);
+            chunked_resource_it = std::ranges::next(chunked_resource.begin(), old_resource_pos);
+        }
 
         // Get the old get pointer positions.
-        std::ptrdiff_t old_gptr_pos = other.gptr - buffer.begin();
-        std::ptrdiff_t old_egptr_pos = other.egptr - buffer.begin();
+        std::ptrdiff_t old_gptr_pos = other.gptr - other.buffer.begin();
+        std::ptrdiff_t old_egptr_pos = other.egptr - other.buffer.begin();
+        std::ptrdiff_t old_window_pos = (other.scheduled_count > 0u) ? other.scheduled_window - other.buffer.begin() : 0;
         // Move the buffer and set the get pointer accordingly.
         buffer = std::move(other.buffer);
         setg(buffer.begin() + old_gptr_pos, buffer.begin() + old_egptr_pos);
+        scheduled_window = buffer.begin() + old_window_pos;
+        scheduled_count = std::exchange(other.scheduled_count, 0u);
     }
     //!\}
 
     //!\brief Indicates the end-of-stream.
     static constexpr size_t eof{std::numeric_limits<size_t>::max()};
+    //!\brief Whether the next window is computed while the current one is consumed.
+    static constexpr bool computes_ahead{!std::same_as<execution_handler_t, execution_handler_sequential>};
+    //!\brief Whether the sequence pairs are buffered per window, since the resource can be iterated only once.
+    static constexpr bool buffers_input{!std::ranges::forward_range<resource_t>};
 
     //!\brief The execution policy.
     execution_handler_t exec_handler{};
 
     //!\brief The underlying resource containing the alignment instances.
-    chunked_resource_type chunked_resource{};
+    std::conditional_t<buffers_input, empty_type, chunked_resource_type> chunked_resource{};
     //!\brief The iterator over the resource that stores the current state of the executor.
-    chunked_resource_iterator chunked_resource_it{};
+    std::conditional_t<buffers_input, empty_type, chunked_resource_iterator> chunked_resource_it{};
+    //!\brief The single-pass resource, which is stored on the heap to keep its iterator valid on move.
+    std::conditional_t<buffers_input, std::unique_ptr<input_state>, empty_type> input{};
     //!\brief Selects the correct alignment to execute.
     alignment_algorithm_t kernel{};
 
@@ -332,6 +496,12 @@ private:
     buffer_pointer gptr{};
     //!\brief The end get pointer in the buffer.
     buffer_pointer egptr{};
+    //!\brief The first buffer position of the window that is computed by the execution handler.
+    buffer_pointer scheduled_window{};
+    //!\brief The number of alignments in the window that is computed by the execution handler.
+    size_t scheduled_count{};
+    //!\brief The maximal number of results per window.
+    size_t window_size{};
     //!\brief The size of the chunks to call the stored algorithm with.
     size_t _chunk_size{};
 };
@@ -356,5 +526,11 @@ alignment_executor_two_way(resource_rng_t &&, func_t, size_t, exec_policy_t cons
                                                   execution_handler_parallel,
                                                   execution_handler_sequential>>;
 
+//!\brief Deduce the type from the provided arguments and use the given execution handler.
+template <typename resource_rng_t, typename func_t, typename execution_handler_t>
+    requires !is_execution_policy_v<execution_handler_t>
+alignment_executor_two_way(resource_rng_t &&, func_t, size_t, execution_handler_t) ->
+    alignment_executor_two_way<resource_rng_t, func_t, execution_handler_t>;
+
 //!\}
 } // namespace seqan3::detail
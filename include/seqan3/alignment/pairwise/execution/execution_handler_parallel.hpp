@@ -12,15 +12,22 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <thread>
 #include <type_traits>
 #include <vector>
 
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/execution/execution_worker_algorithms.hpp>
 #include <seqan3/contrib/parallel/buffer_queue.hpp>
 #include <seqan3/core/parallel/detail/reader_writer_manager.hpp>
 #include <seqan3/core/platform.hpp>
+#include <seqan3/core/type_traits/basic.hpp>
 #include <seqan3/std/concepts>
 #include <seqan3/std/ranges>
 
@@ -37,16 +44,20 @@ namespace seqan3::detail
  * alignment tasks from the concurrent queue. At the same time only one producer thread is allowed to asynchronously
  * submit new alignment tasks.
  *
+ * Every thread computes its tasks with its own copy of the alignment algorithm, which is created on first use and
+ * kept as long as the handler is invoked with the same algorithm object. Thus, the memory an algorithm reuses between
+ * sequence pairs is also reused between the tasks of a thread.
+ *
  * \note Instances of this class are not copyable.
  *
- * \attention This class cannot be reused for multiple calls. For this to work, it requires barriers and a queue that
- *            can be reopened.
+ * The handler can be reused after seqan3::detail::execution_handler_parallel::wait returned. The threads are joined
+ * on destruction.
  */
 class execution_handler_parallel
 {
 private:
-    //!\brief The type erased task type.
-    using task_type = std::function<void()>;
+    //!\brief The type erased task type; it is invoked with the index of the thread computing it.
+    using task_type = std::function<void(size_t)>;
 
 public:
     /*!\name Constructors, destructor and assignment
@@ -64,9 +75,10 @@ public:
     execution_handler_parallel(size_t const thread_count) : state{std::make_unique<internal_state>()}
     {
         auto * q = &(state->queue);
+        auto * s = state.get();
         for (size_t i = 0; i < thread_count; ++i)
         {
-            state->thread_pool.emplace_back([q] ()
+            state->thread_pool.emplace_back([q, s, worker_index = i] ()
             {
                 for (;;)
                 {
@@ -74,7 +86,14 @@ public:
                     if (q->wait_pop(task) == contrib::queue_op_status::closed)
                         return;
 
-                    task();
+                    task(worker_index);
+
+                    // Locking before the notification ensures that a waiting thread cannot miss it.
+                    if (s->open_tasks.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+                    {
+                        std::lock_guard lock{s->finished_mutex};
+                        s->finished_condition.notify_all();
+                    }
                 }
             });
         }
@@ -90,11 +109,7 @@ public:
     execution_handler_parallel & operator=(execution_handler_parallel &&) = default;         //!< Defaulted.
 
     //!\brief Waits for threads to finish.
-    ~execution_handler_parallel()
-    {
-        if (state != nullptr)
-            wait();
-    }
+    ~execution_handler_parallel() = default;
     //!\}
 
     /*!\brief Takes underlying range of sequence pairs and invokes an alignment on each instance.
@@ -103,9 +118,14 @@ public:
      *                                  must model seqan3::detail::indexed_sequence_pair_range.
      * \tparam delegate_type            The type of the callable invoked on the std::invoke_result of `algorithm_t`.
      *
-     * \param[in] algorithm              The alignment algorithm to invoke.
+     * \param[in] algorithm              The alignment algorithm to invoke; it is copied once per thread.
      * \param[in] indexed_sequence_pairs The range of underlying annotated sequence pairs to be aligned.
      * \param[in] delegate               A callable which will be invoked on each result of the computed alignments.
+     *
+     * \details
+     *
+     * If the handler is invoked with another algorithm object than before, the copies of the previous algorithm are
+     * discarded. This must only happen after #wait returned.
      */
     template <typename algorithm_t, indexed_sequence_pair_range indexed_sequence_pairs_t, typename delegate_type>
     void execute(algorithm_t && algorithm,
@@ -114,44 +134,75 @@ public:
     {
         assert(state != nullptr);
 
+        using algorithm_copy_t = remove_cvref_t<algorithm_t>;
+        using worker_algorithms_t = execution_worker_algorithms<algorithm_copy_t>;
+
+        // The executor invokes the handler with the same algorithm for all of its windows, whose copies are kept.
+        if (state->algorithm_source != std::addressof(algorithm))
+        {
+            assert(state->open_tasks.load(std::memory_order_acquire) == 0u);
+
+            state->algorithms.reset(new worker_algorithms_t{
+                algorithm,
+                std::vector<std::optional<algorithm_copy_t>>(state->thread_pool.size())});
+            state->algorithm_source = std::addressof(algorithm);
+        }
+
         // Asynchronously pushes the alignment job as a task to the queue.
-        task_type task = [=, indexed_sequence_pairs = std::move(indexed_sequence_pairs)] ()
+        task_type task = [=,
+                          algorithms = static_cast<worker_algorithms_t *>(state->algorithms.get()),
+                          indexed_sequence_pairs = std::move(indexed_sequence_pairs)] (size_t const worker_index)
         {
-            delegate(algorithm(std::move(indexed_sequence_pairs)));
+            delegate((*algorithms)[worker_index](std::move(indexed_sequence_pairs)));
         };
 
+        state->open_tasks.fetch_add(1u, std::memory_order_relaxed);
         [[maybe_unused]] contrib::queue_op_status status = state->queue.wait_push(std::move(task));
         assert(status == contrib::queue_op_status::success);
     }
 
-    //!\brief Waits until all submitted alignment jobs have been processed.
+    //!\brief Blocks until all submitted alignment jobs have been processed; the handler can be reused afterwards.
     void wait()
     {
         assert(state != nullptr);
 
-        if (!state->is_waiting)
+        std::unique_lock lock{state->finished_mutex};
+        state->finished_condition.wait(lock, [this] ()
         {
-            state->is_waiting = true;
-            state->queue.close();
+            return state->open_tasks.load(std::memory_order_acquire) == 0u;
+        });
+    }
+
+private:
+    //!\brief An internal state stored on the heap to allow safe move construction/assignment of the class.
+    struct internal_state
+    {
+        //!\brief Processes the remaining tasks and joins the threads.
+        ~internal_state()
+        {
+            queue.close();
 
-            for (auto & t : state->thread_pool)
+            for (auto & t : thread_pool)
             {
                 if (t.joinable())
                     t.join();
             }
         }
-    }
 
-private:
-    //!\brief An internal state stored on the heap to allow safe move construction/assignment of the class.
-    struct internal_state
-    {
         //!\brief The thread pool.
         std::vector<std::thread>                 thread_pool{};
         //!\brief The concurrent queue containing the alignments to process.
         contrib::fixed_buffer_queue<task_type>   queue{10000};
-        //!\brief Flag to check if wait was already invoked.
-        bool                                     is_waiting{false};
+        //!\brief The number of submitted tasks that are not finished yet.
+        std::atomic<size_t>                      open_tasks{0u};
+        //!\brief Guards the notification that the last open task finished.
+        std::mutex                               finished_mutex{};
+        //!\brief Wakes up the thread waiting for the open tasks.
+        std::condition_variable                  finished_condition{};
+        //!\brief The type-erased seqan3::detail::execution_worker_algorithms of the current algorithm.
+        std::shared_ptr<void>                    algorithms{nullptr};
+        //!\brief The address of the algorithm the copies were created from.
+        void const *                             algorithm_source{nullptr};
     };
 
     //!\brief Manages the internal state.
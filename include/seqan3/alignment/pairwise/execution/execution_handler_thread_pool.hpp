@@ -0,0 +1,348 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::execution_handler_thread_pool.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <atomic>
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/execution/execution_worker_algorithms.hpp>
+#include <seqan3/core/parallel/thread_pool.hpp>
+#include <seqan3/core/type_traits/basic.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief A monotonic arena for the tasks of seqan3::detail::execution_handler_thread_pool.
+ * \ingroup execution
+ *
+ * \details
+ *
+ * Objects are placed into blocks of raw memory and destroyed together with #clear. The blocks are kept, such that a
+ * reused arena does not allocate once it has grown to the size of the largest batch of tasks.
+ */
+class execution_task_arena
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    execution_task_arena() = default; //!< Defaulted.
+    execution_task_arena(execution_task_arena const &) = delete; //!< Deleted.
+    execution_task_arena(execution_task_arena &&) = default; //!< Defaulted.
+    execution_task_arena & operator=(execution_task_arena const &) = delete; //!< Deleted.
+    execution_task_arena & operator=(execution_task_arena &&) = default; //!< Defaulted.
+
+    //!\brief Destroys all objects in the arena.
+    ~execution_task_arena()
+    {
+        clear();
+    }
+    //!\}
+
+    //!\brief Constructs an object of type `object_t` in the arena and returns a reference to it.
+    template <typename object_t, typename ...args_t>
+    object_t & emplace(args_t && ...args)
+    {
+        static_assert(alignof(object_t) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "The object is over-aligned.");
+
+        object_t * object = new (allocate(sizeof(object_t), alignof(object_t))) object_t{std::forward<args_t>(args)...};
+        destructors.push_back({object, [] (void * ptr) noexcept { static_cast<object_t *>(ptr)->~object_t(); }});
+        return *object;
+    }
+
+    //!\brief Destroys all objects in reverse order of their construction and keeps the memory for reuse.
+    void clear() noexcept
+    {
+        for (auto it = destructors.rbegin(); it != destructors.rend(); ++it)
+            it->destroy(it->object);
+
+        destructors.clear();
+        current_block = 0u;
+        block_offset = 0u;
+    }
+
+private:
+    //!\brief Returns uninitialised memory of the given size and alignment.
+    void * allocate(size_t const size, size_t const alignment)
+    {
+        for (;; ++current_block, block_offset = 0u)
+        {
+            if (current_block == blocks.size())
+            {
+                size_t const new_block_size = std::max(size, block_size);
+                blocks.push_back({std::make_unique<std::byte[]>(new_block_size), new_block_size});
+            }
+
+            size_t const aligned_offset = (block_offset + alignment - 1u) / alignment * alignment;
+            if (aligned_offset + size <= blocks[current_block].size)
+            {
+                block_offset = aligned_offset + size;
+                return blocks[current_block].data.get() + aligned_offset;
+            }
+        }
+    }
+
+    //!\brief A block of raw memory.
+    struct block
+    {
+        //!\brief The memory.
+        std::unique_ptr<std::byte[]> data;
+        //!\brief The size of the memory in bytes.
+        size_t size;
+    };
+
+    //!\brief Destroys an object of the arena.
+    struct destructor
+    {
+        //!\brief The object to destroy.
+        void * object;
+        //!\brief Calls the destructor of the object.
+        void (*destroy)(void *) noexcept;
+    };
+
+    //!\brief The default size of a block in bytes.
+    static constexpr size_t block_size{4096u};
+
+    //!\brief The allocated blocks.
+    std::vector<block> blocks{};
+    //!\brief The constructed objects.
+    std::vector<destructor> destructors{};
+    //!\brief The block that is currently filled.
+    size_t current_block{0u};
+    //!\brief The first free byte in the current block.
+    size_t block_offset{0u};
+};
+
+/*!\brief Handles the parallel execution of alignments on a persistent seqan3::thread_pool.
+ * \ingroup execution
+ *
+ * \details
+ *
+ * In contrast to seqan3::detail::execution_handler_parallel, this handler does not spawn threads, but submits the
+ * alignment tasks to the given seqan3::thread_pool. The tasks are constructed in an arena that is reused after every
+ * call to #wait, and every worker thread computes its tasks with its own copy of the alignment algorithm, which is
+ * created on first use. The handler can be reused for multiple batches of tasks.
+ *
+ * The calling thread blocks in #wait until all of its tasks are computed, hence it must not be a worker of the same
+ * pool. An exception thrown by the alignment algorithm terminates the program, as in
+ * seqan3::detail::execution_handler_parallel.
+ *
+ * \note Instances of this class are not copyable.
+ */
+class execution_handler_thread_pool
+{
+private:
+    /*!\brief Counts the submitted tasks that are not finished yet and lets a thread block until there are none.
+     *
+     * \details
+     *
+     * Only the task that finishes the last open one locks the mutex, such that a returning #wait can never be followed
+     * by an access of the worker, e.g. after the handler was destroyed.
+     */
+    class open_task_counter
+    {
+    public:
+        //!\brief Counts a submitted task.
+        void add() noexcept
+        {
+            count.fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        //!\brief Marks a task as finished and notifies the waiting thread if it was the last one.
+        void finish() noexcept
+        {
+            for (size_t open = count.load(std::memory_order_relaxed); open > 1u;)
+            {
+                if (count.compare_exchange_weak(open, open - 1u, std::memory_order_release, std::memory_order_relaxed))
+                    return;
+            }
+
+            std::lock_guard lock{mutex};
+            count.fetch_sub(1u, std::memory_order_release);
+            finished.notify_all();
+        }
+
+        //!\brief Blocks until all counted tasks are finished.
+        void wait()
+        {
+            std::unique_lock lock{mutex};
+            finished.wait(lock, [this] () { return count.load(std::memory_order_acquire) == 0u; });
+        }
+
+    private:
+        //!\brief The number of open tasks.
+        std::atomic<size_t> count{0u};
+        //!\brief Guards the decrement of the last open task.
+        std::mutex mutex{};
+        //!\brief Wakes up the waiting thread.
+        std::condition_variable finished{};
+    };
+
+    //!\brief A task that computes one chunk of indexed sequence pairs.
+    template <typename algorithm_t, typename indexed_sequence_pairs_t, typename delegate_t>
+    struct alignment_task : public thread_pool_task
+    {
+        //!\brief Constructs the task.
+        alignment_task(execution_worker_algorithms<algorithm_t> & algorithms,
+                       indexed_sequence_pairs_t indexed_sequence_pairs,
+                       delegate_t delegate,
+                       thread_pool const & pool,
+                       open_task_counter & open_tasks) :
+            thread_pool_task{&run},
+            algorithms{&algorithms},
+            indexed_sequence_pairs{std::move(indexed_sequence_pairs)},
+            delegate{std::move(delegate)},
+            pool{&pool},
+            open_tasks{&open_tasks}
+        {}
+
+        //!\brief Computes the alignments and passes the results to the delegate.
+        static void run(thread_pool_task & base) noexcept
+        {
+            alignment_task & task = static_cast<alignment_task &>(base);
+            algorithm_t & algorithm = (*task.algorithms)[task.pool->worker_index()];
+
+            task.delegate(algorithm(std::move(task.indexed_sequence_pairs)));
+            // The task might be destroyed as soon as it is marked as finished.
+            task.open_tasks->finish();
+        }
+
+        //!\brief The copies of the algorithm.
+        execution_worker_algorithms<algorithm_t> * algorithms;
+        //!\brief The chunk to compute.
+        indexed_sequence_pairs_t indexed_sequence_pairs;
+        //!\brief The callable that consumes the results.
+        delegate_t delegate;
+        //!\brief The pool executing this task.
+        thread_pool const * pool;
+        //!\brief The tasks of the handler that are not finished yet.
+        open_task_counter * open_tasks;
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief Instances of this class are not copyable.
+     * \{
+     */
+    execution_handler_thread_pool() = default; //!< Defaulted.
+    execution_handler_thread_pool(execution_handler_thread_pool const &) = delete; //!< Deleted.
+    execution_handler_thread_pool(execution_handler_thread_pool &&) = default; //!< Defaulted.
+    execution_handler_thread_pool & operator=(execution_handler_thread_pool const &) = delete; //!< Deleted.
+
+    //!\brief Waits for the submitted tasks of `*this` before taking over the state of `other`.
+    execution_handler_thread_pool & operator=(execution_handler_thread_pool && other)
+    {
+        if (state != nullptr && state != other.state)
+            wait();
+
+        state = std::move(other.state);
+        return *this;
+    }
+
+    //!\brief Waits for the submitted tasks to finish.
+    ~execution_handler_thread_pool()
+    {
+        if (state != nullptr)
+            wait();
+    }
+
+    /*!\brief Constructs the execution handler for the given pool.
+     * \param pool The thread pool to submit the tasks to; must outlive the handler.
+     */
+    explicit execution_handler_thread_pool(thread_pool & pool) : state{std::make_unique<internal_state>()}
+    {
+        state->pool = &pool;
+    }
+    //!\}
+
+    /*!\brief Takes underlying range of sequence pairs and invokes an alignment on each instance.
+     * \tparam algorithm_t              The type of the alignment algorithm.
+     * \tparam indexed_sequence_pairs_t The type of underlying sequence pairs annotated with an index;
+     *                                  must model seqan3::detail::indexed_sequence_pair_range.
+     * \tparam delegate_type            The type of the callable invoked on the std::invoke_result of `algorithm_t`.
+     *
+     * \param[in] algorithm              The alignment algorithm to invoke; it is copied once per worker and batch.
+     * \param[in] indexed_sequence_pairs The range of underlying annotated sequence pairs to be aligned.
+     * \param[in] delegate               A callable which will be invoked on each result of the computed alignments.
+     */
+    template <typename algorithm_t, indexed_sequence_pair_range indexed_sequence_pairs_t, typename delegate_type>
+    void execute(algorithm_t && algorithm,
+                 indexed_sequence_pairs_t indexed_sequence_pairs,
+                 delegate_type && delegate)
+    {
+        assert(state != nullptr);
+
+        using algorithm_copy_t = remove_cvref_t<algorithm_t>;
+        using task_t = alignment_task<algorithm_copy_t, indexed_sequence_pairs_t, remove_cvref_t<delegate_type>>;
+
+        // All tasks of a batch are computed by the same algorithm, whose copies are created once per batch.
+        if (state->algorithms == nullptr)
+        {
+            state->algorithms = &state->arena.emplace<execution_worker_algorithms<algorithm_copy_t>>(
+                std::forward<algorithm_t>(algorithm),
+                std::vector<std::optional<algorithm_copy_t>>(state->pool->size()));
+        }
+
+        auto & algorithms = *static_cast<execution_worker_algorithms<algorithm_copy_t> *>(state->algorithms);
+        task_t & task = state->arena.emplace<task_t>(algorithms,
+                                                     std::move(indexed_sequence_pairs),
+                                                     std::forward<delegate_type>(delegate),
+                                                     *state->pool,
+                                                     state->open_tasks);
+
+        state->open_tasks.add();
+        state->pool->submit(task);
+    }
+
+    //!\brief Blocks until all submitted alignment jobs have been processed; the handler can be reused afterwards.
+    void wait()
+    {
+        assert(state != nullptr);
+
+        state->open_tasks.wait();
+
+        state->arena.clear();
+        state->algorithms = nullptr;
+    }
+
+private:
+    //!\brief An internal state stored on the heap to allow safe move construction/assignment of the class.
+    struct internal_state
+    {
+        //!\brief The pool executing the tasks.
+        thread_pool * pool{nullptr};
+        //!\brief The submitted tasks that are not finished yet.
+        open_task_counter open_tasks{};
+        //!\brief The type-erased seqan3::detail::execution_worker_algorithms of the batch.
+        void * algorithms{nullptr};
+        //!\brief Stores the tasks and the algorithm copies of the current batch.
+        execution_task_arena arena{};
+    };
+
+    //!\brief Manages the internal state.
+    std::unique_ptr<internal_state> state{nullptr};
+};
+
+} // namespace seqan3::detail
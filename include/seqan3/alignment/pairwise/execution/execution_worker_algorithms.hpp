@@ -0,0 +1,55 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::execution_worker_algorithms.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The copies of an alignment algorithm per worker thread of a parallel execution handler.
+ * \ingroup execution
+ * \tparam algorithm_t The type of the alignment algorithm.
+ *
+ * \details
+ *
+ * Every worker computes its tasks with its own copy of the algorithm, which is created on first use. Thus, the
+ * memory an algorithm keeps between two sequence pairs, e.g. its alignment matrices, is reused for all tasks of a
+ * worker instead of being allocated again for every task.
+ */
+template <typename algorithm_t>
+struct execution_worker_algorithms
+{
+    //!\brief Returns the copy of the algorithm of the given worker.
+    algorithm_t & operator[](size_t const worker_index)
+    {
+        assert(worker_index < copies.size());
+
+        if (!copies[worker_index].has_value())
+            copies[worker_index].emplace(original);
+
+        return *copies[worker_index];
+    }
+
+    //!\brief The algorithm that is copied.
+    algorithm_t original;
+    //!\brief The copies; every element is only accessed by one worker.
+    std::vector<std::optional<algorithm_t>> copies;
+};
+
+} // namespace seqan3::detail
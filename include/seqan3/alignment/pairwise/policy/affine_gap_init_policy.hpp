@@ -16,6 +16,7 @@
 
 #include <seqan3/alignment/matrix/trace_directions.hpp>
 #include <seqan3/alignment/pairwise/detail/alignment_algorithm_state.hpp>
+#include <seqan3/core/type_traits/basic.hpp>
 
 namespace seqan3::detail
 {
@@ -86,10 +87,12 @@ private:
         // score_cell = seqan3::detail::alignment_score_matrix_proxy
         // trace_cell = seqan3::detail::alignment_trace_matrix_proxy
         auto & [score_cell, trace_cell] = origin_cell;
+        // The trace type is a simd vector over narrower values than the score type in vectorised mode.
+        using trace_t = remove_cvref_t<decltype(trace_cell.current)>;
 
         // Initialise the first cell.
         score_cell.current = convert_to_simd_maybe<score_t>(0);
-        trace_cell.current = convert_to_simd_maybe<score_t>(trace_directions::none);
+        trace_cell.current = convert_to_simd_maybe<trace_t>(trace_directions::none);
 
         static_cast<alignment_algorithm_t const &>(*this).check_score_of_cell(origin_cell, state);
 
@@ -97,24 +100,24 @@ private:
         if constexpr (traits_type::free_second_leading_t::value)
         {
             score_cell.up = convert_to_simd_maybe<score_t>(0);
-            trace_cell.up = convert_to_simd_maybe<score_t>(trace_directions::none);
+            trace_cell.up = convert_to_simd_maybe<trace_t>(trace_directions::none);
         }
         else // Initialise with gap_open score
         {
             score_cell.up = state.gap_open_score;
-            trace_cell.up = convert_to_simd_maybe<score_t>(trace_directions::up_open);
+            trace_cell.up = convert_to_simd_maybe<trace_t>(trace_directions::up_open);
         }
 
         // Initialise the horizontal matrix cell according to the traits settings.
         if constexpr (traits_type::free_first_leading_t::value)
         {
             score_cell.w_left = convert_to_simd_maybe<score_t>(0);
-            trace_cell.w_left = convert_to_simd_maybe<score_t>(trace_directions::none);
+            trace_cell.w_left = convert_to_simd_maybe<trace_t>(trace_directions::none);
         }
         else // Initialise with gap_open score
         {
             score_cell.w_left = state.gap_open_score;
-            trace_cell.w_left = convert_to_simd_maybe<score_t>(trace_directions::left_open);
+            trace_cell.w_left = convert_to_simd_maybe<trace_t>(trace_directions::left_open);
         }
     }
 
@@ -138,6 +141,7 @@ private:
         // score_cell = seqan3::detail::alignment_score_matrix_proxy
         // trace_cell = seqan3::detail::alignment_trace_matrix_proxy
         auto & [score_cell, trace_cell] = column_cell;
+        using trace_t = remove_cvref_t<decltype(trace_cell.current)>;
 
         score_cell.current = score_cell.up;
         trace_cell.current = trace_cell.up;
@@ -152,11 +156,11 @@ private:
         else
         {
             score_cell.up += state.gap_extension_score;
-            trace_cell.up = convert_to_simd_maybe<score_t>(trace_directions::up);
+            trace_cell.up = convert_to_simd_maybe<trace_t>(trace_directions::up);
         }
 
         score_cell.w_left = score_cell.current + state.gap_open_score;
-        trace_cell.w_left = convert_to_simd_maybe<score_t>(trace_directions::left_open);
+        trace_cell.w_left = convert_to_simd_maybe<trace_t>(trace_directions::left_open);
     }
 
     /*!\brief Initialises a cell in the first row of the dynamic programming matrix.
@@ -179,6 +183,7 @@ private:
         // score_cell = seqan3::detail::alignment_score_matrix_proxy
         // trace_cell = seqan3::detail::alignment_trace_matrix_proxy
         auto & [score_cell, trace_cell] = row_cell;
+        using trace_t = remove_cvref_t<decltype(trace_cell.current)>;
 
         score_cell.current = score_cell.r_left;
         trace_cell.current = trace_cell.r_left;
@@ -186,24 +191,24 @@ private:
         static_cast<alignment_algorithm_t const &>(*this).check_score_of_cell(row_cell, state);
 
         score_cell.up = score_cell.current + state.gap_open_score;
-        trace_cell.up = convert_to_simd_maybe<score_t>(trace_directions::up_open);
+        trace_cell.up = convert_to_simd_maybe<trace_t>(trace_directions::up_open);
 
         if constexpr (traits_type::free_first_leading_t::value)
         {
             score_cell.w_left = convert_to_simd_maybe<score_t>(0);
-            trace_cell.w_left = convert_to_simd_maybe<score_t>(trace_directions::none);
+            trace_cell.w_left = convert_to_simd_maybe<trace_t>(trace_directions::none);
         }
         else
         {
             score_cell.w_left = score_cell.r_left + state.gap_extension_score;
-            trace_cell.w_left = convert_to_simd_maybe<score_t>(trace_directions::left);
+            trace_cell.w_left = convert_to_simd_maybe<trace_t>(trace_directions::left);
         }
     }
 
 private:
     /*!\brief Converts the given value into a simd vector or just returns the value if alignment is not
      *        executed in vectorised mode.
-     * \tparam score_t The type of the score; must model either seqan3::simd::simd_concept or
+     * \tparam score_t The type of the score or the trace; must model either seqan3::simd::simd_concept or
      *                 seqan3::arithmetic.
      * \tparam value_t The value type to convert; must model seqan3::arithmetic.
      *
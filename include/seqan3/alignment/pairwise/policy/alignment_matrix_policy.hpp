@@ -17,6 +17,9 @@
 
 #include <seqan3/alignment/band/static_band.hpp>
 #include <seqan3/alignment/pairwise/detail/alignment_algorithm_state.hpp>
+#include <seqan3/core/simd/concept.hpp>
+#include <seqan3/core/simd/simd_algorithm.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
 #include <seqan3/core/type_traits/basic.hpp>
 #include <seqan3/range/views/slice.hpp>
 #include <seqan3/range/views/zip.hpp>
@@ -71,13 +74,14 @@ private:
      * \details
      *
      * Initialises the underlying score and trace matrices and sets the respective matrix iterators to the begin of the
-     * corresponding matrix.
+     * corresponding matrix. The matrices are kept between the invocations of the alignment algorithm, such that memory
+     * is only allocated if a sequence pair needs larger matrices than all previous ones.
      */
     template <typename sequence1_t, typename sequence2_t>
     constexpr void allocate_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
     {
-        score_matrix = score_matrix_t{sequence1, sequence2};
-        trace_matrix = trace_matrix_t{sequence1, sequence2};
+        score_matrix.reset(sequence1, sequence2);
+        trace_matrix.reset(sequence1, sequence2);
 
         initialise_matrix_iterator();
     }
@@ -101,7 +105,8 @@ private:
      * to be properly initialised with an infinity value. To emulate the infinity for integral values we use the
      * smallest representable value and subtract the gap extension score (assumed to be always negative) from it.
      * In the algorithm we never write to this cell and only add the extension costs to the read value. This way we
-     * can get the smallest possible value as an infinity.
+     * can get the smallest possible value as an infinity. For simd score types, every lane is initialised with the
+     * infinity of the scalar type.
      */
     template <typename sequence1_t, typename sequence2_t, typename score_t>
     constexpr void allocate_matrix(sequence1_t && sequence1,
@@ -109,11 +114,22 @@ private:
                                    static_band const & band,
                                    alignment_algorithm_state<score_t> const & state)
     {
-        assert(state.gap_extension_score <= 0); // We expect it to never be positive.
+        score_t inf{};
+        if constexpr (simd_concept<score_t>)
+        {
+            using scalar_t = typename simd_traits<score_t>::scalar_type;
+
+            assert(state.gap_extension_score[0] <= 0); // We expect it to never be positive.
+            inf = simd::fill<score_t>(std::numeric_limits<scalar_t>::lowest()) - state.gap_extension_score;
+        }
+        else
+        {
+            assert(state.gap_extension_score <= 0); // We expect it to never be positive.
+            inf = std::numeric_limits<score_t>::lowest() - state.gap_extension_score;
+        }
 
-        score_t inf = std::numeric_limits<score_t>::lowest() - state.gap_extension_score;
-        score_matrix = score_matrix_t{sequence1, sequence2, band, inf};
-        trace_matrix = trace_matrix_t{sequence1, sequence2, band};
+        score_matrix.reset(sequence1, sequence2, band, inf);
+        trace_matrix.reset(sequence1, sequence2, band);
 
         initialise_matrix_iterator();
     }
@@ -36,6 +36,8 @@ struct default_find_optimum_trait
     using find_in_last_row_type    = std::false_type;
     //!\brief Disables optimum search in the last column of the dynamic programming matrix.
     using find_in_last_column_type = std::false_type;
+    //!\brief Indicates that the coordinates of the cells refer to the unbanded matrix.
+    using is_banded_type           = std::false_type;
 };
 
 /*!\brief The CRTP-policy to determine the optimum of the dynamic programming matrix.
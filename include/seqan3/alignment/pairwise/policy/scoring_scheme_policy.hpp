@@ -12,11 +12,34 @@
 
 #pragma once
 
+#include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/core/platform.hpp>
 
 namespace seqan3::detail
 {
 
+/*!\brief A transformation trait that returns the profile type of a scoring scheme or seqan3::detail::empty_type if
+ *        it does not create profiles.
+ * \ingroup alignment_policy
+ * \implements seqan3::transformation_trait
+ * \tparam scoring_scheme_t The type of the scoring scheme.
+ */
+template <typename scoring_scheme_t>
+struct scoring_scheme_profile_type
+{
+    //!\brief The scoring scheme does not create profiles.
+    using type = empty_type;
+};
+
+//!\cond
+template <typename scoring_scheme_t>
+    requires requires { typename scoring_scheme_t::profile_type; }
+struct scoring_scheme_profile_type<scoring_scheme_t>
+{
+    using type = typename scoring_scheme_t::profile_type;
+};
+//!\endcond
+
 /*!\brief The CRTP-policy that stores the scoring scheme used for this alignment algorithm.
  * \ingroup alignment_policy
  * \tparam alignment_algorithm_t The derived type (seqan3::detail::alignment_algorithm) to be augmented with this
@@ -51,8 +74,45 @@ private:
     ~scoring_scheme_policy() noexcept = default;
     //!\}
 
+    /*!\brief Returns the profile of a value of the first sequence, which is scored against the second sequence.
+     * \tparam value_t The type of the value.
+     * \param[in] value The value of the current alignment column.
+     * \returns The profile created by the scoring scheme.
+     *
+     * \details
+     *
+     * Only called once per alignment column, such that the scoring scheme can precompute the scores of the value
+     * against all symbols (see seqan3::detail::simd_matrix_scoring_scheme::make_profile).
+     * If #profiles_symbols is set, the value stores the same symbol in every element and the profile that the scoring
+     * scheme precomputed for this symbol is returned instead. The returned reference is valid until the next call.
+     */
+    template <typename value_t>
+    //!\cond
+        requires requires (scoring_scheme_t const & scheme, value_t const & value) { scheme.make_profile(value); }
+    //!\endcond
+    constexpr auto const & scoring_scheme_profile(value_t const & value) noexcept
+    {
+        if (profiles_symbols)
+            return scoring_scheme.symbol_profile(value[0]);
+
+        column_profile = scoring_scheme.make_profile(value);
+        return column_profile;
+    }
+
+    //!\overload
+    //!\returns The value itself if the scoring scheme does not create profiles.
+    template <typename value_t>
+    constexpr value_t const & scoring_scheme_profile(value_t const & value) const noexcept
+    {
+        return value;
+    }
+
     //!\brief The scoring scheme used for this alignment algorithm.
     scoring_scheme_t scoring_scheme{};
+    //!\brief The profile of the current alignment column (see #scoring_scheme_profile).
+    typename scoring_scheme_profile_type<scoring_scheme_t>::type column_profile{};
+    //!\brief Whether every value of the first sequence stores the same symbol in every element.
+    bool profiles_symbols{false};
 };
 
 } // namespace seqan3::detail
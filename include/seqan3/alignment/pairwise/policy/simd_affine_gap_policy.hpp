@@ -25,6 +25,7 @@
 #include <seqan3/core/simd/concept.hpp>
 #include <seqan3/core/simd/simd_algorithm.hpp>
 #include <seqan3/core/simd/simd_traits.hpp>
+#include <seqan3/core/type_traits/basic.hpp>
 
 namespace seqan3::detail
 {
@@ -97,6 +98,8 @@ private:
         // trace_cell = seqan3::detail::alignment_trace_matrix_proxy
         auto & [score_cell, trace_cell] = current_cell;
         constexpr bool with_trace = !decays_to_ignore_v<std::remove_reference_t<decltype(trace_cell.current)>>;
+        // The trace vector has the same number of elements as the score vector but stores only one byte per element.
+        using trace_t = remove_cvref_t<decltype(trace_cell.current)>;
         // Precompute the diagonal score.
         score_t tmp = score_cell.diagonal + score;
 
@@ -104,11 +107,14 @@ private:
         {
             auto mask = tmp < score_cell.up;
             tmp = (mask) ? score_cell.up : tmp;
-            trace_cell.current = (mask) ? trace_cell.up : convert_to_simd(trace_directions::diagonal) | trace_cell.up;
+            trace_cell.current = (convert_mask<trace_t>(mask)) ? trace_cell.up
+                                                               : convert_to_simd<trace_t>(trace_directions::diagonal) |
+                                                                 trace_cell.up;
 
             mask = tmp < score_cell.r_left;
             tmp = (mask) ? score_cell.r_left : tmp;
-            trace_cell.current = (mask) ? trace_cell.r_left : trace_cell.current | trace_cell.r_left;
+            trace_cell.current = (convert_mask<trace_t>(mask)) ? trace_cell.r_left
+                                                               : trace_cell.current | trace_cell.r_left;
         }
         else
         {
@@ -118,9 +124,15 @@ private:
 
         if constexpr (align_local_t::value)
         {
-            tmp = (tmp < simd::fill<score_t>(0))
-            /*then*/ ? (trace_cell.current = convert_to_simd(trace_directions::none), simd::fill<score_t>(0))
-            /*else*/ : tmp;
+            auto const mask = tmp < simd::fill<score_t>(0);
+
+            if constexpr (with_trace)
+            {
+                trace_cell.current = (convert_mask<trace_t>(mask)) ? convert_to_simd<trace_t>(trace_directions::none)
+                                                                   : trace_cell.current;
+            }
+
+            tmp = (mask) ? simd::fill<score_t>(0) : tmp;
         }
 
         // Store the current max score.
@@ -135,11 +147,78 @@ private:
 
         auto mask = score_cell.up < tmp;
         score_cell.up = (mask) ? tmp : score_cell.up;
-        trace_cell.up = (mask) ? convert_to_simd(trace_directions::up_open) : convert_to_simd(trace_directions::up);
+
+        if constexpr (with_trace)
+        {
+            trace_cell.up = (convert_mask<trace_t>(mask)) ? convert_to_simd<trace_t>(trace_directions::up_open)
+                                                          : convert_to_simd<trace_t>(trace_directions::up);
+        }
+
         mask = score_cell.w_left < tmp;
         score_cell.w_left = (mask) ? tmp : score_cell.w_left;
-        trace_cell.w_left = (mask) ? convert_to_simd(trace_directions::left_open)
-                                   : convert_to_simd(trace_directions::left);
+
+        if constexpr (with_trace)
+        {
+            trace_cell.w_left = (convert_mask<trace_t>(mask)) ? convert_to_simd<trace_t>(trace_directions::left_open)
+                                                              : convert_to_simd<trace_t>(trace_directions::left);
+        }
+    }
+
+    /*!\brief Computes the score of the first simd cell within the band.
+     * \tparam cell_t The type of the current cell [for detailed information on the type see below].
+     * \param[in,out] current_cell The current cell in the dynamic programming matrix.
+     * \param[in,out] state        The state storing hot helper variables.
+     * \param[in]     score        The score of comparing the respective letters of the first and the second sequence.
+     *
+     * \details
+     *
+     * The vectorised counterpart of seqan3::detail::affine_gap_policy::compute_first_band_cell. All sequence pairs of
+     * the batch share the same band, so the first cell of a banded column can only be reached from the diagonal or
+     * from the left in every lane.
+     */
+    template <typename cell_t>
+    constexpr void compute_first_band_cell(cell_t && current_cell,
+                                           alignment_algorithm_state<score_t> & state,
+                                           score_t const score) const noexcept
+    {
+        // score_cell = seqan3::detail::alignment_score_matrix_proxy
+        // trace_cell = seqan3::detail::alignment_trace_matrix_proxy
+        auto & [score_cell, trace_cell] = current_cell;
+        constexpr bool with_trace = !decays_to_ignore_v<std::remove_reference_t<decltype(trace_cell.current)>>;
+        using trace_t = remove_cvref_t<decltype(trace_cell.current)>;
+
+        score_t tmp = score_cell.diagonal + score;
+        auto mask = tmp < score_cell.r_left;
+        tmp = (mask) ? score_cell.r_left : tmp;
+
+        if constexpr (with_trace)
+        {
+            trace_cell.current = (convert_mask<trace_t>(mask)) ? trace_cell.r_left
+                                                               : convert_to_simd<trace_t>(trace_directions::diagonal);
+        }
+
+        if constexpr (align_local_t::value)
+        {
+            mask = tmp < simd::fill<score_t>(0);
+
+            if constexpr (with_trace)
+            {
+                trace_cell.current = (convert_mask<trace_t>(mask)) ? convert_to_simd<trace_t>(trace_directions::none)
+                                                                   : trace_cell.current;
+            }
+
+            tmp = (mask) ? simd::fill<score_t>(0) : tmp;
+        }
+
+        score_cell.current = tmp;
+        // Check if this was the optimum. Possibly a noop.
+        static_cast<alignment_algorithm_t const &>(*this).check_score_of_cell(current_cell, state);
+
+        // At the top of the band the next vertical score must open a gap.
+        score_cell.up = tmp + state.gap_open_score;
+
+        if constexpr (with_trace)
+            trace_cell.up = convert_to_simd<trace_t>(trace_directions::up_open);
     }
 
     /*!\brief Initialise the alignment state for affine gap computation.
@@ -167,13 +246,31 @@ private:
     }
 
     /*!\brief Converts a trace direction into a simd vector.
+     * \tparam trace_t The simd vector type storing the trace directions; must model seqan3::simd::simd_concept.
      * \param[in] direction The trace direction to convert to a simd vector.
      */
-    constexpr score_t convert_to_simd(trace_directions const direction) const noexcept
+    template <simd_concept trace_t>
+    constexpr trace_t convert_to_simd(trace_directions const direction) const noexcept
     {
-        using scalar_t = typename simd_traits<score_t>::scalar_type;
+        using scalar_t = typename simd_traits<trace_t>::scalar_type;
 
-        return simd::fill<score_t>(static_cast<scalar_t>(direction));
+        return simd::fill<trace_t>(static_cast<scalar_t>(direction));
+    }
+
+    /*!\brief Converts a mask obtained from comparing score vectors into a mask to blend trace vectors.
+     * \tparam trace_t The simd vector type storing the trace directions; must model seqan3::simd::simd_concept.
+     * \tparam mask_t  The type of the mask to convert.
+     * \param[in] mask The mask to convert; must have as many elements as `trace_t`.
+     */
+    template <simd_concept trace_t, typename mask_t>
+    static constexpr auto convert_mask(mask_t const & mask) noexcept
+    {
+        using trace_mask_t = typename simd_traits<trace_t>::mask_type;
+
+        if constexpr (std::same_as<mask_t, trace_mask_t>)
+            return mask;
+        else
+            return __builtin_convertvector(mask, trace_mask_t);
     }
 
     alignment_state_t alignment_state{}; //!< The internal alignment state tracking the current alignment optimum.
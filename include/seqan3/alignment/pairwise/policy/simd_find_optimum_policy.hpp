@@ -76,6 +76,11 @@ struct simd_global_alignment_state
  * last cell is projected to a cell on the last column, then the row indices are compared. The found score as well
  * as the indices are finally corrected to represent the original score and coordinates as if the sequence pair
  * was computed in scalar mode.
+ *
+ * If `traits_type::is_banded_type` is `std::true_type`, the row coordinates of the cells are relative to the banded
+ * matrix. They are converted to the rows of the outer matrix with the #band_column_index that the alignment algorithm
+ * sets after allocating the banded matrix. Hence, the mask comparison and the tracked optimum refer to the outer
+ * matrix in the banded case as well.
  */
 template <typename alignment_algorithm_t,
           simd::simd_concept simd_t,
@@ -97,6 +102,8 @@ private:
     static constexpr bool search_in_last_row = traits_type::find_in_last_row_type::value || is_global_alignment;
     //!\brief A bool constant to check if cells of the last column need to be tested for the global optimum.
     static constexpr bool search_in_last_column = traits_type::find_in_last_column_type::value || is_global_alignment;
+    //!\brief A bool constant to check if the row coordinates of the cells are relative to a banded matrix.
+    static constexpr bool is_banded = traits_type::is_banded_type::value;
 
     /*!\name Constructors, destructor and assignment
      * \{
@@ -255,7 +262,7 @@ private:
         auto const & [score_cell, trace_cell] = cell;
         state.optimum.update_if_new_optimal_score(score_cell.current,
                                                   column_index_type{trace_cell.coordinate.first},
-                                                  row_index_type{trace_cell.coordinate.second});
+                                                  row_index_type{row_index_of(trace_cell.coordinate)});
     }
 
     /*!\brief Tests if the current row, respectively column, is part of a global alignment to track.
@@ -283,7 +290,7 @@ private:
         using simd_mask_t = typename simd_traits<simd_t>::mask_type;
         auto const & [score_cell, trace_cell] = cell;
         simd_t column_positions = simd::fill<simd_t>(trace_cell.coordinate.first);
-        simd_t row_positions = simd::fill<simd_t>(trace_cell.coordinate.second);
+        simd_t row_positions = simd::fill<simd_t>(row_index_of(trace_cell.coordinate));
 
         simd_mask_t mask{};
 
@@ -300,6 +307,23 @@ private:
         state.optimum.row_index = mask ? row_positions - this->coordinate_offset
                                        : state.optimum.row_index;
     }
+
+    /*!\brief Returns the row of the given coordinate within the outer matrix.
+     * \tparam coordinate_t The type of the coordinate.
+     * \param[in] coordinate The coordinate of the cell.
+     * \returns The row index of the cell; converted from the banded matrix if #is_banded is `true`.
+     */
+    template <typename coordinate_t>
+    constexpr auto row_index_of(coordinate_t const & coordinate) const noexcept
+    {
+        if constexpr (is_banded)
+            return coordinate.second + coordinate.first - band_column_index;
+        else
+            return coordinate.second;
+    }
+
+    //!\brief The column index in which the upper bound of the band crosses the first row; only used if banded.
+    size_t band_column_index{};
 };
 
 } // namespace seqan3::detail
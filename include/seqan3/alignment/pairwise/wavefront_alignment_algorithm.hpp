@@ -0,0 +1,211 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::wavefront_alignment_algorithm.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring.hpp>
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/affine_gap_wavefront.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/scoring/gap_scheme.hpp>
+#include <seqan3/core/type_traits/basic.hpp>
+#include <seqan3/std/concepts>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the global alignments of the sequence pairs with seqan3::detail::affine_gap_wavefront.
+ * \implements std::invocable
+ * \tparam config_t The configuration type.
+ *
+ * \details
+ *
+ * This wrapper class unifies the interface of the wavefront alignment algorithm with the execution model of the
+ * pairwise alignment algorithms, like seqan3::detail::edit_distance_algorithm. The match and mismatch score are
+ * determined by the seqan3::detail::alignment_configurator, which also validates the configuration.
+ */
+template <typename config_t>
+class wavefront_alignment_algorithm
+{
+private:
+    //!\brief The configuration traits.
+    using traits_t = alignment_configuration_traits<config_t>;
+    //!\brief The score type of the alignment.
+    using score_t = typename traits_t::original_score_t;
+
+    static_assert(std::signed_integral<score_t>, "The wavefront alignment algorithm requires a signed integral score.");
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr wavefront_alignment_algorithm() = default;                                                  //!< Defaulted
+    constexpr wavefront_alignment_algorithm(wavefront_alignment_algorithm const &) = default;             //!< Defaulted
+    constexpr wavefront_alignment_algorithm(wavefront_alignment_algorithm &&) = default;                  //!< Defaulted
+    constexpr wavefront_alignment_algorithm & operator=(wavefront_alignment_algorithm const &) = default; //!< Defaulted
+    constexpr wavefront_alignment_algorithm & operator=(wavefront_alignment_algorithm &&) = default;      //!< Defaulted
+    ~wavefront_alignment_algorithm() = default;                                                           //!< Defaulted
+
+    /*!\brief Constructs the wrapper with the passed configuration.
+     * \param cfg            The configuration to be passed to the algorithm.
+     * \param match_score    The score of every match of the configured scoring scheme.
+     * \param mismatch_score The score of every mismatch of the configured scoring scheme.
+     *
+     * \details
+     *
+     * The configuration is copied once to the heap during construction and maintained by a std::shared_ptr.
+     */
+    wavefront_alignment_algorithm(config_t const & cfg, score_t const match_score, score_t const mismatch_score) :
+        cfg_ptr{new config_t(cfg)},
+        match_score{match_score},
+        mismatch_score{mismatch_score}
+    {}
+    //!\}
+
+    /*!\brief Invokes the alignment computation for every indexed sequence pair contained in the given range.
+     * \tparam indexed_sequence_pairs_t The type of the range of the indexed sequence pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pairs.
+     *
+     * \param[in] indexed_sequence_pairs The indexed sequence pairs to align.
+     *
+     * \returns A std::vector over seqan3::alignment_result.
+     *
+     * \details
+     *
+     * The wavefronts are only stored if the front coordinate or the alignment is requested. Their memory is reused
+     * for all sequence pairs of the range.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t>
+    auto operator()(indexed_sequence_pairs_t && indexed_sequence_pairs)
+    {
+        using indexed_sequence_pair_t = std::ranges::range_value_t<indexed_sequence_pairs_t>; // The value type.
+        using sequence_pair_t = std::tuple_element_t<0, indexed_sequence_pair_t>; // The sequence pair type.
+        using sequence1_t = std::remove_reference_t<std::tuple_element_t<0, sequence_pair_t>>;
+        using sequence2_t = std::remove_reference_t<std::tuple_element_t<1, sequence_pair_t>>;
+        using alignment_result_value_t = typename align_result_selector<sequence1_t, sequence2_t, config_t>::type;
+
+        using std::get;
+
+        affine_gap_wavefront<score_t> algorithm = make_wavefront();
+        std::vector<alignment_result<alignment_result_value_t>> result_vector{};
+
+        for (auto && [sequence_pair, index] : indexed_sequence_pairs)
+        {
+            result_vector.emplace_back(compute_single_pair<alignment_result_value_t>(algorithm,
+                                                                                     index,
+                                                                                     get<0>(sequence_pair),
+                                                                                     get<1>(sequence_pair)));
+        }
+
+        return result_vector;
+    }
+
+    /*!\overload
+     *
+     * \param[in] idx       The index of the sequence pair.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \returns The seqan3::alignment_result of the single sequence pair.
+     *
+     * \details
+     *
+     * Computes a single sequence pair for the statically dispatched seqan3::align_pairwise, which writes the results
+     * into a buffer of the caller. The wavefronts are kept between the calls.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+    auto operator()(size_t const idx, sequence1_t & sequence1, sequence2_t & sequence2)
+    {
+        using alignment_result_value_t = typename align_result_selector<sequence1_t, sequence2_t, config_t>::type;
+
+        if (!single_pair_wavefront.has_value())
+            single_pair_wavefront.emplace(make_wavefront());
+
+        return compute_single_pair<alignment_result_value_t>(*single_pair_wavefront, idx, sequence1, sequence2);
+    }
+
+private:
+    //!\brief Constructs the wavefront alignment algorithm with the configured scores.
+    affine_gap_wavefront<score_t> make_wavefront() const
+    {
+        auto const & gaps = cfg_ptr->template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}});
+        return affine_gap_wavefront<score_t>{match_score,
+                                             mismatch_score,
+                                             static_cast<score_t>(gaps.get_gap_open_score()),
+                                             static_cast<score_t>(gaps.get_gap_score()),
+                                             traits_t::result_type_rank >= 2};
+    }
+
+    /*!\brief Computes the alignment of a single sequence pair.
+     * \tparam result_value_t The type of the alignment result value.
+     * \tparam sequence1_t    The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t    The type of the second sequence; must model std::ranges::forward_range.
+     *
+     * \param[in] algorithm The wavefront alignment algorithm.
+     * \param[in] idx       The index of the current sequence pair.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \returns A seqan3::alignment_result with the requested alignment outcomes.
+     */
+    template <typename result_value_t, std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+    alignment_result<result_value_t> compute_single_pair(affine_gap_wavefront<score_t> & algorithm,
+                                                         size_t const idx,
+                                                         sequence1_t & sequence1,
+                                                         sequence2_t & sequence2)
+    {
+        auto const wavefront_res = algorithm(sequence1, sequence2, seqan3::get<align_cfg::scoring>(*cfg_ptr).value);
+
+        result_value_t res{};
+        res.id = idx;
+        res.score = wavefront_res.optimum.score;
+
+        if constexpr (traits_t::result_type_rank >= 1)
+        {
+            res.back_coordinate = alignment_coordinate{column_index_type{wavefront_res.optimum.column_index},
+                                                       row_index_type{wavefront_res.optimum.row_index}};
+        }
+
+        if constexpr (traits_t::result_type_rank >= 2)
+        {
+            aligned_sequence_builder builder{sequence1, sequence2};
+            auto trace_res = builder(wavefront_res.trace_path());
+            res.front_coordinate.first = trace_res.first_sequence_slice_positions.first;
+            res.front_coordinate.second = trace_res.second_sequence_slice_positions.first;
+
+            if constexpr (traits_t::result_type_rank == 3) // compute alignment
+                res.alignment = std::move(trace_res.alignment);
+        }
+
+        return alignment_result<result_value_t>{std::move(res)};
+    }
+
+    //!\brief The alignment configuration stored on the heap.
+    std::shared_ptr<remove_cvref_t<config_t>> cfg_ptr{};
+    //!\brief The score of a match.
+    score_t match_score{};
+    //!\brief The score of a mismatch.
+    score_t mismatch_score{};
+    //!\brief The wavefronts of the single sequence pairs of the statically dispatched alignment.
+    std::optional<affine_gap_wavefront<score_t>> single_pair_wavefront{};
+};
+
+} // namespace seqan3::detail
@@ -12,6 +12,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+
 #include <seqan3/alignment/configuration/align_config_mode.hpp>
 #include <seqan3/alignment/scoring/scoring_scheme_concept.hpp>
 #include <seqan3/alphabet/concept.hpp>
@@ -35,7 +38,21 @@ namespace seqan3::detail
  * \details
  *
  * When scoring two seqan3::detail::simd vectors, this performs element-wise lookups of the compared simd vectors
- * using the underlying scoring matrix and returns the result in another seqan3::detail::simd vector.
+ * using the underlying scoring matrix and returns the result in another seqan3::detail::simd vector. The lookups are
+ * scalar loads, one per element, since the simd layer offers no shuffle or gather primitive to vectorise them.
+ *
+ * The scores are stored in a table of the scalar type of the simd vector, which has one additional row and column
+ * for the padded symbols. Since the alignment matrix is computed column by column, the simd vector of the first
+ * sequence is the same for all cells of a column. For this vector a profile can be created with
+ * seqan3::detail::simd_matrix_scoring_scheme::make_profile, which stores one simd vector of scores per symbol of
+ * the alphabet. Scoring the profile against a simd vector of the second sequence then loads the score of every
+ * element from the profile row of its symbol. This is still one scalar load per element; it only saves the index
+ * computation of the first operand, while building the profile costs one store per element and symbol. Whether the
+ * profile pays off therefore depends on the height of the alignment column.
+ *
+ * If the first sequence is the same in every lane, e.g. if one query is aligned against many targets, every simd
+ * vector of it is a broadcast symbol. The profiles of all broadcast symbols are computed once on construction and
+ * are returned by seqan3::detail::simd_matrix_scoring_scheme::symbol_profile.
  *
  * \note Note that the alphabet type information is lost during the conversion to the simd vectors and
  * only the ranks of the alphabet are used.
@@ -48,7 +65,20 @@ template <simd_concept simd_score_t, semialphabet alphabet_t, typename alignment
 //!\endcond
 class simd_matrix_scoring_scheme
 {
+private:
+    //!\brief The scalar type of the simd vector.
+    using simd_scalar_t = typename simd_traits<simd_score_t>::scalar_type;
+    //!\brief The number of rows and columns of the score table; the last one stores the scores of padded symbols.
+    static constexpr size_t table_size = alphabet_size<alphabet_t> + 1;
+
 public:
+    //!\brief The scores of one simd vector of the first sequence against every symbol of the alphabet.
+    struct profile_type
+    {
+        //!\brief The scores for every symbol; the last vector stores the scores against padded symbols.
+        std::array<simd_score_t, table_size> scores;
+    };
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -98,25 +128,80 @@ public:
         simd_score_t result{};
 
         for (size_t i = 0; i < simd_traits<simd_score_t>::length; ++i)
-        {
-            if (is_padded(lhs[i]) || is_padded(rhs[i]))
-            {
-                if constexpr (std::same_as<alignment_t, detail::global_alignment_type>)
-                    result[i] = 1;
-                else
-                    result[i] = -1;
-            }
-            else
-            {
-                result[i] = internal_scoring_scheme.score(assign_rank_to(lhs[i], alphabet_t{}),
-                                                          assign_rank_to(rhs[i], alphabet_t{}));
-            }
-        }
+            result[i] = score_table[table_index(lhs[i]) * table_size + table_index(rhs[i])];
+
+        return result;
+    }
+
+    /*!\brief Given a profile of the first operand and a simd vector, compute an element-wise score.
+     * \param[in] lhs_profile The profile of the left operand.
+     * \param[in] rhs         The right operand to compare.
+     * \returns The same scores as seqan3::detail::simd_matrix_scoring_scheme::score for the profiled operand.
+     *
+     * ### Exception
+     *
+     * No-throw guarantee.
+     *
+     * ### Complexity
+     *
+     * Linear in the length of the input vector; every element is gathered from the profile with a scalar load.
+     *
+     * ### Thread safety
+     *
+     * Thread-safe.
+     */
+    constexpr simd_score_t score(profile_type const & lhs_profile, simd_score_t const & rhs) const noexcept
+    {
+        simd_score_t result{};
+
+        for (size_t i = 0; i < simd_traits<simd_score_t>::length; ++i)
+            result[i] = lhs_profile.scores[table_index(rhs[i])][i];
 
         return result;
     }
     //!\}
 
+    /*!\brief Creates the profile of a simd vector, which stores its scores against every symbol of the alphabet.
+     * \param[in] lhs The simd vector to create the profile for.
+     * \returns The profile that can be scored against the simd vectors of the other sequence.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in the length of the input vector times the size of the alphabet plus one, i.e. one scalar store per
+     * element and symbol including the padded symbol.
+     */
+    constexpr profile_type make_profile(simd_score_t const & lhs) const noexcept
+    {
+        profile_type profile{};
+
+        for (size_t i = 0; i < simd_traits<simd_score_t>::length; ++i)
+        {
+            simd_scalar_t const * const row = score_table.data() + table_index(lhs[i]) * table_size;
+
+            for (size_t symbol = 0; symbol < table_size; ++symbol)
+                profile.scores[symbol][i] = row[symbol];
+        }
+
+        return profile;
+    }
+
+    /*!\brief Returns the profile of a simd vector that stores the given symbol in every element.
+     * \param[in] rank The rank of the symbol or a padded value.
+     * \returns The profile that seqan3::detail::simd_matrix_scoring_scheme::make_profile returns for this vector.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Constant.
+     */
+    constexpr profile_type const & symbol_profile(simd_scalar_t const rank) const noexcept
+    {
+        return symbol_profiles[table_index(rank)];
+    }
+
     //!\brief Returns the match score used for padded symbols.
     constexpr typename scoring_scheme_t::score_type padding_match_score() noexcept
     {
@@ -124,16 +209,17 @@ public:
     }
 
 private:
-    //!\brief Internally stores the given scalar scoring scheme matrix.
-    scoring_scheme_t internal_scoring_scheme;
+    //!\brief The scores of all pairs of symbols including the padded symbol, stored row by row.
+    std::array<simd_scalar_t, table_size * table_size> score_table{};
+    //!\brief The profiles of the simd vectors that store the same symbol or padded value in every element.
+    std::array<profile_type, table_size> symbol_profiles{};
 
-    /*!\brief Store the given scoring scheme matrix into a private member variable.
+    /*!\brief Store the given scoring scheme matrix into the score table.
      * \param[in] scoring_scheme The scoring scheme to initialise the vectorised match and mismatch score with.
      */
     constexpr void initialise_from_scalar_scoring_scheme(scoring_scheme_t const & scoring_scheme)
     {
         using score_t = decltype(std::declval<scoring_scheme_t const &>().score(alphabet_t{}, alphabet_t{}));
-        using simd_scalar_t = typename simd_traits<simd_score_t>::scalar_type;
 
         // Check if the scoring scheme match and mismatch scores do not overflow with the respective scalar type.
         if constexpr (sizeof(simd_scalar_t) < sizeof(score_t))
@@ -143,7 +229,27 @@ private:
                                             "for the selected scalar type of the simd type."};
         }
 
-        internal_scoring_scheme = scoring_scheme;
+        // Padded symbols get the positive padding score in global alignments and a negative score in local ones.
+        simd_scalar_t const padding_score = std::same_as<alignment_t, detail::global_alignment_type> ? 1 : -1;
+        score_table.fill(padding_score);
+
+        for (size_t i = 0; i < alphabet_size<alphabet_t>; ++i)
+        {
+            for (size_t j = 0; j < alphabet_size<alphabet_t>; ++j)
+            {
+                score_table[i * table_size + j] = scoring_scheme.score(assign_rank_to(i, alphabet_t{}),
+                                                                       assign_rank_to(j, alphabet_t{}));
+            }
+        }
+
+        for (size_t rank = 0; rank < table_size; ++rank)
+        {
+            for (size_t symbol = 0; symbol < table_size; ++symbol)
+            {
+                for (size_t i = 0; i < simd_traits<simd_score_t>::length; ++i)
+                    symbol_profiles[rank].scores[symbol][i] = score_table[rank * table_size + symbol];
+            }
+        }
     }
 
     /*!\brief Check if any score in the scoring scheme matrix exceeds the min or max value allowed by the simd vector.
@@ -174,18 +280,18 @@ private:
         return false;
     }
 
-    /*!\brief Checks whether the given value is a padded value or not.
-     * \param[in] value The value to check if it is padded.
-     * \returns Returns `true` if the value is padded and `false` otherwise.
+    /*!\brief Returns the row or column of the score table for the given value.
+     * \param[in] value The rank of a symbol or a padded value.
+     * \returns The rank of the symbol or the last row for a padded value.
      *
-     * \details This check is done by casting the scalar type of the value into an unsigned value, and then checking
-     *          to see if this is larger than the alphabet size, which would imply that it is a padded value.
+     * \details The scalar type of the value is cast into an unsigned value, such that every value that is not less
+     *          than the alphabet size is a padded value.
      */
-    constexpr bool is_padded(typename simd_traits<simd_score_t>::scalar_type const & value) const
+    static constexpr size_t table_index(simd_scalar_t const value) noexcept
     {
-        using unsigned_scalar_t = typename std::make_unsigned<typename simd_traits<simd_score_t>::scalar_type>::type;
+        using unsigned_scalar_t = std::make_unsigned_t<simd_scalar_t>;
 
-        return static_cast<unsigned_scalar_t>(value) >= alphabet_size<alphabet_t>;
+        return std::min<size_t>(static_cast<unsigned_scalar_t>(value), alphabet_size<alphabet_t>);
     }
 };
 
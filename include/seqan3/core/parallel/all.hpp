@@ -26,6 +26,11 @@
  * in the standard library. Once they are fully supported by the compilers our policies will merely alias the standard
  * policies.
  *
+ * ### Thread pool
+ *
+ * The seqan3::thread_pool keeps a fixed set of worker threads alive, such that algorithms that are invoked many times
+ * with small inputs do not pay for spawning and joining threads on every invocation.
+ *
  * \if DEV
  * ### Concurrency support
  *
@@ -35,4 +40,5 @@
  */
 
 #include <seqan3/core/parallel/execution.hpp>
+#include <seqan3/core/parallel/thread_pool.hpp>
 #include <seqan3/core/parallel/detail/all.hpp>
@@ -0,0 +1,256 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::thread_pool.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/std/new>
+
+namespace seqan3::detail
+{
+
+/*!\brief The base class of all tasks that are executed by a seqan3::thread_pool.
+ * \ingroup parallel
+ *
+ * \details
+ *
+ * A task is not owned by the pool: the submitting code keeps it alive until it was executed. Instead of a type-erased
+ * callable, the derived task type sets a plain function pointer, such that scheduling a task never allocates.
+ */
+struct thread_pool_task
+{
+    //!\brief Executes the given task, which is `*this`; must not throw.
+    void (*execute)(thread_pool_task &) noexcept {nullptr};
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief A persistent pool of worker threads with work-stealing task queues.
+ * \ingroup parallel
+ *
+ * \details
+ *
+ * The worker threads are spawned once on construction and are reused by every algorithm that is given this pool,
+ * e.g. with seqan3::align_cfg::thread_pool. Every worker owns a task queue. Tasks that are submitted from outside the
+ * pool are distributed round-robin over the queues, while tasks submitted by a worker are added to its own queue.
+ * A worker takes the most recently added task from its own queue and, if this one is empty, steals the oldest task
+ * from the queue of another worker. Idle workers sleep until a new task is submitted.
+ *
+ * On destruction, all submitted tasks are executed before the worker threads are joined.
+ *
+ * ### Thread safety
+ *
+ * Tasks can be submitted concurrently from any thread.
+ */
+class thread_pool
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief The pool is neither copyable nor movable, since the worker threads refer to it.
+     * \{
+     */
+    thread_pool(thread_pool const &) = delete; //!< Deleted.
+    thread_pool(thread_pool &&) = delete; //!< Deleted.
+    thread_pool & operator=(thread_pool const &) = delete; //!< Deleted.
+    thread_pool & operator=(thread_pool &&) = delete; //!< Deleted.
+
+    //!\brief Constructs the pool with std::thread::hardware_concurrency many threads, but at least one.
+    thread_pool() : thread_pool{std::max<size_t>(std::thread::hardware_concurrency(), 1u)}
+    {}
+
+    /*!\brief Constructs the pool with the given number of worker threads.
+     * \param thread_count The number of worker threads to spawn.
+     * \throws std::invalid_argument if `thread_count` is 0.
+     */
+    explicit thread_pool(size_t const thread_count) : thread_count{thread_count}
+    {
+        if (thread_count == 0u)
+            throw std::invalid_argument{"The thread pool needs at least one thread."};
+
+        queues = std::make_unique<task_queue[]>(thread_count);
+        workers.reserve(thread_count);
+        for (size_t worker_index = 0; worker_index < thread_count; ++worker_index)
+            workers.emplace_back([this, worker_index] () { run_worker(worker_index); });
+    }
+
+    //!\brief Executes all remaining tasks and joins the worker threads.
+    ~thread_pool()
+    {
+        {
+            std::lock_guard lock{sleep_mutex};
+            is_stopped = true;
+        }
+        sleep_condition.notify_all();
+
+        for (std::thread & worker : workers)
+            worker.join();
+    }
+    //!\}
+
+    //!\brief Returns the number of worker threads.
+    size_t size() const noexcept
+    {
+        return thread_count;
+    }
+
+    /*!\brief Returns the index of the calling worker thread of this pool or seqan3::thread_pool::size if the calling
+     *        thread is not a worker of this pool.
+     */
+    size_t worker_index() const noexcept
+    {
+        return (current_worker().pool == this) ? current_worker().index : size();
+    }
+
+    /*!\brief Schedules the given task.
+     * \param[in] task The task to execute; must stay alive until it was executed.
+     */
+    void submit(detail::thread_pool_task & task)
+    {
+        assert(task.execute != nullptr);
+
+        size_t const index = (current_worker().pool == this) ? current_worker().index
+                                                             : next_queue.fetch_add(1u, std::memory_order_relaxed) %
+                                                               size();
+        // Count the task first, such that a worker that takes it never observes a negative count.
+        pending_tasks.fetch_add(1u, std::memory_order_seq_cst);
+
+        {
+            std::lock_guard lock{queues[index].mutex};
+            queues[index].tasks.push_back(&task);
+        }
+
+        // A worker counts itself as sleeping before it checks the pending tasks, hence it either sees the new task or
+        // is seen here. Locking the mutex ensures that it is already waiting when it is notified.
+        if (sleeping_workers.load(std::memory_order_seq_cst) > 0u)
+        {
+            std::lock_guard lock{sleep_mutex};
+            sleep_condition.notify_one();
+        }
+    }
+
+private:
+    //!\brief The task queue of one worker.
+    struct alignas(std::hardware_destructive_interference_size) task_queue
+    {
+        //!\brief Guards the tasks.
+        std::mutex mutex{};
+        //!\brief The scheduled tasks.
+        std::deque<detail::thread_pool_task *> tasks{};
+    };
+
+    //!\brief Identifies the worker that runs on the calling thread.
+    struct worker_id
+    {
+        //!\brief The pool of the worker or `nullptr` if the calling thread is no worker.
+        thread_pool const * pool{nullptr};
+        //!\brief The index of the worker in its pool.
+        size_t index{};
+    };
+
+    //!\brief Returns the worker id of the calling thread.
+    static worker_id & current_worker() noexcept
+    {
+        thread_local worker_id id{};
+        return id;
+    }
+
+    //!\brief Removes the newest task from the own queue or steals the oldest task from another queue.
+    detail::thread_pool_task * pop_task(size_t const own_index)
+    {
+        {
+            std::lock_guard lock{queues[own_index].mutex};
+            if (!queues[own_index].tasks.empty())
+            {
+                detail::thread_pool_task * task = queues[own_index].tasks.back();
+                queues[own_index].tasks.pop_back();
+                return task;
+            }
+        }
+
+        for (size_t offset = 1; offset < size(); ++offset)
+        {
+            task_queue & victim = queues[(own_index + offset) % size()];
+            std::lock_guard lock{victim.mutex};
+            if (!victim.tasks.empty())
+            {
+                detail::thread_pool_task * task = victim.tasks.front();
+                victim.tasks.pop_front();
+                return task;
+            }
+        }
+
+        return nullptr;
+    }
+
+    //!\brief The loop of a worker thread.
+    void run_worker(size_t const own_index)
+    {
+        current_worker() = worker_id{this, own_index};
+
+        for (;;)
+        {
+            if (detail::thread_pool_task * task = pop_task(own_index); task != nullptr)
+            {
+                pending_tasks.fetch_sub(1u, std::memory_order_relaxed);
+                task->execute(*task);
+                continue;
+            }
+
+            std::unique_lock lock{sleep_mutex};
+            sleeping_workers.fetch_add(1u, std::memory_order_seq_cst);
+            sleep_condition.wait(lock, [this] ()
+            {
+                return is_stopped || pending_tasks.load(std::memory_order_seq_cst) > 0u;
+            });
+            sleeping_workers.fetch_sub(1u, std::memory_order_relaxed);
+
+            if (is_stopped && pending_tasks.load(std::memory_order_relaxed) == 0u)
+                return;
+        }
+    }
+
+    //!\brief The number of worker threads; set before the workers are spawned.
+    size_t thread_count;
+    //!\brief The task queue of every worker.
+    std::unique_ptr<task_queue[]> queues{};
+    //!\brief The worker threads.
+    std::vector<std::thread> workers{};
+    //!\brief The queue that receives the next task that is submitted from outside the pool.
+    std::atomic<size_t> next_queue{0u};
+    //!\brief Guards the stop flag and the sleep of idle workers; it is not locked if no worker sleeps.
+    std::mutex sleep_mutex{};
+    //!\brief Wakes up idle workers.
+    std::condition_variable sleep_condition{};
+    //!\brief The number of submitted tasks that were not taken from a queue yet.
+    std::atomic<size_t> pending_tasks{0u};
+    //!\brief The number of workers that sleep or are about to sleep.
+    std::atomic<size_t> sleeping_workers{0u};
+    //!\brief Whether the pool is destructed.
+    bool is_stopped{false};
+};
+
+} // namespace seqan3
@@ -0,0 +1,126 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides test utilities to generate sequence pairs and to compare the alignments of two configurations.
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+namespace seqan3::test
+{
+
+//!\brief A collection of sequence pairs as aligned by the tests.
+template <typename alphabet_t>
+using sequence_pair_collection = std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>>;
+
+/*!\brief Generates pairs of random sequences.
+ * \tparam alphabet_t The alphabet of the sequences.
+ * \param[in] count            The number of pairs.
+ * \param[in] lengths          Invoked with the index of a pair; returns the lengths of its two sequences.
+ * \param[in] variance_percent The length of every sequence varies by this percentage of its length.
+ *
+ * \details
+ *
+ * The sequences of the pair `i` are generated with the seeds `i` and `i + 100`.
+ */
+template <typename alphabet_t, typename lengths_t>
+sequence_pair_collection<alphabet_t> random_sequence_pairs(size_t const count,
+                                                           lengths_t && lengths,
+                                                           size_t const variance_percent = 0u)
+{
+    sequence_pair_collection<alphabet_t> sequences{};
+
+    for (size_t seed = 0; seed < count; ++seed)
+    {
+        auto const [length1, length2] = lengths(seed);
+        sequences.emplace_back(generate_sequence<alphabet_t>(length1, length1 * variance_percent / 100u, seed),
+                               generate_sequence<alphabet_t>(length2, length2 * variance_percent / 100u, seed + 100u));
+    }
+
+    return sequences;
+}
+
+/*!\brief Generates pairs of a random sequence and a mutated copy of it.
+ * \tparam alphabet_t The alphabet of the sequences.
+ * \param[in] count         The number of pairs.
+ * \param[in] lengths       Invoked with the index of a pair; returns the lengths of its two sequences.
+ * \param[in] substitutions Invoked with the index of a pair; returns the first substituted position and the distance
+ *                          between two substituted positions.
+ *
+ * \details
+ *
+ * The first sequence of the pair `i` is generated with the seed `i`. The second sequence is a copy of it, in which
+ * the selected symbols are replaced by the symbol of the next rank. Afterwards, it is cut or extended with the symbol
+ * of rank 0 to its length.
+ */
+template <typename alphabet_t, typename lengths_t, typename substitutions_t>
+sequence_pair_collection<alphabet_t> similar_sequence_pairs(size_t const count,
+                                                            lengths_t && lengths,
+                                                            substitutions_t && substitutions)
+{
+    sequence_pair_collection<alphabet_t> sequences{};
+
+    for (size_t seed = 0; seed < count; ++seed)
+    {
+        auto const [length1, length2] = lengths(seed);
+        auto const [first_position, step] = substitutions(seed);
+
+        std::vector<alphabet_t> sequence1 = generate_sequence<alphabet_t>(length1, 0u, seed);
+        std::vector<alphabet_t> sequence2 = sequence1;
+
+        for (size_t position = first_position; position < sequence2.size(); position += step)
+        {
+            size_t const rank = (seqan3::to_rank(sequence2[position]) + 1u) % alphabet_size<alphabet_t>;
+            sequence2[position] = assign_rank_to(rank, alphabet_t{});
+        }
+
+        sequence2.resize(length2, assign_rank_to(0u, alphabet_t{}));
+        sequences.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+
+    return sequences;
+}
+
+/*!\brief Expects that two configurations compute the same alignments of the given sequence pairs.
+ * \param[in] sequences    The sequence pairs to align.
+ * \param[in] expected_cfg The configuration of the expected alignments, usually without the tested element.
+ * \param[in] actual_cfg   The configuration under test.
+ * \param[in] projection   Invoked with every seqan3::alignment_result; returns the compared members, e.g. as a tuple.
+ *
+ * \details
+ *
+ * The results of both configurations must have the same size and the same id at every position.
+ */
+template <typename sequences_t, typename expected_cfg_t, typename actual_cfg_t, typename projection_t>
+void expect_same_alignments(sequences_t const & sequences,
+                            expected_cfg_t const & expected_cfg,
+                            actual_cfg_t const & actual_cfg,
+                            projection_t && projection)
+{
+    auto expected = align_pairwise(sequences, expected_cfg) | views::to<std::vector>;
+    auto actual = align_pairwise(sequences, actual_cfg) | views::to<std::vector>;
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t idx = 0; idx < expected.size(); ++idx)
+    {
+        EXPECT_EQ(actual[idx].id(), expected[idx].id());
+        EXPECT_EQ(projection(actual[idx]), projection(expected[idx])) << "at position " << idx;
+    }
+}
+
+} // namespace seqan3::test
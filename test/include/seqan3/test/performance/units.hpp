@@ -14,6 +14,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/core/concept/tuple.hpp>
 #include <seqan3/core/type_traits/range.hpp>
 #include <seqan3/core/platform.hpp>
@@ -34,13 +37,37 @@ inline benchmark::Counter bytes_per_second(size_t bytes)
                               benchmark::Counter::OneK::kIs1024);
 }
 
-//!\brief Calculates the number of cell updates for given sequences for a specific alignment config.
-template <typename sequences_range_t>
-inline size_t pairwise_cell_updates(sequences_range_t const & sequences_range, auto && /*align_cfg*/)
+/*!\brief Calculates the number of cell updates for given sequences for a specific alignment config.
+ *
+ * \details
+ *
+ * If seqan3::align_cfg::band is configured, only the cells whose diagonal (column minus row index) lies within the
+ * band are counted.
+ */
+template <typename sequences_range_t, typename config_t>
+inline size_t pairwise_cell_updates(sequences_range_t const & sequences_range, config_t const & config)
 {
     size_t matrix_cells = 0u;
     for (auto && [seq1, seq2]: sequences_range)
-        matrix_cells += (std::ranges::size(seq1) + 1) * (std::ranges::size(seq2) + 1);
+    {
+        int64_t const cols = std::ranges::size(seq1) + 1;
+        int64_t const rows = std::ranges::size(seq2) + 1;
+
+        if constexpr (config_t::template exists<align_cfg::band>())
+        {
+            static_band const & band = get<align_cfg::band>(config).value;
+            for (int64_t col = 0; col < cols; ++col)
+            {
+                int64_t const first_row = std::max<int64_t>(0, col - std::min(band.upper_bound, cols));
+                int64_t const last_row = std::min<int64_t>(rows - 1, col - std::max(band.lower_bound, -rows));
+                matrix_cells += std::max<int64_t>(0, last_row - first_row + 1);
+            }
+        }
+        else
+        {
+            matrix_cells += cols * rows;
+        }
+    }
     return matrix_cells;
 }
 
@@ -56,4 +83,19 @@ inline benchmark::Counter cell_updates_per_second(size_t cells)
                               benchmark::Counter::OneK::kIs1000);
 }
 
+/*!\brief This returns a counter which represents how many giga cell updates were done per second (GCUPS).
+ *
+ * \param  cells The total number of cells processed of a complete benchmark run.
+ * \return       Returns a benchmark Counter which represents GCUPS.
+ *
+ * \details
+ *
+ * In contrast to seqan3::test::cell_updates_per_second the value is always reported in the same unit, which allows
+ * to compare the results of different benchmarks in the JSON output directly.
+ */
+inline benchmark::Counter giga_cell_updates_per_second(size_t cells)
+{
+    return benchmark::Counter(cells / 1e9, benchmark::Counter::kIsIterationInvariantRate);
+}
+
 } // namespace seqan3::test
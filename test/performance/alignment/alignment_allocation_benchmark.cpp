@@ -0,0 +1,175 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+// ============================================================================
+//  count every allocation of the program
+// ============================================================================
+
+std::atomic<size_t> allocation_count{0u};
+
+void * operator new(std::size_t size)
+{
+    ++allocation_count;
+
+    if (void * ptr = std::malloc(size == 0u ? 1u : size))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void * operator new(std::size_t size, std::align_val_t alignment)
+{
+    ++allocation_count;
+
+    size_t const align = static_cast<size_t>(alignment);
+    if (void * ptr = std::aligned_alloc(align, (size + align - 1u) / align * align))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void * ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+using namespace seqan3;
+using namespace seqan3::test;
+
+constexpr auto affine_cfg = align_cfg::mode{global_alignment} |
+                            align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                            align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}};
+
+// The lengths of the sequences vary by half of the given length, such that the matrices of later sequence pairs do
+// not always fit into the memory allocated for the previous ones.
+auto generate_read_pairs(size_t const sequence_length)
+{
+    using sequence_t = decltype(generate_sequence<dna4>());
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequences{};
+    for (size_t i = 0; i < 1000u; ++i)
+    {
+        sequences.emplace_back(generate_sequence<dna4>(sequence_length, sequence_length / 2u, i),
+                               generate_sequence<dna4>(sequence_length, sequence_length / 2u, i + 1000u));
+    }
+
+    return sequences;
+}
+
+// Reports how many allocations all computed alignments needed on average, including the setup of the algorithm.
+template <typename sequences_t>
+void set_counters(benchmark::State & state, sequences_t const & sequences, size_t const allocations)
+{
+    state.counters["allocations"] = static_cast<double>(allocations) / (state.iterations() * sequences.size());
+    state.counters["cells"] = pairwise_cell_updates(sequences, affine_cfg);
+    state.counters["CUPS"] = cell_updates_per_second(state.counters["cells"]);
+}
+
+// ============================================================================
+//  affine; dna4; statically dispatched into a result buffer
+// ============================================================================
+
+template <typename result_t>
+void seqan3_affine_allocations(benchmark::State & state, result_t)
+{
+    auto sequences = generate_read_pairs(state.range(0));
+    auto cfg = affine_cfg | align_cfg::result{result_t{}};
+
+    using alignment_result_t = std::ranges::range_value_t<decltype(align_pairwise(sequences, cfg))>;
+    std::vector<alignment_result_t> results(sequences.size());
+
+    size_t allocations = 0u;
+    for (auto _ : state)
+    {
+        size_t const allocations_before = allocation_count.load();
+        benchmark::DoNotOptimize(align_pairwise(sequences, cfg, results));
+        allocations += allocation_count.load() - allocations_before;
+    }
+
+    set_counters(state, sequences, allocations);
+}
+
+BENCHMARK_CAPTURE(seqan3_affine_allocations, score, detail::with_score_type{})->Arg(150)->Arg(1000);
+BENCHMARK_CAPTURE(seqan3_affine_allocations, front_coordinate, detail::with_front_coordinate_type{})
+    ->Arg(150)->Arg(1000);
+
+// ============================================================================
+//  alignment range; dna4; sequential and parallel
+// ============================================================================
+
+// Every chunk of sequence pairs additionally allocates the vector of its alignment results. In the parallel case,
+// every thread allocates the memory of its copy of the algorithm once.
+template <typename sequences_t, typename align_cfg_t>
+void compute_alignment_range(benchmark::State & state, sequences_t const & sequences, align_cfg_t const & cfg)
+{
+    size_t allocations = 0u;
+    for (auto _ : state)
+    {
+        size_t const allocations_before = allocation_count.load();
+        for (auto && result : align_pairwise(sequences, cfg))
+            benchmark::DoNotOptimize(result.score());
+        allocations += allocation_count.load() - allocations_before;
+    }
+
+    set_counters(state, sequences, allocations);
+}
+
+void seqan3_affine_parallel_allocations(benchmark::State & state)
+{
+    auto sequences = generate_read_pairs(state.range(0));
+    compute_alignment_range(state, sequences, affine_cfg | align_cfg::result{with_score} | align_cfg::parallel{4});
+}
+
+BENCHMARK(seqan3_affine_parallel_allocations)->Arg(150)->Arg(1000);
+
+void seqan3_edit_distance_allocations(benchmark::State & state)
+{
+    auto sequences = generate_read_pairs(state.range(0));
+    compute_alignment_range(state, sequences, align_cfg::edit | align_cfg::result{with_score});
+}
+
+BENCHMARK(seqan3_edit_distance_allocations)->Arg(150)->Arg(1000);
+
+void seqan3_edit_distance_parallel_allocations(benchmark::State & state)
+{
+    auto sequences = generate_read_pairs(state.range(0));
+    compute_alignment_range(state, sequences, align_cfg::edit | align_cfg::result{with_score} | align_cfg::parallel{4});
+}
+
+BENCHMARK(seqan3_edit_distance_parallel_allocations)->Arg(150)->Arg(1000);
+
+BENCHMARK_MAIN();
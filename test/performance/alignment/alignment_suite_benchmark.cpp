@@ -0,0 +1,207 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+#include <seqan3/std/ranges>
+
+using namespace seqan3;
+using namespace seqan3::test;
+
+// Every benchmark of this file computes one combination of the following dimensions. The results are reported in
+// GCUPS, where only the cells within the band are counted for banded alignments.
+
+// Aliases to beautify the benchmark output
+using score = detail::with_score_type;
+using trace = detail::with_alignment_type;
+using global = detail::global_alignment_type;
+using local = detail::local_alignment_type;
+
+struct unbanded {};
+struct banded {};
+struct scalar {};
+struct vectorised {};
+
+// The sequence pairs of a data set are given by the benchmark arguments {sequence length, number of pairs}.
+inline constexpr int64_t mixed_lengths = 0;
+// The band is wide enough for the differences between the lengths of the generated pairs.
+inline constexpr int64_t band_width = 32;
+inline constexpr size_t variance = 10;
+
+// Short, medium and long pairs with roughly the same number of cells and a batch with lengths between 50 and 2000.
+void data_sets(benchmark::internal::Benchmark * benchmark)
+{
+    benchmark->Args({100, 10'000})->Args({1000, 100})->Args({10'000, 1})->Args({mixed_lengths, 100});
+}
+
+template <typename alphabet_t>
+auto generate_data(benchmark::State const & state)
+{
+    using sequence_t = decltype(generate_sequence<alphabet_t>());
+
+    size_t const set_size = state.range(1);
+    std::vector<std::pair<sequence_t, sequence_t>> sequences{};
+    for (size_t i = 0; i < set_size; ++i)
+    {
+        size_t const length = (state.range(0) == mixed_lengths) ? 50 + (i * 733) % 1951 : state.range(0);
+        sequences.emplace_back(generate_sequence<alphabet_t>(length, variance, i),
+                               generate_sequence<alphabet_t>(length, variance, i + set_size));
+    }
+
+    return sequences;
+}
+
+template <typename alphabet_t, typename mode_t, typename band_t, typename execution_t, typename result_t>
+auto make_config()
+{
+    auto gap_cfg = align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}};
+    auto base_cfg = [&] ()
+    {
+        if constexpr (std::same_as<alphabet_t, aa27>)
+            return align_cfg::mode{mode_t{}} | gap_cfg |
+                   align_cfg::scoring{aminoacid_scoring_scheme{aminoacid_similarity_matrix::BLOSUM62}} |
+                   align_cfg::result{result_t{}};
+        else
+            return align_cfg::mode{mode_t{}} | gap_cfg |
+                   align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}} |
+                   align_cfg::result{result_t{}};
+    }();
+
+    auto banded_cfg = [&] ()
+    {
+        if constexpr (std::same_as<band_t, banded>)
+            return base_cfg | align_cfg::band{static_band{lower_bound{-band_width}, upper_bound{band_width}}};
+        else
+            return base_cfg;
+    }();
+
+    if constexpr (std::same_as<execution_t, vectorised>)
+        return banded_cfg | align_cfg::vectorise;
+    else
+        return banded_cfg;
+}
+
+// ============================================================================
+//  affine; dna4 and aa27; all combinations
+// ============================================================================
+
+template <typename alphabet_t, typename mode_t, typename band_t, typename execution_t, typename result_t>
+void seqan3_affine(benchmark::State & state)
+{
+    auto sequences = generate_data<alphabet_t>(state);
+    auto cfg = make_config<alphabet_t, mode_t, band_t, execution_t, result_t>();
+
+    int64_t total = 0;
+    for (auto _ : state)
+    {
+        for (auto && res : align_pairwise(sequences, cfg))
+            total += res.score();
+    }
+
+    state.counters["cells"] = pairwise_cell_updates(sequences, cfg);
+    state.counters["GCUPS"] = giga_cell_updates_per_second(state.counters["cells"]);
+    state.counters["total"] = total;
+}
+
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, global, unbanded, scalar, score)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, global, unbanded, scalar, trace)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, global, unbanded, vectorised, score)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, global, unbanded, vectorised, trace)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, global, banded, scalar, score)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, global, banded, scalar, trace)->Apply(data_sets);
+// The vectorised banded alignment only computes the score and the back coordinate.
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, global, banded, vectorised, score)->Apply(data_sets);
+
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, local, unbanded, scalar, score)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, local, unbanded, scalar, trace)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, local, unbanded, vectorised, score)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, local, unbanded, vectorised, trace)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, local, banded, scalar, score)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, local, banded, scalar, trace)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, dna4, local, banded, vectorised, score)->Apply(data_sets);
+
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, global, unbanded, scalar, score)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, global, unbanded, scalar, trace)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, global, unbanded, vectorised, score)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, global, unbanded, vectorised, trace)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, global, banded, scalar, score)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, global, banded, scalar, trace)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, global, banded, vectorised, score)->Apply(data_sets);
+
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, local, unbanded, scalar, score)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, local, unbanded, scalar, trace)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, local, unbanded, vectorised, score)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, local, unbanded, vectorised, trace)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, local, banded, scalar, score)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, local, banded, scalar, trace)->Apply(data_sets);
+BENCHMARK_TEMPLATE(seqan3_affine, aa27, local, banded, vectorised, score)->Apply(data_sets);
+
+// ============================================================================
+//  affine; dna4 and aa27; thread scaling
+// ============================================================================
+
+// 1, 2, 4, ... threads up to the number of hardware threads, which is always measured.
+void thread_counts(benchmark::internal::Benchmark * benchmark)
+{
+    int64_t const max_threads = std::max<int64_t>(std::thread::hardware_concurrency(), 1);
+    for (int64_t threads = 1; threads < max_threads; threads *= 2)
+        benchmark->Args({threads, 1000, 1000});
+    benchmark->Args({max_threads, 1000, 1000});
+}
+
+template <typename alphabet_t, typename execution_t, typename result_t>
+void seqan3_affine_thread_scaling(benchmark::State & state)
+{
+    // The threads are given by the first argument and the data set by the remaining ones.
+    uint32_t const thread_count = state.range(0);
+    using sequence_t = decltype(generate_sequence<alphabet_t>());
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequences{};
+    for (int64_t i = 0; i < state.range(2); ++i)
+        sequences.emplace_back(generate_sequence<alphabet_t>(state.range(1), variance, i),
+                               generate_sequence<alphabet_t>(state.range(1), variance, i + state.range(2)));
+
+    auto cfg = make_config<alphabet_t, global, unbanded, execution_t, result_t>() | align_cfg::parallel{thread_count};
+
+    int64_t total = 0;
+    for (auto _ : state)
+    {
+        for (auto && res : align_pairwise(sequences, cfg))
+            total += res.score();
+    }
+
+    state.counters["cells"] = pairwise_cell_updates(sequences, cfg);
+    state.counters["GCUPS"] = giga_cell_updates_per_second(state.counters["cells"]);
+    state.counters["GCUPS_per_thread"] = giga_cell_updates_per_second(state.counters["cells"] / thread_count);
+    state.counters["total"] = total;
+}
+
+BENCHMARK_TEMPLATE(seqan3_affine_thread_scaling, dna4, scalar, score)->Apply(thread_counts)->UseRealTime();
+BENCHMARK_TEMPLATE(seqan3_affine_thread_scaling, dna4, scalar, trace)->Apply(thread_counts)->UseRealTime();
+BENCHMARK_TEMPLATE(seqan3_affine_thread_scaling, dna4, vectorised, score)->Apply(thread_counts)->UseRealTime();
+BENCHMARK_TEMPLATE(seqan3_affine_thread_scaling, dna4, vectorised, trace)->Apply(thread_counts)->UseRealTime();
+BENCHMARK_TEMPLATE(seqan3_affine_thread_scaling, aa27, scalar, score)->Apply(thread_counts)->UseRealTime();
+BENCHMARK_TEMPLATE(seqan3_affine_thread_scaling, aa27, vectorised, score)->Apply(thread_counts)->UseRealTime();
+
+// ============================================================================
+//  instantiate tests
+// ============================================================================
+
+BENCHMARK_MAIN();
@@ -0,0 +1,127 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_all_pairs.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/pairwise_combine.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+using namespace seqan3;
+using namespace seqan3::test;
+
+constexpr auto edit_cfg = align_cfg::edit | align_cfg::result{with_score};
+
+// Globally defined constants to ensure same test data.
+inline constexpr size_t sequence_length = 150;
+inline constexpr size_t set_size        = 1000;
+inline constexpr size_t variance        = 10;
+
+auto generate_sequences()
+{
+    std::vector<decltype(generate_sequence<dna4>())> sequences{};
+    for (size_t i = 0; i < set_size; ++i)
+        sequences.push_back(generate_sequence<dna4>(sequence_length, variance, i));
+
+    return sequences;
+}
+
+// The benchmarks run with 1 to 64 threads (the argument) in real time. The cell updates per second and thread stay
+// constant if the computation scales linearly with the number of threads.
+void set_counters(benchmark::State & state, std::vector<std::vector<dna4>> const & sequences)
+{
+    size_t cells = 0u;
+    for (size_t first = 0; first < sequences.size(); ++first)
+        for (size_t second = first + 1; second < sequences.size(); ++second)
+            cells += (sequences[first].size() + 1) * (sequences[second].size() + 1);
+
+    state.counters["cells"] = cells;
+    state.counters["CUPS"] = cell_updates_per_second(state.counters["cells"]);
+    state.counters["threads"] = state.range(0);
+    state.counters["CUPS/thread"] = cell_updates_per_second(cells / state.range(0));
+}
+
+// ============================================================================
+//  edit distance; all pairs as a range of sequence pairs
+// ============================================================================
+
+void seqan3_pairwise_combine(benchmark::State & state)
+{
+    auto sequences = generate_sequences();
+    auto cfg = edit_cfg | align_cfg::parallel{static_cast<uint32_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        int64_t total = 0;
+        for (auto && result : align_pairwise(views::pairwise_combine(sequences), cfg))
+            total += result.score();
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    set_counters(state, sequences);
+}
+
+BENCHMARK(seqan3_pairwise_combine)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+// ============================================================================
+//  edit distance; all pairs in tiles
+// ============================================================================
+
+void seqan3_align_all_pairs(benchmark::State & state)
+{
+    auto sequences = generate_sequences();
+    auto cfg = edit_cfg | align_cfg::parallel{static_cast<uint32_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        std::atomic<int64_t> total{0};
+        align_all_pairs(sequences, cfg, [&] (size_t, size_t, auto && result)
+        {
+            total.fetch_add(result.score(), std::memory_order_relaxed);
+        });
+
+        benchmark::DoNotOptimize(total.load());
+    }
+
+    set_counters(state, sequences);
+}
+
+BENCHMARK(seqan3_align_all_pairs)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+// The same with pruning of the pairs that cannot reach the minimal score.
+void seqan3_align_all_pairs_min_score(benchmark::State & state)
+{
+    auto sequences = generate_sequences();
+    auto cfg = edit_cfg | align_cfg::min_score{-static_cast<int32_t>(variance)} |
+               align_cfg::parallel{static_cast<uint32_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        std::atomic<size_t> hits{0};
+        align_all_pairs(sequences, cfg, [&] (size_t, size_t, auto &&)
+        {
+            hits.fetch_add(1u, std::memory_order_relaxed);
+        });
+
+        benchmark::DoNotOptimize(hits.load());
+    }
+
+    set_counters(state, sequences);
+}
+
+BENCHMARK(seqan3_align_all_pairs_min_score)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,78 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/chaining/chain_anchors.hpp>
+
+using namespace seqan3;
+
+// Anchors of a long read: a true chain along the main diagonal mixed with the same number of random repeat hits.
+std::vector<anchor> generate_anchors(size_t const count)
+{
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<size_t> position_distribution{0, count * 50};
+    std::uniform_int_distribution<size_t> offset_distribution{0, 20};
+
+    std::vector<anchor> anchors{};
+    for (size_t index = 0; index < count; ++index)
+    {
+        if (index % 2 == 0)
+            anchors.push_back(anchor{index * 25 + offset_distribution(generator), index * 25, 15});
+        else
+            anchors.push_back(anchor{position_distribution(generator), position_distribution(generator), 15});
+    }
+
+    return anchors;
+}
+
+void set_counters(benchmark::State & state, size_t const anchor_count)
+{
+    state.counters["anchors"] = benchmark::Counter(static_cast<double>(anchor_count * state.iterations()),
+                                                   benchmark::Counter::kIsRate);
+}
+
+void chain_range_maximum(benchmark::State & state)
+{
+    std::vector<anchor> anchors = generate_anchors(state.range(0));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(chain_anchors(anchors, linear_chain_gap_cost{0.1}));
+
+    set_counters(state, anchors.size());
+}
+
+void chain_bounded_look_back(benchmark::State & state)
+{
+    std::vector<anchor> anchors = generate_anchors(state.range(0));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(chain_anchors(anchors, linear_chain_gap_cost{0.1}, chain_look_back{50}));
+
+    set_counters(state, anchors.size());
+}
+
+// Compares all pairs of anchors like a hand-written quadratic chaining.
+void chain_all_pairs(benchmark::State & state)
+{
+    std::vector<anchor> anchors = generate_anchors(state.range(0));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(chain_anchors(anchors, linear_chain_gap_cost{0.1},
+                                               chain_look_back{anchors.size()}));
+
+    set_counters(state, anchors.size());
+}
+
+BENCHMARK(chain_range_maximum)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+BENCHMARK(chain_bounded_look_back)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+BENCHMARK(chain_all_pairs)->RangeMultiplier(10)->Range(1'000, 10'000);
+
+BENCHMARK_MAIN();
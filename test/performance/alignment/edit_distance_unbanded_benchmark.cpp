@@ -210,6 +210,80 @@ void seqan2_edit_distance_dna4_generic_collection(benchmark::State & state)
 }
 #endif // SEQAN3_HAS_SEQAN2
 
+// ============================================================================
+//  edit_distance; score; dna4; set; short
+// ============================================================================
+
+// Aligns many short sequence pairs that fit into a single machine word. The benchmark argument selects whether
+// seqan3::align_cfg::vectorise is configured.
+void seqan3_edit_distance_dna4_short_collection(benchmark::State & state)
+{
+    size_t sequence_length = 50;
+    size_t set_size = 1000;
+
+    auto vec = generate_sequence_pairs<seqan3::dna4>(sequence_length, set_size);
+    int score = 0;
+
+    if (state.range(0) == 0)
+    {
+        for (auto _ : state)
+            for (auto && rng : align_pairwise(vec, edit_distance_cfg))
+                score += rng.score();
+    }
+    else
+    {
+        for (auto _ : state)
+            for (auto && rng : align_pairwise(vec, edit_distance_cfg | align_cfg::vectorise))
+                score += rng.score();
+    }
+
+    state.counters["score"] = score;
+    state.counters["cells"] = pairwise_cell_updates(vec, edit_distance_cfg);
+    state.counters["CUPS"] = cell_updates_per_second(state.counters["cells"]);
+}
+
+// ============================================================================
+//  edit_distance; score; dna4; banded
+// ============================================================================
+
+// Verifies a read against a reference window that contains the read with some substitutions. The band width is
+// given by the benchmark argument; a band width of 0 computes the unbanded edit distance.
+void seqan3_edit_distance_dna4_banded(benchmark::State & state)
+{
+    int64_t const band_width = state.range(0);
+    size_t const read_length = 500;
+    auto window = generate_sequence<seqan3::dna4>(read_length + 20, 0, 0);
+    std::vector<seqan3::dna4> read(window.begin() + 10, window.begin() + 10 + read_length);
+    for (size_t i = 0; i < read_length; i += 50)
+        read[i].assign_rank((seqan3::to_rank(read[i]) + 1) % 4);
+
+    auto semi_global_cfg = edit_distance_cfg | align_cfg::aligned_ends{free_ends_first};
+    int score = 0;
+
+    // The cells of the band are counted, such that the CUPS of the banded and the unbanded runs are comparable.
+    if (band_width == 0)
+    {
+        for (auto _ : state)
+            for (auto && rng : align_pairwise(std::tie(window, read), semi_global_cfg))
+                score += rng.score();
+
+        state.counters["cells"] = pairwise_cell_updates(std::views::single(std::tie(window, read)), semi_global_cfg);
+    }
+    else
+    {
+        auto banded_cfg = semi_global_cfg | align_cfg::band{static_band{lower_bound{10 - band_width / 2},
+                                                                        upper_bound{10 + band_width / 2}}};
+        for (auto _ : state)
+            for (auto && rng : align_pairwise(std::tie(window, read), banded_cfg))
+                score += rng.score();
+
+        state.counters["cells"] = pairwise_cell_updates(std::views::single(std::tie(window, read)), banded_cfg);
+    }
+
+    state.counters["score"] = score;
+    state.counters["CUPS"] = cell_updates_per_second(state.counters["cells"]);
+}
+
 // ============================================================================
 //  instantiate tests
 // ============================================================================
@@ -227,5 +301,7 @@ BENCHMARK(seqan3_edit_distance_dna4_collection_selector);
 BENCHMARK(seqan2_edit_distance_dna4_collection);
 BENCHMARK(seqan2_edit_distance_dna4_generic_collection);
 #endif
+BENCHMARK(seqan3_edit_distance_dna4_short_collection)->Arg(0)->Arg(1);
+BENCHMARK(seqan3_edit_distance_dna4_banded)->Arg(0)->Arg(8)->Arg(32)->Arg(128);
 
 BENCHMARK_MAIN();
@@ -55,6 +55,26 @@ void seqan3_affine_dna4(benchmark::State & state)
 
 BENCHMARK(seqan3_affine_dna4);
 
+void seqan3_affine_dna4_vectorised_long(benchmark::State & state)
+{
+    // A single pair cannot fill the simd vector and is computed along the anti-diagonals.
+    size_t sequence_length = state.range(0);
+    auto seq1 = generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2),
+                                  affine_cfg | align_cfg::result{with_score} | align_cfg::vectorise);
+        *seqan3::begin(rng);
+    }
+
+    state.counters["cells"] = pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
+    state.counters["CUPS"] = cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK(seqan3_affine_dna4_vectorised_long)->Arg(500)->Arg(10'000);
+
 #ifdef SEQAN3_HAS_SEQAN2
 
 void seqan2_affine_dna4(benchmark::State & state)
@@ -151,6 +171,33 @@ void seqan3_affine_dna4_collection(benchmark::State & state)
 
 BENCHMARK(seqan3_affine_dna4_collection);
 
+void seqan3_affine_dna4_collection_result_buffer(benchmark::State & state)
+{
+    // Short sequences, for which the type-erased call and the result vector per chunk are noticeable.
+    size_t sequence_length = state.range(0);
+    size_t set_size = 1000;
+    using sequence_t = decltype(generate_sequence<seqan3::dna4>());
+
+    std::vector<std::pair<sequence_t, sequence_t>> vec;
+    for (unsigned i = 0; i < set_size; ++i)
+    {
+        sequence_t seq1 = generate_sequence<seqan3::dna4>(sequence_length, 0, i);
+        sequence_t seq2 = generate_sequence<seqan3::dna4>(sequence_length, 0, i + set_size);
+        vec.push_back(std::pair{seq1, seq2});
+    }
+
+    auto cfg = affine_cfg | align_cfg::result{with_score};
+    std::vector<std::ranges::range_value_t<decltype(align_pairwise(vec, cfg))>> results(set_size);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(align_pairwise(vec, cfg, results));
+
+    state.counters["cells"] = pairwise_cell_updates(vec, affine_cfg);
+    state.counters["CUPS"] = cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK(seqan3_affine_dna4_collection_result_buffer)->Arg(20)->Arg(100);
+
 #ifdef SEQAN3_HAS_SEQAN2
 
 void seqan2_affine_dna4_collection(benchmark::State & state)
@@ -256,4 +303,90 @@ BENCHMARK(seqan2_affine_dna4_trace_collection);
 //  instantiate tests
 // ============================================================================
 
+void seqan3_affine_dna4_vectorised_mixed_length(benchmark::State & state)
+{
+    // Lengths between 50 and 1000 in random order; a window of 0 keeps the input order.
+    size_t const window = state.range(0);
+    size_t set_size = 256;
+    using sequence_t = decltype(generate_sequence<seqan3::dna4>());
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<size_t> length_distribution{50, 1000};
+
+    std::vector<std::pair<sequence_t, sequence_t>> vec;
+    for (unsigned i = 0; i < set_size; ++i)
+    {
+        size_t const sequence_length = length_distribution(gen);
+        sequence_t seq1 = generate_sequence<seqan3::dna4>(sequence_length, 0, i);
+        sequence_t seq2 = generate_sequence<seqan3::dna4>(sequence_length, 0, i + set_size);
+        vec.push_back(std::pair{seq1, seq2});
+    }
+
+    auto run = [&] (auto const & cfg)
+    {
+        for (auto _ : state)
+        {
+            for (auto && rng : align_pairwise(vec, cfg))
+                rng.score();
+        }
+    };
+
+    auto cfg = affine_cfg | align_cfg::result{with_score} | align_cfg::vectorise;
+    if (window == 0u)
+        run(cfg);
+    else
+        run(cfg | align_cfg::length_binning{static_cast<uint32_t>(window)});
+
+    state.counters["cells"] = pairwise_cell_updates(vec, affine_cfg);
+    state.counters["CUPS"] = cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK(seqan3_affine_dna4_vectorised_mixed_length)->Arg(0)->Arg(64)->Arg(256);
+
+void seqan3_affine_dna4_vectorised_banded(benchmark::State & state)
+{
+    // Read verification: similar pairs of 150 bases within a band of the given width; a width of 0 disables the band.
+    size_t const band_width = state.range(0);
+    size_t sequence_length = 150;
+    size_t set_size = 1024;
+    using sequence_t = decltype(generate_sequence<seqan3::dna4>());
+
+    std::vector<std::pair<sequence_t, sequence_t>> vec;
+    for (unsigned i = 0; i < set_size; ++i)
+    {
+        sequence_t seq1 = generate_sequence<seqan3::dna4>(sequence_length, 0, i);
+        sequence_t seq2 = seq1;
+        for (size_t position = i % 10u; position < seq2.size(); position += 25u)
+            seq2[position] = seqan3::dna4{}.assign_rank((seqan3::to_rank(seq2[position]) + 1u) % 4u);
+        vec.push_back(std::pair{seq1, seq2});
+    }
+
+    auto run = [&] (auto const & cfg)
+    {
+        for (auto _ : state)
+        {
+            for (auto && rng : align_pairwise(vec, cfg))
+                rng.score();
+        }
+    };
+
+    auto cfg = affine_cfg | align_cfg::result{with_score} | align_cfg::vectorise;
+    if (band_width == 0u)
+    {
+        run(cfg);
+    }
+    else
+    {
+        int32_t const half_width = band_width / 2;
+        run(cfg | align_cfg::band{static_band{lower_bound{-half_width}, upper_bound{half_width}}});
+    }
+
+    // The cells of the unbanded matrices, such that the CUPS of the banded and unbanded runs are comparable.
+    state.counters["cells"] = pairwise_cell_updates(vec, affine_cfg);
+    state.counters["CUPS"] = cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK(seqan3_affine_dna4_vectorised_banded)->Arg(0)->Arg(8)->Arg(32);
+
+
 BENCHMARK_MAIN();
@@ -15,6 +15,7 @@
 
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/aminoacid/aa20.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/range/views/zip.hpp>
 
@@ -239,6 +240,49 @@ void seqan2_affine_dna4_trace_collection(benchmark::State & state)
 BENCHMARK(seqan2_affine_dna4_trace_collection);
 #endif // SEQAN3_HAS_SEQAN2
 
+// ============================================================================
+//  affine; score; aa27; collection
+// ============================================================================
+
+void seqan3_affine_aa27_blosum62_collection(benchmark::State & state)
+{
+    // Arg 0 computes the pairs one by one, arg 1 computes them vectorised with the column profile.
+    bool const vectorised = state.range(0);
+    using sequence_t = decltype(generate_sequence<seqan3::aa27>());
+
+    std::vector<std::pair<sequence_t, sequence_t>> vec;
+    for (unsigned i = 0; i < 256; ++i)
+    {
+        sequence_t seq1 = generate_sequence<seqan3::aa27>(300, 0, i);
+        sequence_t seq2 = generate_sequence<seqan3::aa27>(300, 0, i + 256);
+        vec.push_back(std::pair{seq1, seq2});
+    }
+
+    auto cfg = align_cfg::mode{local_alignment} |
+               align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+               align_cfg::scoring{aminoacid_scoring_scheme{aminoacid_similarity_matrix::BLOSUM62}} |
+               align_cfg::result{with_score};
+
+    auto run = [&] (auto const & run_cfg)
+    {
+        for (auto _ : state)
+        {
+            for (auto && rng : align_pairwise(vec, run_cfg))
+                rng.score();
+        }
+    };
+
+    if (vectorised)
+        run(cfg | align_cfg::vectorise);
+    else
+        run(cfg);
+
+    state.counters["cells"] = pairwise_cell_updates(vec, cfg);
+    state.counters["CUPS"] = cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK(seqan3_affine_aa27_blosum62_collection)->Arg(0)->Arg(1);
+
 // ============================================================================
 //  instantiate tests
 // ============================================================================
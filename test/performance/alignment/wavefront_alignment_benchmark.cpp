@@ -0,0 +1,94 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/units.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/std/ranges>
+
+using namespace seqan3;
+using namespace seqan3::test;
+
+constexpr auto affine_cfg = align_cfg::mode{global_alignment} |
+                            align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                            align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}};
+
+// Aliases to beautify the benchmark output
+using score = detail::with_score_type;
+using trace = detail::with_alignment_type;
+
+// The second sequence differs from the first one by a substitution every 1000 and a deletion every 5000 characters.
+std::pair<std::vector<dna4>, std::vector<dna4>> generate_similar_pair(size_t const sequence_length)
+{
+    std::vector<dna4> seq1 = generate_sequence<dna4>(sequence_length, 0, 0);
+    std::vector<dna4> seq2{};
+    seq2.reserve(sequence_length);
+
+    for (size_t idx = 0; idx < sequence_length; ++idx)
+    {
+        if (idx % 5000u == 2500u)
+            continue;
+
+        seq2.push_back((idx % 1000u == 500u) ? dna4{}.assign_rank((seq1[idx].to_rank() + 1) % 4) : seq1[idx]);
+    }
+
+    return {std::move(seq1), std::move(seq2)};
+}
+
+// ============================================================================
+//  affine; dna4; single; similar sequences
+// ============================================================================
+
+template <typename result_t>
+void seqan3_wavefront_affine_dna4(benchmark::State & state)
+{
+    auto [seq1, seq2] = generate_similar_pair(state.range(0));
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2),
+                                  affine_cfg | align_cfg::result{result_t{}} | align_cfg::wavefront);
+        *seqan3::begin(rng);
+    }
+
+    state.counters["cells"] = pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
+    state.counters["CUPS"] = cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK_TEMPLATE(seqan3_wavefront_affine_dna4, score)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(seqan3_wavefront_affine_dna4, trace)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+
+// The dynamic programming algorithm computes all cells, which limits the sequence lengths.
+template <typename result_t>
+void seqan3_affine_dna4(benchmark::State & state)
+{
+    auto [seq1, seq2] = generate_similar_pair(state.range(0));
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), affine_cfg | align_cfg::result{result_t{}});
+        *seqan3::begin(rng);
+    }
+
+    state.counters["cells"] = pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
+    state.counters["CUPS"] = cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK_TEMPLATE(seqan3_affine_dna4, score)->Arg(10'000);
+BENCHMARK_TEMPLATE(seqan3_affine_dna4, trace)->Arg(10'000);
+
+// ============================================================================
+//  instantiate tests
+// ============================================================================
+
+BENCHMARK_MAIN();
@@ -0,0 +1,281 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+// This suite covers the search over the cross product of
+//   * errors:    0 (exact) to 4 errors,
+//   * algorithm: search schemes (seqan3::bi_fm_index) versus trivial backtracking (seqan3::fm_index),
+//   * alphabet:  seqan3::dna4, seqan3::dna5 and seqan3::aa27,
+//   * layout:    seqan3::text_layout::single versus seqan3::text_layout::collection,
+//   * text size: 1 MB up to 1 GB (sizes above 1 MB are only registered if SEQAN3_LARGE_SEARCH_BENCHMARK is defined),
+//   * repeats:   the percentage of the text that is a mutated copy of another region of the text,
+//   * workload:  locate-heavy (seqan3::search_cfg::text_position) versus
+//                count-heavy (seqan3::search_cfg::index_cursor).
+//
+// Trivial backtracking over seqan3::aa27 explores 27 branches per error, hence it is only run with more than 2 errors
+// if SEQAN3_LARGE_SEARCH_BENCHMARK is defined.
+//
+// The ctest driver writes the results as JSON into the build directory (see test/performance/CMakeLists.txt). To
+// compare two builds, run the benchmark directly with
+//   --benchmark_out=<file>.json --benchmark_out_format=json
+// and diff the files with tools/compare.py shipped with google benchmark.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/search/algorithm/search.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using namespace seqan3;
+using namespace seqan3::test;
+
+// ============================================================================
+//  data generation
+// ============================================================================
+
+// Number of reads that are searched per benchmark iteration.
+inline constexpr size_t number_of_reads = 100;
+// Length of the simulated reads.
+inline constexpr size_t read_length = 50;
+// Length of a single repeat copy in the synthetic genome.
+inline constexpr size_t repeat_length = 1'000;
+// Number of texts the synthetic genome is split into for the collection layout.
+inline constexpr size_t collection_size = 10;
+
+/* Generates a synthetic genome of the given length. First a random sequence is generated and then non-overlapping
+ * blocks of repeat_length many symbols are overwritten with copies of randomly chosen other blocks, until
+ * repeat_percentage percent of the genome are repeats. Every copied symbol is substituted with a probability of 1% so
+ * that the repeats are similar but not identical.
+ */
+template <typename alphabet_t>
+std::vector<alphabet_t> generate_genome(size_t const genome_length, size_t const repeat_percentage,
+                                        size_t const seed = 0)
+{
+    std::vector<alphabet_t> genome = generate_sequence<alphabet_t>(genome_length, 0, seed);
+
+    size_t const number_of_blocks = genome_length / repeat_length;
+    size_t const number_of_repeats = number_of_blocks * repeat_percentage / 100;
+
+    if (number_of_blocks < 2 || number_of_repeats == 0)
+        return genome;
+
+    std::mt19937_64 gen{seed};
+    std::uniform_int_distribution<size_t> dis_block{0, number_of_blocks - 1};
+    std::uniform_int_distribution<size_t> dis_rank{0, alphabet_size<alphabet_t> - 1};
+    std::bernoulli_distribution dis_mutate{0.01};
+
+    // Choose the blocks that are overwritten and never copy from a block that will be overwritten.
+    std::vector<bool> is_repeat(number_of_blocks, false);
+    for (size_t repeats = 0; repeats < number_of_repeats;)
+    {
+        size_t const block = dis_block(gen);
+        if (!is_repeat[block])
+        {
+            is_repeat[block] = true;
+            ++repeats;
+        }
+    }
+
+    for (size_t target_block = 0; target_block < number_of_blocks; ++target_block)
+    {
+        if (!is_repeat[target_block])
+            continue;
+
+        size_t source_block = dis_block(gen);
+        while (is_repeat[source_block])
+            source_block = dis_block(gen);
+
+        for (size_t i = 0; i < repeat_length; ++i)
+        {
+            alphabet_t & symbol = genome[target_block * repeat_length + i];
+            symbol = genome[source_block * repeat_length + i];
+
+            if (dis_mutate(gen))
+                symbol.assign_rank(dis_rank(gen));
+        }
+    }
+
+    return genome;
+}
+
+// Splits the genome into collection_size many texts of (almost) equal length.
+template <typename alphabet_t>
+std::vector<std::vector<alphabet_t>> split_genome(std::vector<alphabet_t> const & genome)
+{
+    std::vector<std::vector<alphabet_t>> collection;
+    size_t const text_length = std::ranges::size(genome) / collection_size;
+
+    for (size_t i = 0; i < collection_size; ++i)
+    {
+        auto text_begin = std::ranges::begin(genome) + i * text_length;
+        auto text_end = (i + 1 == collection_size) ? std::ranges::end(genome) : text_begin + text_length;
+        collection.emplace_back(text_begin, text_end);
+    }
+
+    return collection;
+}
+
+// Samples reads from the genome and substitutes exactly `errors` many distinct positions of each read.
+template <typename alphabet_t>
+std::vector<std::vector<alphabet_t>> sample_reads(std::vector<alphabet_t> const & genome, uint8_t const errors,
+                                                  size_t const seed = 0)
+{
+    std::mt19937_64 gen{seed};
+    std::uniform_int_distribution<size_t> dis_position{0, std::ranges::size(genome) - read_length};
+    std::uniform_int_distribution<size_t> dis_read_position{0, read_length - 1};
+    std::uniform_int_distribution<size_t> dis_rank{1, alphabet_size<alphabet_t> - 1};
+
+    std::vector<std::vector<alphabet_t>> reads;
+    reads.reserve(number_of_reads);
+
+    for (size_t i = 0; i < number_of_reads; ++i)
+    {
+        size_t const position = dis_position(gen);
+        std::vector<alphabet_t> read{std::ranges::begin(genome) + position,
+                                     std::ranges::begin(genome) + position + read_length};
+
+        std::vector<bool> is_mutated(read_length, false);
+        for (uint8_t e = 0; e < errors;)
+        {
+            size_t const read_position = dis_read_position(gen);
+            if (is_mutated[read_position])
+                continue;
+
+            // Adding a rank in [1, sigma) modulo sigma guarantees a different symbol.
+            alphabet_t & symbol = read[read_position];
+            symbol.assign_rank((to_rank(symbol) + dis_rank(gen)) % alphabet_size<alphabet_t>);
+            is_mutated[read_position] = true;
+            ++e;
+        }
+
+        reads.push_back(std::move(read));
+    }
+
+    return reads;
+}
+
+// ============================================================================
+//  search; errors x scheme x alphabet x layout x text size x repeats x output
+// ============================================================================
+
+// Tags for the workload type.
+struct locate_workload {};
+struct count_workload {};
+
+/* The arguments are:
+ *   0: the text size in symbols,
+ *   1: the number of errors (applied both during simulation and search),
+ *   2: the repeat percentage of the text.
+ */
+template <typename index_t, typename workload_t>
+void search_benchmark(benchmark::State & state)
+{
+    using alphabet_t = typename index_t::alphabet_type;
+
+    size_t const text_size = state.range(0);
+    uint8_t const errors = state.range(1);
+    size_t const repeat_percentage = state.range(2);
+
+    std::vector<alphabet_t> genome = generate_genome<alphabet_t>(text_size, repeat_percentage);
+    std::vector<std::vector<alphabet_t>> reads = sample_reads(genome, errors);
+
+    auto index = [&] ()
+    {
+        if constexpr (index_t::text_layout_mode == text_layout::single)
+            return index_t{genome};
+        else
+            return index_t{split_genome(genome)};
+    }();
+
+    configuration const error_cfg = search_cfg::max_error{search_cfg::total{errors}};
+
+    size_t hits = 0;
+    size_t occurrences = 0;
+
+    if constexpr (std::same_as<workload_t, locate_workload>)
+    {
+        configuration const cfg = error_cfg | search_cfg::output{search_cfg::text_position};
+
+        for (auto _ : state)
+        {
+            for (auto && query_results : search(reads, index, cfg))
+            {
+                hits += std::ranges::size(query_results);
+                benchmark::DoNotOptimize(query_results);
+            }
+        }
+    }
+    else
+    {
+        configuration const cfg = error_cfg | search_cfg::output{search_cfg::index_cursor};
+
+        for (auto _ : state)
+        {
+            for (auto && query_results : search(reads, index, cfg))
+            {
+                hits += std::ranges::size(query_results);
+                for (auto && cursor : query_results)
+                    occurrences += cursor.count();
+            }
+        }
+    }
+
+    state.counters["reads"] = benchmark::Counter(number_of_reads, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["hits"] = benchmark::Counter(hits, benchmark::Counter::kAvgIterations);
+    state.counters["occurrences"] = benchmark::Counter(occurrences, benchmark::Counter::kAvgIterations);
+}
+
+#ifdef SEQAN3_LARGE_SEARCH_BENCHMARK
+inline std::vector<int64_t> const text_sizes{1'000'000, 10'000'000, 100'000'000, 1'000'000'000};
+inline constexpr int64_t max_aa27_backtracking_errors = 4;
+#else
+inline std::vector<int64_t> const text_sizes{1'000'000};
+inline constexpr int64_t max_aa27_backtracking_errors = 2;
+#endif // SEQAN3_LARGE_SEARCH_BENCHMARK
+
+// Registers text size x errors up to max_errors x repeat percentage.
+template <int64_t max_errors>
+static void arguments(benchmark::internal::Benchmark * b)
+{
+    for (int64_t text_size : text_sizes)
+        for (int64_t errors = 0; errors <= max_errors; ++errors)
+            for (int64_t repeat_percentage : {0, 50})
+                b->Args({text_size, errors, repeat_percentage});
+
+    b->ArgNames({"text_size", "errors", "repeats"});
+    b->Unit(benchmark::kMillisecond);
+}
+
+#define SEQAN3_REGISTER_SEARCH_BENCHMARK(alphabet_t, workload_t, backtracking_errors)                            \
+    BENCHMARK_TEMPLATE(search_benchmark, bi_fm_index<alphabet_t, text_layout::single>, workload_t)                \
+        ->Apply(arguments<4>);                                                                                    \
+    BENCHMARK_TEMPLATE(search_benchmark, bi_fm_index<alphabet_t, text_layout::collection>, workload_t)            \
+        ->Apply(arguments<4>);                                                                                    \
+    BENCHMARK_TEMPLATE(search_benchmark, fm_index<alphabet_t, text_layout::single>, workload_t)                   \
+        ->Apply(arguments<backtracking_errors>);                                                                  \
+    BENCHMARK_TEMPLATE(search_benchmark, fm_index<alphabet_t, text_layout::collection>, workload_t)               \
+        ->Apply(arguments<backtracking_errors>);
+
+SEQAN3_REGISTER_SEARCH_BENCHMARK(dna4, locate_workload, 4)
+SEQAN3_REGISTER_SEARCH_BENCHMARK(dna4, count_workload, 4)
+SEQAN3_REGISTER_SEARCH_BENCHMARK(dna5, locate_workload, 4)
+SEQAN3_REGISTER_SEARCH_BENCHMARK(dna5, count_workload, 4)
+SEQAN3_REGISTER_SEARCH_BENCHMARK(aa27, locate_workload, max_aa27_backtracking_errors)
+SEQAN3_REGISTER_SEARCH_BENCHMARK(aa27, count_workload, max_aa27_backtracking_errors)
+
+#undef SEQAN3_REGISTER_SEARCH_BENCHMARK
+
+// ============================================================================
+//  instantiate tests
+// ============================================================================
+
+BENCHMARK_MAIN();
@@ -0,0 +1,35 @@
+#include <vector>
+
+#include <seqan3/alignment/chaining/all.hpp>
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/range/views/slice.hpp>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    auto reference = "GATTACAGATTACAACGTGACTGACTGGCAATCGATTTACGTAGGCATCGATCGAGTCAGT"_dna4;
+    auto read = "ACGTGACTGTCTGGCAATCGATTACGTAGGC"_dna4;
+
+    // Exact matches between the reference and the read, e.g. merged from shared k-mers; the last one is a repeat.
+    std::vector<seqan3::anchor> anchors{{14, 0, 9}, {24, 10, 11}, {36, 21, 10}, {46, 16, 6}};
+
+    std::vector<seqan3::anchor_chain> chains = seqan3::chain_anchors(anchors, seqan3::linear_chain_gap_cost{0.5});
+    seqan3::alignment_window window = chains.front().window(reference.size(), read.size(), 4);
+
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{}} |
+                  seqan3::align_cfg::band{window.band} |
+                  seqan3::align_cfg::result{seqan3::with_score};
+    auto reference_infix = reference | seqan3::views::slice(window.first_begin, window.first_end);
+    auto read_infix = read | seqan3::views::slice(window.second_begin, window.second_end);
+
+    for (auto && result : seqan3::align_pairwise(std::tie(reference_infix, read_infix), config))
+        seqan3::debug_stream << "Chain score: " << chains.front().score << ", alignment score: " << result.score()
+                             << '\n';
+}
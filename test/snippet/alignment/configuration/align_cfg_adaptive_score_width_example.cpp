@@ -0,0 +1,8 @@
+#include <seqan3/alignment/configuration/align_config_adaptive_score_width.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorise.hpp>
+
+int main()
+{
+    // Compute the vectorised alignments with 8 or 16 bit scores whenever the sequences are short enough.
+    auto cfg = seqan3::align_cfg::vectorise | seqan3::align_cfg::adaptive_score_width;
+}
@@ -0,0 +1,8 @@
+#include <seqan3/alignment/configuration/align_config_length_binning.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorise.hpp>
+
+int main()
+{
+    // Sort windows of 512 sequence pairs by length before they are distributed to the simd vectors.
+    auto cfg = seqan3::align_cfg::vectorise | seqan3::align_cfg::length_binning{512};
+}
@@ -0,0 +1,7 @@
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+
+int main()
+{
+    // Only alignments with a score of at least 100 are of interest.
+    seqan3::align_cfg::min_score cfg{100};
+}
@@ -0,0 +1,28 @@
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    std::vector<seqan3::dna4> genome{"ACGTTTACGATTTACCTGAACGT"_dna4};
+    std::vector<seqan3::dna4> pattern{"ACGT"_dna4};
+
+    // Report every end position of the pattern in the genome with at most one error.
+    auto config = seqan3::align_cfg::edit |
+                  seqan3::align_cfg::aligned_ends{seqan3::free_ends_first} |
+                  seqan3::align_cfg::max_error{1u} |
+                  seqan3::align_cfg::on_hit{[] (size_t id, seqan3::alignment_coordinate end, int32_t score)
+                  {
+                      seqan3::debug_stream << "pair " << id << ": hit ending at " << end.first
+                                           << " with score " << score << '\n';
+                  }};
+
+    for (auto && result : seqan3::align_pairwise(std::tie(genome, pattern), config))
+        seqan3::debug_stream << "best score: " << result.score() << '\n';
+}
@@ -0,0 +1,26 @@
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_statistics.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+using seqan3::operator""_dna4;
+
+int main()
+{
+    std::vector<seqan3::dna4> sequence1 = "ACGTGACTGACT"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "AGGTACGAGTGACT"_dna4;
+
+    // The statistics must outlive the alignment range.
+    seqan3::alignment_statistics statistics{};
+    auto cfg = seqan3::align_cfg::edit | seqan3::align_cfg::statistics{&statistics};
+
+    for (auto const & result : seqan3::align_pairwise(std::tie(sequence1, sequence2), cfg))
+        seqan3::debug_stream << "Score: " << result.score() << '\n';
+
+    seqan3::debug_stream << "Alignments: " << statistics.alignments() << '\n'
+                         << "Cells: " << statistics.cells() << '\n';
+}
@@ -0,0 +1,9 @@
+#include <seqan3/alignment/configuration/align_config_thread_pool.hpp>
+#include <seqan3/core/parallel/thread_pool.hpp>
+
+int main()
+{
+    // Create the worker threads once and share them between all alignment calls.
+    seqan3::thread_pool pool{4};
+    seqan3::align_cfg::thread_pool cfg{&pool};
+}
@@ -0,0 +1,8 @@
+#include <seqan3/alignment/configuration/align_config_mode.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+
+int main()
+{
+    // Compute the global alignment of long and similar sequences with the wavefront alignment algorithm.
+    auto cfg = seqan3::align_cfg::mode{seqan3::global_alignment} | seqan3::align_cfg::wavefront;
+}
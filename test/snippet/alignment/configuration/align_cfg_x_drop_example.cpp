@@ -0,0 +1,7 @@
+#include <seqan3/alignment/configuration/align_config_x_drop.hpp>
+
+int main()
+{
+    // Stop extending once the score drops more than 20 below the best score.
+    seqan3::align_cfg::x_drop cfg{20};
+}
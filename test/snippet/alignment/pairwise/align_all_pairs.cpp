@@ -0,0 +1,23 @@
+#include <mutex>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_all_pairs.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    std::vector sequences{"ACGTGACTGACT"_dna4, "ACGAGACTGACT"_dna4, "AGTGCTACG"_dna4, "ACGTGACTGTCT"_dna4};
+
+    // Report every pair with at most two errors; the callback is invoked concurrently by both threads.
+    std::mutex output_mutex{};
+    auto config = seqan3::align_cfg::edit | seqan3::align_cfg::min_score{-2} | seqan3::align_cfg::parallel{2};
+    seqan3::align_all_pairs(sequences, config, [&] (size_t const first, size_t const second, auto && result)
+    {
+        std::lock_guard lock{output_mutex};
+        seqan3::debug_stream << first << " and " << second << ": " << result.score() << '\n';
+    });
+}
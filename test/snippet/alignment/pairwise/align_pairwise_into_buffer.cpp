@@ -0,0 +1,29 @@
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    std::vector vec{std::pair{"AGTGCTACG"_dna4, "ACGTGCGACTAG"_dna4},
+                    std::pair{"AGTAGACTACG"_dna4, "ACGTACGACACG"_dna4},
+                    std::pair{"AGTTACGAC"_dna4, "AGTAGCGATCG"_dna4}};
+
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{}} |
+                  seqan3::align_cfg::result{seqan3::with_score};
+
+    // The buffer can be reused for many calls; its element type is the one of the returned alignment range.
+    using result_t = std::ranges::range_value_t<decltype(seqan3::align_pairwise(vec, config))>;
+    std::vector<result_t> results(vec.size());
+
+    size_t const count = seqan3::align_pairwise(vec, config, results);
+    for (size_t i = 0; i < count; ++i)
+        seqan3::debug_stream << "The score: " << results[i].score() << "\n";
+}
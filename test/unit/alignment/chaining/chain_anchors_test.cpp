@@ -0,0 +1,220 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alignment/chaining/chain_anchors.hpp>
+
+using namespace seqan3;
+
+// The best chain score computed by comparing all pairs of anchors.
+template <typename gap_cost_t>
+double best_chain_score(std::vector<anchor> anchors, gap_cost_t const & gap_cost)
+{
+    std::sort(anchors.begin(), anchors.end(), [] (anchor const & lhs, anchor const & rhs)
+    {
+        return lhs.first_position < rhs.first_position;
+    });
+
+    std::vector<double> scores(anchors.size());
+    for (size_t current = 0; current < anchors.size(); ++current)
+    {
+        scores[current] = anchors[current].length;
+        for (size_t candidate = 0; candidate < current; ++candidate)
+        {
+            if (anchors[candidate].first_end() > anchors[current].first_position ||
+                anchors[candidate].second_end() > anchors[current].second_position)
+                continue;
+
+            scores[current] = std::max(scores[current],
+                                       scores[candidate] + anchors[current].length -
+                                       gap_cost(anchors[current].first_position - anchors[candidate].first_end(),
+                                                anchors[current].second_position - anchors[candidate].second_end()));
+        }
+    }
+
+    return *std::max_element(scores.begin(), scores.end());
+}
+
+std::vector<anchor> random_anchors(size_t const count, unsigned const seed)
+{
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<size_t> position_distribution{0, 2000};
+    std::uniform_int_distribution<size_t> offset_distribution{0, 40};
+    std::uniform_int_distribution<size_t> length_distribution{1, 30};
+
+    std::vector<anchor> anchors{};
+    for (size_t index = 0; index < count; ++index)
+    {
+        // Most anchors lie close to the main diagonal such that long chains exist.
+        size_t const position = position_distribution(generator);
+        anchors.push_back(anchor{position, position + offset_distribution(generator), length_distribution(generator)});
+    }
+
+    return anchors;
+}
+
+TEST(anchor, positions)
+{
+    anchor const current{10, 4, 6};
+    EXPECT_EQ(current.first_end(), 16u);
+    EXPECT_EQ(current.second_end(), 10u);
+    EXPECT_EQ(current.diagonal(), 6);
+    EXPECT_EQ((anchor{4, 10, 6}).diagonal(), -6);
+    EXPECT_EQ(current, (anchor{10, 4, 6}));
+    EXPECT_NE(current, (anchor{10, 4, 7}));
+}
+
+TEST(chain_anchors, empty)
+{
+    EXPECT_TRUE(chain_anchors(std::vector<anchor>{}, linear_chain_gap_cost{}).empty());
+    EXPECT_TRUE(chain_anchors(std::vector<anchor>{}, linear_chain_gap_cost{}, chain_look_back{10}).empty());
+}
+
+TEST(chain_anchors, empty_anchor)
+{
+    std::vector<anchor> anchors{{0, 0, 10}, {20, 20, 0}};
+    EXPECT_THROW(chain_anchors(anchors, linear_chain_gap_cost{}), std::invalid_argument);
+    EXPECT_THROW(chain_anchors(anchors, linear_chain_gap_cost{}, chain_look_back{10}), std::invalid_argument);
+}
+
+TEST(chain_anchors, colinear_chain)
+{
+    std::vector<anchor> anchors{{30, 30, 10}, {5, 40, 5}, {0, 0, 10}, {15, 12, 10}};
+
+    for (auto const & chains : {chain_anchors(anchors, linear_chain_gap_cost{0.1}),
+                                chain_anchors(anchors, linear_chain_gap_cost{0.1}, chain_look_back{4})})
+    {
+        ASSERT_EQ(chains.size(), 2u);
+        EXPECT_EQ(chains[0].anchors, (std::vector<anchor>{{0, 0, 10}, {15, 12, 10}, {30, 30, 10}}));
+        EXPECT_DOUBLE_EQ(chains[0].score, 30.0 - 0.1 * (5 + 2) - 0.1 * (5 + 8));
+        EXPECT_EQ(chains[1].anchors, (std::vector<anchor>{{5, 40, 5}}));
+        EXPECT_DOUBLE_EQ(chains[1].score, 5.0);
+    }
+
+    // The second chain is dropped by the minimal chain score.
+    EXPECT_EQ(chain_anchors(anchors, linear_chain_gap_cost{0.1}, 10.0).size(), 1u);
+    EXPECT_EQ(chain_anchors(anchors, linear_chain_gap_cost{0.1}, chain_look_back{4}, 10.0).size(), 1u);
+}
+
+TEST(chain_anchors, overlapping_anchors)
+{
+    // The anchors overlap in the second sequence and cannot be chained.
+    std::vector<anchor> anchors{{0, 0, 10}, {10, 5, 10}};
+    std::vector<anchor_chain> chains = chain_anchors(anchors, linear_chain_gap_cost{0.0});
+
+    ASSERT_EQ(chains.size(), 2u);
+    EXPECT_EQ(chains[0].anchors.size(), 1u);
+    EXPECT_EQ(chains[1].anchors.size(), 1u);
+}
+
+TEST(chain_anchors, shared_predecessor)
+{
+    // Both {12, 12, 10} and {12, 40, 10} are best chained after {0, 0, 10}, which belongs to the better chain only.
+    std::vector<anchor> anchors{{0, 0, 10}, {12, 12, 10}, {12, 40, 10}};
+    std::vector<anchor_chain> chains = chain_anchors(anchors, linear_chain_gap_cost{0.1});
+
+    ASSERT_EQ(chains.size(), 2u);
+    EXPECT_EQ(chains[0].anchors, (std::vector<anchor>{{0, 0, 10}, {12, 12, 10}}));
+    EXPECT_DOUBLE_EQ(chains[0].score, 20.0 - 0.1 * (2 + 2));
+    EXPECT_EQ(chains[1].anchors, (std::vector<anchor>{{12, 40, 10}}));
+    EXPECT_DOUBLE_EQ(chains[1].score, 10.0);
+}
+
+TEST(chain_anchors, limited_look_back)
+{
+    // The anchor {5, 100, 5} lies between the two colinear anchors in the order of the first sequence.
+    std::vector<anchor> anchors{{0, 0, 5}, {5, 100, 5}, {10, 10, 5}};
+
+    EXPECT_EQ(chain_anchors(anchors, linear_chain_gap_cost{0.1}, chain_look_back{2})[0].anchors.size(), 2u);
+    EXPECT_EQ(chain_anchors(anchors, linear_chain_gap_cost{0.1}, chain_look_back{1})[0].anchors.size(), 1u);
+}
+
+TEST(chain_anchors, custom_gap_cost)
+{
+    // Penalises the shift between the diagonals of two anchors only.
+    auto diagonal_cost = [] (size_t const first_gap, size_t const second_gap)
+    {
+        return 2.0 * std::abs(static_cast<double>(first_gap) - static_cast<double>(second_gap));
+    };
+
+    std::vector<anchor> anchors{{0, 0, 10}, {100, 100, 10}, {110, 115, 10}};
+    std::vector<anchor_chain> chains = chain_anchors(anchors, diagonal_cost, chain_look_back{10});
+
+    ASSERT_EQ(chains.size(), 1u);
+    EXPECT_EQ(chains[0].anchors.size(), 3u);
+    EXPECT_DOUBLE_EQ(chains[0].score, 30.0 - 2.0 * 5);
+    EXPECT_DOUBLE_EQ(chains[0].score, best_chain_score(anchors, diagonal_cost));
+}
+
+TEST(chain_anchors, random)
+{
+    for (unsigned seed = 0; seed < 10; ++seed)
+    {
+        std::vector<anchor> anchors = random_anchors(300, seed);
+        linear_chain_gap_cost const gap_cost{0.25};
+
+        std::vector<anchor_chain> chains = chain_anchors(anchors, gap_cost);
+        std::vector<anchor_chain> look_back_chains = chain_anchors(anchors, gap_cost, chain_look_back{anchors.size()});
+
+        ASSERT_FALSE(chains.empty());
+        EXPECT_DOUBLE_EQ(chains[0].score, best_chain_score(anchors, gap_cost));
+        EXPECT_DOUBLE_EQ(look_back_chains[0].score, chains[0].score);
+
+        // Every anchor is part of exactly one chain and every chain is colinear.
+        size_t anchor_count = 0u;
+        for (anchor_chain const & chain : chains)
+        {
+            anchor_count += chain.anchors.size();
+            for (size_t index = 1; index < chain.anchors.size(); ++index)
+            {
+                EXPECT_LE(chain.anchors[index - 1].first_end(), chain.anchors[index].first_position);
+                EXPECT_LE(chain.anchors[index - 1].second_end(), chain.anchors[index].second_position);
+            }
+        }
+        EXPECT_EQ(anchor_count, anchors.size());
+        EXPECT_TRUE(std::is_sorted(chains.begin(), chains.end(), [] (auto const & lhs, auto const & rhs)
+        {
+            return lhs.score > rhs.score;
+        }));
+    }
+}
+
+TEST(anchor_chain, window)
+{
+    anchor_chain chain{{{50, 10, 10}, {70, 28, 10}}, 18.0};
+
+    alignment_window window = chain.window(200, 100, 4);
+    EXPECT_EQ(window.first_begin, 46u);
+    EXPECT_EQ(window.first_end, 84u);
+    EXPECT_EQ(window.second_begin, 6u);
+    EXPECT_EQ(window.second_end, 42u);
+    EXPECT_EQ(window.band.lower_bound, -4);
+    EXPECT_EQ(window.band.upper_bound, 6);
+}
+
+TEST(anchor_chain, clipped_window)
+{
+    anchor_chain chain{{{50, 10, 10}, {70, 28, 10}}, 18.0};
+
+    // The window is clipped to the begin of the second sequence and to the end of the first sequence.
+    alignment_window window = chain.window(90, 100, 20);
+    EXPECT_EQ(window.first_begin, 30u);
+    EXPECT_EQ(window.first_end, 90u);
+    EXPECT_EQ(window.second_begin, 0u);
+    EXPECT_EQ(window.second_end, 58u);
+
+    // The band contains the diagonals of the anchors (10 and 12) and of the end of the window (2).
+    EXPECT_EQ(window.band.lower_bound, -20);
+    EXPECT_EQ(window.band.upper_bound, 32);
+}
@@ -0,0 +1,68 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/chaining/detail/prefix_maximum_tree.hpp>
+
+using namespace seqan3;
+
+using tree_t = detail::prefix_maximum_tree<int>;
+
+TEST(prefix_maximum_tree, empty)
+{
+    tree_t tree{5};
+    EXPECT_EQ(tree.size(), 5u);
+    EXPECT_EQ(tree.prefix_maximum(0).second, tree_t::npos);
+    EXPECT_EQ(tree.prefix_maximum(5).second, tree_t::npos);
+    EXPECT_EQ(tree_t{}.size(), 0u);
+}
+
+TEST(prefix_maximum_tree, update)
+{
+    tree_t tree{6};
+    tree.update(2, 10, 0);
+    tree.update(4, 7, 1);
+    tree.update(0, 3, 2);
+
+    EXPECT_EQ(tree.prefix_maximum(1), (tree_t::entry_type{3, 2}));
+    EXPECT_EQ(tree.prefix_maximum(2), (tree_t::entry_type{3, 2}));
+    EXPECT_EQ(tree.prefix_maximum(3), (tree_t::entry_type{10, 0}));
+    EXPECT_EQ(tree.prefix_maximum(6), (tree_t::entry_type{10, 0}));
+
+    // A smaller value does not replace a larger one.
+    tree.update(2, 5, 3);
+    EXPECT_EQ(tree.prefix_maximum(3), (tree_t::entry_type{10, 0}));
+
+    tree.update(5, 11, 4);
+    EXPECT_EQ(tree.prefix_maximum(5), (tree_t::entry_type{10, 0}));
+    EXPECT_EQ(tree.prefix_maximum(6), (tree_t::entry_type{11, 4}));
+}
+
+TEST(prefix_maximum_tree, random)
+{
+    std::mt19937 generator{42};
+    size_t const size = 97;
+    std::uniform_int_distribution<size_t> position_distribution{0, size - 1};
+    std::uniform_int_distribution<int> value_distribution{-1000, 1000};
+
+    tree_t tree{size};
+    std::vector<int> values(size, std::numeric_limits<int>::lowest());
+    for (size_t index = 0; index < 500; ++index)
+    {
+        size_t const position = position_distribution(generator);
+        int const value = value_distribution(generator);
+        tree.update(position, value, index);
+        values[position] = std::max(values[position], value);
+
+        size_t const count = position_distribution(generator) + 1;
+        EXPECT_EQ(tree.prefix_maximum(count).first, *std::max_element(values.begin(), values.begin() + count));
+    }
+}
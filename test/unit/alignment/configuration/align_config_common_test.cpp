@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <type_traits>
 
 #include <seqan3/alignment/configuration/all.hpp>
@@ -19,16 +20,24 @@ template <typename T>
 class alignment_configuration_test : public ::testing::Test
 {};
 
-using test_types = ::testing::Types<align_cfg::aligned_ends<std::remove_const_t<decltype(free_ends_all)>>,
+using test_types = ::testing::Types<detail::adaptive_score_width_tag,
+                                    align_cfg::aligned_ends<std::remove_const_t<decltype(free_ends_all)>>,
                                     align_cfg::band<static_band>,
                                     align_cfg::gap<gap_scheme<>>,
+                                    align_cfg::length_binning,
                                     align_cfg::max_error,
+                                    align_cfg::min_score,
                                     align_cfg::mode<detail::global_alignment_type>,
                                     align_cfg::mode<detail::local_alignment_type>,
+                                    align_cfg::on_hit<std::function<void()>>,
                                     align_cfg::parallel,
                                     align_cfg::result<>,
                                     align_cfg::scoring<nucleotide_scoring_scheme<int8_t>>,
-                                    detail::vectorise_tag>;
+                                    align_cfg::statistics,
+                                    align_cfg::thread_pool,
+                                    detail::vectorise_tag,
+                                    detail::wavefront_tag,
+                                    align_cfg::x_drop>;
 
 TYPED_TEST_SUITE(alignment_configuration_test, test_types, );
 
@@ -53,7 +62,7 @@ TEST(alignment_configuration_test, symmetric_configuration)
 TEST(alignment_configuration_test, number_of_configs)
 {
     // NOTE(rrahn): You must update this test if you add a new value to align_cfg::id
-    EXPECT_EQ(static_cast<uint8_t>(detail::align_config_id::SIZE), 11);
+    EXPECT_EQ(static_cast<uint8_t>(detail::align_config_id::SIZE), 19);
 }
 
 TYPED_TEST(alignment_configuration_test, config_element)
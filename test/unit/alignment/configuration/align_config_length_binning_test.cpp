@@ -0,0 +1,41 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_length_binning.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+
+using namespace seqan3;
+
+TEST(align_config_length_binning, config_element)
+{
+    EXPECT_TRUE((detail::config_element<align_cfg::length_binning>));
+}
+
+TEST(align_config_length_binning, configuration)
+{
+    {
+        align_cfg::length_binning elem{256};
+        configuration cfg{elem};
+        EXPECT_EQ((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::length_binning>(cfg).value)>,
+                                  uint32_t>), true);
+
+        EXPECT_EQ(get<align_cfg::length_binning>(cfg).value, 256u);
+    }
+
+    {
+        configuration cfg{align_cfg::length_binning{256}};
+        EXPECT_EQ((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::length_binning>(cfg).value)>,
+                                  uint32_t>), true);
+
+        EXPECT_EQ(get<align_cfg::length_binning>(cfg).value, 256u);
+    }
+}
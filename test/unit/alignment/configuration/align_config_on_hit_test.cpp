@@ -0,0 +1,33 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_on_hit.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+
+using namespace seqan3;
+
+TEST(align_config_on_hit, config_element)
+{
+    auto callback = [] (size_t, auto, int) { return false; };
+    EXPECT_TRUE((detail::config_element<align_cfg::on_hit<decltype(callback)>>));
+}
+
+TEST(align_config_on_hit, configuration)
+{
+    size_t hits{};
+    configuration cfg{align_cfg::on_hit{[&hits] (size_t, auto, int) { ++hits; }}};
+
+    EXPECT_TRUE(decltype(cfg)::template exists<align_cfg::on_hit>());
+
+    get<align_cfg::on_hit>(cfg).value(0u, 0, 0);
+    get<align_cfg::on_hit>(cfg).value(1u, 0, 0);
+    EXPECT_EQ(hits, 2u);
+}
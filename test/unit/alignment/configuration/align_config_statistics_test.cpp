@@ -0,0 +1,42 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_statistics.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+
+using namespace seqan3;
+
+TEST(align_config_statistics, config_element)
+{
+    EXPECT_TRUE((detail::config_element<align_cfg::statistics>));
+}
+
+TEST(align_config_statistics, configuration)
+{
+    alignment_statistics statistics{};
+
+    {
+        align_cfg::statistics elem{&statistics};
+        configuration cfg{elem};
+        EXPECT_EQ((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::statistics>(cfg).value)>,
+                                  alignment_statistics *>), true);
+
+        EXPECT_EQ(get<align_cfg::statistics>(cfg).value, &statistics);
+    }
+
+    {
+        configuration cfg{align_cfg::statistics{&statistics}};
+        EXPECT_EQ((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::statistics>(cfg).value)>,
+                                  alignment_statistics *>), true);
+
+        EXPECT_EQ(get<align_cfg::statistics>(cfg).value, &statistics);
+    }
+}
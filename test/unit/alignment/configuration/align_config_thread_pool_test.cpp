@@ -0,0 +1,31 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_thread_pool.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+
+using namespace seqan3;
+
+TEST(align_config_thread_pool, config_element)
+{
+    EXPECT_TRUE((detail::config_element<align_cfg::thread_pool>));
+}
+
+TEST(align_config_thread_pool, configuration)
+{
+    seqan3::thread_pool pool{2};
+    configuration cfg{align_cfg::thread_pool{&pool}};
+
+    EXPECT_TRUE((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::thread_pool>(cfg).value)>,
+                                seqan3::thread_pool *>));
+    EXPECT_EQ(get<align_cfg::thread_pool>(cfg).value, &pool);
+    EXPECT_EQ(get<align_cfg::thread_pool>(cfg).value->size(), 2u);
+}
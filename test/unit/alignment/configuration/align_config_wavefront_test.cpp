@@ -0,0 +1,45 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/configuration/align_config_mode.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+
+using namespace seqan3;
+
+TEST(align_config_wavefront, config_element)
+{
+    configuration cfg{seqan3::align_cfg::wavefront};
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::detail::wavefront_tag>());
+}
+
+TEST(align_config_wavefront, with_global_alignment)
+{
+    auto cfg = seqan3::align_cfg::mode{seqan3::global_alignment} | seqan3::align_cfg::wavefront;
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::detail::wavefront_tag>());
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::mode<seqan3::detail::global_alignment_type>>());
+}
+
+TEST(align_config_wavefront, compatibility)
+{
+    using detail::align_config_id;
+    auto const & table = detail::compatibility_table<align_config_id>;
+    auto compatible = [&] (align_config_id const id)
+    {
+        return table[static_cast<uint8_t>(align_config_id::wavefront)][static_cast<uint8_t>(id)];
+    };
+
+    EXPECT_TRUE(compatible(align_config_id::global));
+    EXPECT_TRUE(compatible(align_config_id::parallel));
+    EXPECT_TRUE(compatible(align_config_id::thread_pool));
+    EXPECT_FALSE(compatible(align_config_id::local));
+    EXPECT_FALSE(compatible(align_config_id::band));
+    EXPECT_FALSE(compatible(align_config_id::vectorise));
+}
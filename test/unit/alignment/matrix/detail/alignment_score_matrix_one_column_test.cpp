@@ -42,6 +42,23 @@ INSTANTIATE_TYPED_TEST_SUITE_P(one_column,
                                simulated_alignment_test,
                                alignment_score_matrix_one_column_test<int32_t>, );
 
+// The matrix was used for a larger sequence pair before and is reset to the current one.
+template <typename t>
+struct alignment_score_matrix_one_column_reset_test : public alignment_score_matrix_one_column_test<t>
+{
+    using typename alignment_score_matrix_one_column_test<t>::matrix_t;
+
+    alignment_score_matrix_one_column_reset_test(std::string f, std::string s)
+    {
+        this->matrix = matrix_t{std::string(10, 'a'), std::string(12, 'b'), 7};
+        this->matrix.reset(f, s, -100);
+    }
+};
+
+INSTANTIATE_TYPED_TEST_SUITE_P(one_column_reset,
+                               simulated_alignment_test,
+                               alignment_score_matrix_one_column_reset_test<int32_t>, );
+
 using test_type = std::pair<detail::alignment_score_matrix_one_column<int32_t>, std::false_type>;
 
 INSTANTIATE_TYPED_TEST_SUITE_P(one_column,
@@ -0,0 +1,151 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/packed_trace_matrix.hpp>
+#include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix_iterator_concept.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/iterator>
+
+using namespace seqan3;
+using namespace seqan3::detail;
+
+struct packed_trace_matrix_test : public ::testing::Test
+{
+    static constexpr trace_directions N = trace_directions::none;
+    static constexpr trace_directions D = trace_directions::diagonal;
+    static constexpr trace_directions U = trace_directions::up;
+    static constexpr trace_directions UO = trace_directions::up_open;
+    static constexpr trace_directions L = trace_directions::left;
+    static constexpr trace_directions LO = trace_directions::left_open;
+
+    two_dimensional_matrix<trace_directions> matrix{number_rows{3}, number_cols{4}, std::vector
+    {
+        N,           LO, L,          L,
+        UO, D | LO | UO, L, D | L | UO,
+        U,       LO | U, D,          L
+    }};
+
+    packed_trace_matrix packed_matrix() const
+    {
+        packed_trace_matrix packed{number_rows{3}, number_cols{4}};
+
+        for (size_t col = 0; col < 4u; ++col)
+        {
+            std::vector<trace_directions> column{};
+            for (size_t row = 0; row < 3u; ++row)
+                column.push_back(matrix[matrix_coordinate{row_index_type{row}, column_index_type{col}}]);
+
+            packed.assign_column(matrix_coordinate{row_index_type{0u}, column_index_type{col}}, column);
+        }
+
+        return packed;
+    }
+};
+
+TEST_F(packed_trace_matrix_test, concepts)
+{
+    EXPECT_TRUE(std::ranges::random_access_range<packed_trace_matrix>);
+    EXPECT_TRUE(std::random_access_iterator<packed_trace_matrix::iterator>);
+    EXPECT_TRUE(two_dimensional_matrix_iterator<packed_trace_matrix::iterator>);
+}
+
+TEST_F(packed_trace_matrix_test, construction)
+{
+    packed_trace_matrix packed{number_rows{3}, number_cols{5}};
+
+    EXPECT_EQ(packed.rows(), 3u);
+    EXPECT_EQ(packed.cols(), 5u);
+    EXPECT_EQ(std::ranges::distance(packed), 15);
+    EXPECT_TRUE(std::ranges::all_of(packed, [] (trace_directions const trace) { return trace == N; }));
+}
+
+TEST_F(packed_trace_matrix_test, resize)
+{
+    packed_trace_matrix packed = packed_matrix();
+
+    packed.resize(number_rows{2}, number_cols{5});
+    EXPECT_EQ(packed.rows(), 2u);
+    EXPECT_EQ(packed.cols(), 5u);
+    EXPECT_EQ(std::ranges::distance(packed), 10);
+    EXPECT_TRUE(std::ranges::all_of(packed, [] (trace_directions const trace) { return trace == N; }));
+
+    packed.resize(number_rows{7}, number_cols{3});
+    EXPECT_EQ(std::ranges::distance(packed), 21);
+    EXPECT_TRUE(std::ranges::all_of(packed, [] (trace_directions const trace) { return trace == N; }));
+}
+
+TEST_F(packed_trace_matrix_test, assign_column)
+{
+    packed_trace_matrix packed{number_rows{4}, number_cols{2}};
+    std::vector<trace_directions> column{D | U, L | LO};
+
+    // A slice in the middle of the column leaves the other cells untouched.
+    packed.assign_column(matrix_coordinate{row_index_type{1u}, column_index_type{1u}}, column);
+
+    EXPECT_EQ((packed[matrix_coordinate{row_index_type{0u}, column_index_type{1u}}]), N);
+    EXPECT_EQ((packed[matrix_coordinate{row_index_type{1u}, column_index_type{1u}}]), D);
+    EXPECT_EQ((packed[matrix_coordinate{row_index_type{2u}, column_index_type{1u}}]), L | LO);
+    EXPECT_EQ((packed[matrix_coordinate{row_index_type{3u}, column_index_type{1u}}]), N);
+}
+
+TEST_F(packed_trace_matrix_test, decoding)
+{
+    packed_trace_matrix packed{number_rows{6}, number_cols{1}};
+    std::vector<trace_directions> column{N, UO, D | UO | LO, U | L, LO, D | U | L};
+
+    packed.assign_column(matrix_coordinate{row_index_type{0u}, column_index_type{0u}}, column);
+
+    // Only the preferred direction and the gap open flags are kept.
+    EXPECT_EQ((packed | views::to<std::vector>), (std::vector{N, U | UO, D | UO | LO, U, L | LO, D}));
+}
+
+TEST_F(packed_trace_matrix_test, iterator)
+{
+    packed_trace_matrix packed = packed_matrix();
+    auto it = packed.begin() + matrix_offset{row_index_type{2}, column_index_type{1}};
+
+    EXPECT_EQ(it.coordinate().row, 2u);
+    EXPECT_EQ(it.coordinate().col, 1u);
+    EXPECT_EQ(*it, U | LO);
+
+    it -= matrix_offset{row_index_type{1}, column_index_type{1}};
+    EXPECT_EQ(it.coordinate().row, 1u);
+    EXPECT_EQ(it.coordinate().col, 0u);
+    EXPECT_EQ(*it, U | UO);
+    EXPECT_EQ(it - packed.begin(), 1);
+}
+
+TEST_F(packed_trace_matrix_test, same_trace_paths)
+{
+    packed_trace_matrix packed = packed_matrix();
+
+    for (std::ptrdiff_t col = 0; col < 4; ++col)
+    {
+        for (std::ptrdiff_t row = 0; row < 3; ++row)
+        {
+            matrix_offset const offset{row_index_type{row}, column_index_type{col}};
+
+            trace_iterator expected_it{matrix.begin() + offset};
+            trace_iterator packed_it{packed.begin() + offset};
+
+            std::vector expected = std::ranges::subrange{expected_it, std::ranges::default_sentinel}
+                                 | views::to<std::vector>;
+            std::vector actual = std::ranges::subrange{packed_it, std::ranges::default_sentinel}
+                               | views::to<std::vector>;
+
+            EXPECT_EQ(actual, expected);
+        }
+    }
+}
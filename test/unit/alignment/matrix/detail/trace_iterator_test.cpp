@@ -11,8 +11,11 @@
 #include <vector>
 
 #include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
+#include <seqan3/alignment/matrix/detail/trace_matrix_lane_iterator.hpp>
 #include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
 #include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/core/simd/simd_algorithm.hpp>
+#include <seqan3/core/simd/simd.hpp>
 #include <seqan3/range/views/to.hpp>
 #include <seqan3/std/iterator>
 
@@ -180,6 +183,47 @@ TEST_F(trace_iterator_fixture, coordinate)
     EXPECT_EQ(it.coordinate().col, 0u);
 }
 
+TEST_F(trace_iterator_fixture, simd_lane)
+{
+    using simd_t = simd::simd_type_t<int8_t>;
+
+    // The first lane stores the matrix of the fixture, all other lanes only go up in the first column.
+    two_dimensional_matrix<simd_t> simd_matrix{number_rows{3}, number_cols{4}};
+    for (size_t col = 0; col < 4u; ++col)
+    {
+        for (size_t row = 0; row < 3u; ++row)
+        {
+            matrix_coordinate const coordinate{row_index_type{row}, column_index_type{col}};
+            simd_matrix[coordinate] = simd::fill<simd_t>(static_cast<int8_t>((col == 0u && row > 0u) ? U : N));
+            simd_matrix[coordinate][0] = static_cast<int8_t>(matrix[coordinate]);
+        }
+    }
+
+    using lane_iterator_t = trace_matrix_lane_iterator<decltype(simd_matrix.begin())>;
+    using lane_path_t = std::ranges::subrange<trace_iterator<lane_iterator_t>, std::ranges::default_sentinel_t>;
+
+    EXPECT_TRUE(two_dimensional_matrix_iterator<lane_iterator_t>);
+
+    auto lane_path = [&] (size_t const lane, matrix_offset const & offset)
+    {
+        return lane_path_t{trace_iterator{lane_iterator_t{simd_matrix.begin() + offset, lane}},
+                           std::ranges::default_sentinel};
+    };
+
+    for (size_t col = 0; col < 4u; ++col)
+    {
+        for (size_t row = 0; row < 3u; ++row)
+        {
+            matrix_offset const offset{matrix_coordinate{row_index_type{row}, column_index_type{col}}};
+            EXPECT_EQ(lane_path(0u, offset) | views::to<std::vector>, path(offset) | views::to<std::vector>);
+        }
+    }
+
+    std::vector vec = lane_path(1u, matrix_offset{row_index_type{2}, column_index_type{0}}) | views::to<std::vector>;
+    EXPECT_EQ(vec, (std::vector{U, U}));
+    EXPECT_EQ(lane_path(1u, matrix_offset{row_index_type{2}, column_index_type{3}}).begin().coordinate().col, 3u);
+}
+
 //-----------------------------------------------------------------------------
 // Iterator tests
 //-----------------------------------------------------------------------------
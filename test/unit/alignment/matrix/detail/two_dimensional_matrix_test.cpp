@@ -176,6 +176,34 @@ TYPED_TEST(two_dimensional_matrix_test, rows)
     EXPECT_EQ(matrix.rows(), 3u);
 }
 
+TYPED_TEST(two_dimensional_matrix_test, resize)
+{
+    using score_type = typename TestFixture::score_type;
+
+    auto matrix = this->matrix;
+    auto const * data = matrix.data();
+
+    // Shrinking keeps the memory and value initialises all cells.
+    matrix.resize(number_rows{2}, number_cols{3});
+    EXPECT_EQ(matrix.rows(), 2u);
+    EXPECT_EQ(matrix.cols(), 3u);
+    EXPECT_EQ(matrix.data(), data);
+    EXPECT_EQ(std::ranges::distance(matrix), 6);
+    for (auto cell : matrix)
+        this->expect_eq(cell, score_type{});
+
+    matrix.resize(number_rows{3}, number_cols{4});
+    EXPECT_EQ(matrix.data(), data);
+    EXPECT_EQ(std::ranges::distance(matrix), 12);
+
+    matrix.resize(number_rows{5}, number_cols{7});
+    EXPECT_EQ(matrix.rows(), 5u);
+    EXPECT_EQ(matrix.cols(), 7u);
+    EXPECT_EQ(std::ranges::distance(matrix), 35);
+    for (auto cell : matrix)
+        this->expect_eq(cell, score_type{});
+}
+
 TYPED_TEST(two_dimensional_matrix_test, range)
 {
     // For an explanation how this works see iterator_fixture further below in this file.
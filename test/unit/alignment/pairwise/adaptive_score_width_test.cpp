@@ -0,0 +1,106 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/detail/adaptive_score_width_algorithm.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using namespace seqan3;
+
+struct adaptive_score_width_test : public ::testing::Test
+{
+    static constexpr auto base_cfg = align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                                     align_cfg::scoring{nucleotide_scoring_scheme{match_score{4},
+                                                                                  mismatch_score{-5}}} |
+                                     align_cfg::vectorise;
+
+    // With the scores above, pairs up to length 12 fit into int8_t and up to length 4675 into int16_t.
+    static std::vector<std::pair<std::vector<dna4>, std::vector<dna4>>> generate_sequences(size_t const long_length)
+    {
+        std::vector<std::pair<std::vector<dna4>, std::vector<dna4>>> sequences{};
+
+        for (size_t seed = 0; seed < 40u; ++seed)
+        {
+            size_t const length = (seed % 4u == 3u) ? long_length : ((seed % 4u == 2u) ? 100u : seed / 2u);
+            sequences.emplace_back(test::generate_sequence<dna4>(length, length / 10u, seed),
+                                   test::generate_sequence<dna4>(length, length / 10u, seed + 100u));
+        }
+
+        return sequences;
+    }
+
+    template <bool with_alignment, typename align_cfg_t>
+    static void check(std::vector<std::pair<std::vector<dna4>, std::vector<dna4>>> const & sequences,
+                      align_cfg_t const & cfg)
+    {
+        auto expected = align_pairwise(sequences, cfg) | views::to<std::vector>;
+        auto actual = align_pairwise(sequences, cfg | align_cfg::adaptive_score_width) | views::to<std::vector>;
+
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+        {
+            EXPECT_EQ(actual[idx].id(), expected[idx].id());
+            EXPECT_EQ(actual[idx].score(), expected[idx].score());
+            EXPECT_EQ(actual[idx].back_coordinate(), expected[idx].back_coordinate());
+
+            if constexpr (with_alignment)
+            {
+                EXPECT_EQ(actual[idx].front_coordinate(), expected[idx].front_coordinate());
+                EXPECT_EQ(actual[idx].alignment(), expected[idx].alignment());
+            }
+        }
+    }
+};
+
+TEST_F(adaptive_score_width_test, max_representable_sequence_size)
+{
+    using detail::max_representable_sequence_size;
+
+    EXPECT_EQ(max_representable_sequence_size<int8_t>(11, 1, 5), 12);
+    EXPECT_EQ(max_representable_sequence_size<int16_t>(11, 1, 5), 4675);
+    EXPECT_EQ(max_representable_sequence_size<int8_t>(0, 0, 0), 126);
+    EXPECT_EQ(max_representable_sequence_size<int8_t>(50, 1, 5), -1);
+}
+
+TEST_F(adaptive_score_width_test, back_coordinate)
+{
+    auto sequences = generate_sequences(5000u);
+
+    check<false>(sequences, align_cfg::mode{global_alignment} | base_cfg | align_cfg::result{with_back_coordinate});
+    check<false>(sequences, align_cfg::mode{local_alignment} | base_cfg | align_cfg::result{with_back_coordinate});
+    check<false>(sequences, align_cfg::mode{global_alignment} | align_cfg::aligned_ends{free_ends_first} | base_cfg |
+                            align_cfg::result{with_back_coordinate});
+}
+
+TEST_F(adaptive_score_width_test, alignment)
+{
+    auto sequences = generate_sequences(300u);
+
+    check<true>(sequences, align_cfg::mode{global_alignment} | base_cfg | align_cfg::result{with_alignment});
+    check<true>(sequences, align_cfg::mode{local_alignment} | base_cfg | align_cfg::result{with_alignment});
+    check<true>(sequences, align_cfg::mode{global_alignment} | align_cfg::aligned_ends{free_ends_all} | base_cfg |
+                           align_cfg::result{with_alignment});
+}
+
+TEST_F(adaptive_score_width_test, without_vectorise)
+{
+    std::vector<dna4> sequence1{"ACGTGACTGACTGACTGATCGATC"_dna4};
+    std::vector<dna4> sequence2{"ACGTCAGTCAGTGACTGATCGA"_dna4};
+    auto cfg = align_cfg::mode{global_alignment} | align_cfg::edit | align_cfg::result{with_score};
+
+    EXPECT_EQ((*align_pairwise(std::tie(sequence1, sequence2), cfg | align_cfg::adaptive_score_width).begin()).score(),
+              (*align_pairwise(std::tie(sequence1, sequence2), cfg).begin()).score());
+}
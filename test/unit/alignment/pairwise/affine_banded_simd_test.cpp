@@ -0,0 +1,80 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/alignment_sequence_pairs.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using namespace seqan3;
+
+struct affine_banded_simd_test : public ::testing::Test
+{
+    static constexpr auto base_cfg = align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                                     align_cfg::scoring{nucleotide_scoring_scheme{match_score{4},
+                                                                                  mismatch_score{-5}}};
+
+    // Pairs of similar sequences whose sizes differ by up to 4, such that every simd vector mixes different sizes.
+    // Hence, the sinks of all pairs lie within bands of at least [-4, 4].
+    test::sequence_pair_collection<dna4> sequences = test::similar_sequence_pairs<dna4>(
+        100u,
+        [] (size_t const seed) { return std::pair{50u + seed % 30u, 50u + seed % 30u + seed % 9u - 4u}; },
+        [] (size_t const seed) { return std::pair{seed % 7u, 11u}; });
+
+    template <typename align_cfg_t>
+    void check(align_cfg_t const & cfg)
+    {
+        test::expect_same_alignments(sequences, cfg, cfg | align_cfg::vectorise, [] (auto const & result)
+        {
+            return std::tuple{result.score(), result.back_coordinate()};
+        });
+    }
+};
+
+TEST_F(affine_banded_simd_test, global)
+{
+    check(align_cfg::mode{global_alignment} | base_cfg | align_cfg::result{with_back_coordinate} |
+          align_cfg::band{static_band{lower_bound{-8}, upper_bound{8}}});
+}
+
+TEST_F(affine_banded_simd_test, global_asymmetric_band)
+{
+    check(align_cfg::mode{global_alignment} | base_cfg | align_cfg::result{with_back_coordinate} |
+          align_cfg::band{static_band{lower_bound{-4}, upper_bound{20}}});
+    check(align_cfg::mode{global_alignment} | base_cfg | align_cfg::result{with_back_coordinate} |
+          align_cfg::band{static_band{lower_bound{-20}, upper_bound{4}}});
+}
+
+TEST_F(affine_banded_simd_test, global_score_only)
+{
+    check(align_cfg::mode{global_alignment} | base_cfg | align_cfg::result{with_score} |
+          align_cfg::band{static_band{lower_bound{-4}, upper_bound{4}}});
+}
+
+TEST_F(affine_banded_simd_test, local)
+{
+    check(align_cfg::mode{local_alignment} | base_cfg | align_cfg::result{with_back_coordinate} |
+          align_cfg::band{static_band{lower_bound{-8}, upper_bound{8}}});
+}
+
+TEST_F(affine_banded_simd_test, invalid_band)
+{
+    auto cfg = align_cfg::mode{global_alignment} | base_cfg | align_cfg::result{with_score} | align_cfg::vectorise |
+               align_cfg::band{static_band{lower_bound{200}, upper_bound{300}}};
+
+    EXPECT_THROW((align_pairwise(sequences, cfg) | views::to<std::vector>), invalid_alignment_configuration);
+}
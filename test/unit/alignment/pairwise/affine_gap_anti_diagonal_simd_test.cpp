@@ -0,0 +1,119 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/detail/affine_gap_anti_diagonal_simd.hpp>
+#include <seqan3/alignment/scoring/detail/simd_match_mismatch_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/simd/simd.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using namespace seqan3;
+using namespace seqan3::detail;
+
+struct affine_gap_anti_diagonal_simd_test : public ::testing::Test
+{
+    using score_t = simd_type_t<int32_t>;
+
+    static constexpr auto base_cfg = align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                                     align_cfg::scoring{nucleotide_scoring_scheme{match_score{4},
+                                                                                  mismatch_score{-5}}} |
+                                     align_cfg::result{with_back_coordinate};
+
+    // Pairs of various lengths, including empty sequences and sequences shorter than a simd vector.
+    std::vector<std::pair<std::vector<dna4>, std::vector<dna4>>> sequences
+    {
+        {""_dna4, ""_dna4},
+        {"ACGT"_dna4, ""_dna4},
+        {""_dna4, "ACGT"_dna4},
+        {"A"_dna4, "ACGTACGTACGTACGTACGT"_dna4},
+        {"AACCGGTTAACCGGTT"_dna4, "ACGTACGTA"_dna4},
+        {test::generate_sequence<dna4>(150, 0, 0), test::generate_sequence<dna4>(120, 0, 1)},
+        {test::generate_sequence<dna4>(97, 0, 2), test::generate_sequence<dna4>(203, 0, 3)}
+    };
+
+    template <bool is_local, typename alignment_t, typename align_cfg_t>
+    void check(align_cfg_t const & cfg, std::array<bool, 4> const free_ends)
+    {
+        simd_match_mismatch_scoring_scheme<score_t, dna4, alignment_t> scoring_scheme
+        {
+            nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}
+        };
+        affine_gap_anti_diagonal_simd<score_t, is_local> algorithm{-11, -1, free_ends};
+
+        auto expected = align_pairwise(sequences, cfg) | views::to<std::vector>;
+        ASSERT_EQ(expected.size(), sequences.size());
+
+        for (size_t idx = 0u; idx < sequences.size(); ++idx)
+        {
+            auto optimum = algorithm(sequences[idx].first, sequences[idx].second, scoring_scheme);
+
+            EXPECT_EQ(optimum.score, expected[idx].score());
+            EXPECT_EQ(optimum.column_index, expected[idx].back_coordinate().first);
+            EXPECT_EQ(optimum.row_index, expected[idx].back_coordinate().second);
+        }
+    }
+};
+
+TEST_F(affine_gap_anti_diagonal_simd_test, global)
+{
+    check<false, global_alignment_type>(align_cfg::mode{global_alignment} | base_cfg, {false, false, false, false});
+}
+
+TEST_F(affine_gap_anti_diagonal_simd_test, semi_global)
+{
+    check<false, global_alignment_type>(align_cfg::mode{global_alignment} |
+                                        align_cfg::aligned_ends{free_ends_first} | base_cfg,
+                                        {true, true, false, false});
+    check<false, global_alignment_type>(align_cfg::mode{global_alignment} |
+                                        align_cfg::aligned_ends{free_ends_all} | base_cfg,
+                                        {true, true, true, true});
+}
+
+TEST_F(affine_gap_anti_diagonal_simd_test, local)
+{
+    check<true, local_alignment_type>(align_cfg::mode{local_alignment} | base_cfg, {false, false, false, false});
+}
+
+TEST_F(affine_gap_anti_diagonal_simd_test, is_representable)
+{
+    affine_gap_anti_diagonal_simd<score_t, false> algorithm{-11, -1, {false, false, false, false}};
+
+    EXPECT_TRUE(algorithm.is_representable(1'000'000u, 1'000'000u, 5));
+    EXPECT_FALSE(algorithm.is_representable(100'000'000u, 100'000'000u, 5));
+}
+
+TEST_F(affine_gap_anti_diagonal_simd_test, align_pairwise_single_pair)
+{
+    // A single long pair does not fill the simd vector and is computed along the anti-diagonals.
+    std::vector<dna4> sequence1 = test::generate_sequence<dna4>(1000, 0, 4);
+    std::vector<dna4> sequence2 = test::generate_sequence<dna4>(800, 0, 5);
+
+    auto check_single_pair = [&] (auto const & cfg)
+    {
+        auto expected = align_pairwise(std::tie(sequence1, sequence2), cfg) | views::to<std::vector>;
+        auto results = align_pairwise(std::tie(sequence1, sequence2), cfg | align_cfg::vectorise)
+                     | views::to<std::vector>;
+
+        ASSERT_EQ(results.size(), 1u);
+        EXPECT_EQ(results[0].score(), expected[0].score());
+        EXPECT_EQ(results[0].back_coordinate(), expected[0].back_coordinate());
+    };
+
+    check_single_pair(align_cfg::mode{global_alignment} | base_cfg);
+    check_single_pair(align_cfg::mode{global_alignment} | align_cfg::aligned_ends{free_ends_all} | base_cfg);
+    check_single_pair(align_cfg::mode{local_alignment} | base_cfg);
+}
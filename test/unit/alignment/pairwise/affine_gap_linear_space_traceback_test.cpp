@@ -0,0 +1,148 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/detail/affine_gap_linear_space_traceback.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using namespace seqan3;
+using namespace seqan3::detail;
+
+struct affine_gap_linear_space_traceback_test : public ::testing::Test
+{
+    static constexpr auto base_cfg = align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                                     align_cfg::scoring{nucleotide_scoring_scheme{match_score{4},
+                                                                                  mismatch_score{-5}}} |
+                                     align_cfg::result{with_alignment};
+
+    // Pairs of various lengths; the long pairs are split several times before the full matrix is used.
+    std::vector<std::pair<std::vector<dna4>, std::vector<dna4>>> sequences
+    {
+        {""_dna4, ""_dna4},
+        {"ACGT"_dna4, ""_dna4},
+        {""_dna4, "ACGT"_dna4},
+        {"A"_dna4, "ACGTACGTACGTACGTACGT"_dna4},
+        {"AACCGGTTAACCGGTT"_dna4, "ACGTACGTA"_dna4},
+        {test::generate_sequence<dna4>(150, 0, 0), test::generate_sequence<dna4>(120, 0, 1)},
+        {test::generate_sequence<dna4>(97, 0, 2), test::generate_sequence<dna4>(203, 0, 3)},
+        {test::generate_sequence<dna4>(500, 0, 4), test::generate_sequence<dna4>(450, 0, 4)}
+    };
+
+    // Rescores the alignment with the scores of base_cfg.
+    template <typename alignment_t>
+    static int32_t alignment_score(alignment_t const & alignment)
+    {
+        int32_t score = 0;
+        int gap_state = 0; // 0: no gap, 1: gap in the first sequence, 2: gap in the second sequence
+
+        for (size_t pos = 0u; pos < std::ranges::size(alignment.first); ++pos)
+        {
+            auto const first = alignment.first[pos];
+            auto const second = alignment.second[pos];
+            int const state = (first == gap{}) ? 1 : ((second == gap{}) ? 2 : 0);
+
+            if (state == 0)
+                score += (to_rank(first) == to_rank(second)) ? 4 : -5;
+            else
+                score += (state == gap_state) ? -1 : -11;
+
+            gap_state = state;
+        }
+
+        return score;
+    }
+
+    template <bool is_local, typename align_cfg_t>
+    void check(align_cfg_t const & cfg, std::array<bool, 4> const free_ends)
+    {
+        nucleotide_scoring_scheme scoring_scheme{match_score{4}, mismatch_score{-5}};
+        affine_gap_linear_space_traceback<int32_t, is_local> algorithm{-11, -1, free_ends};
+
+        auto expected = align_pairwise(sequences, cfg) | views::to<std::vector>;
+        ASSERT_EQ(expected.size(), sequences.size());
+
+        for (size_t idx = 0u; idx < sequences.size(); ++idx)
+        {
+            auto & [sequence1, sequence2] = sequences[idx];
+            auto result = algorithm(sequence1, sequence2, scoring_scheme);
+
+            EXPECT_EQ(result.optimum.score, expected[idx].score());
+            EXPECT_EQ(result.optimum.column_index, expected[idx].back_coordinate().first);
+            EXPECT_EQ(result.optimum.row_index, expected[idx].back_coordinate().second);
+
+            // Another co-optimal alignment might be found, so only its score is compared.
+            aligned_sequence_builder builder{sequence1, sequence2};
+            auto trace_res = builder(result.trace_path());
+
+            EXPECT_EQ(trace_res.first_sequence_slice_positions.second, result.optimum.column_index);
+            EXPECT_EQ(trace_res.second_sequence_slice_positions.second, result.optimum.row_index);
+            EXPECT_EQ(alignment_score(trace_res.alignment), expected[idx].score());
+
+            if (!is_local && !free_ends[0] && !free_ends[2])
+            {
+                EXPECT_EQ(trace_res.first_sequence_slice_positions.first, 0u);
+                EXPECT_EQ(trace_res.second_sequence_slice_positions.first, 0u);
+            }
+        }
+    }
+};
+
+TEST_F(affine_gap_linear_space_traceback_test, global)
+{
+    check<false>(align_cfg::mode{global_alignment} | base_cfg, {false, false, false, false});
+}
+
+TEST_F(affine_gap_linear_space_traceback_test, semi_global)
+{
+    check<false>(align_cfg::mode{global_alignment} | align_cfg::aligned_ends{free_ends_first} | base_cfg,
+                 {true, true, false, false});
+    check<false>(align_cfg::mode{global_alignment} | align_cfg::aligned_ends{free_ends_second} | base_cfg,
+                 {false, false, true, true});
+    check<false>(align_cfg::mode{global_alignment} | align_cfg::aligned_ends{free_ends_all} | base_cfg,
+                 {true, true, true, true});
+}
+
+TEST_F(affine_gap_linear_space_traceback_test, local)
+{
+    check<true>(align_cfg::mode{local_alignment} | base_cfg, {false, false, false, false});
+}
+
+TEST_F(affine_gap_linear_space_traceback_test, trace_path)
+{
+    std::vector<dna4> sequence1{"ACGTTTACGT"_dna4};
+    std::vector<dna4> sequence2{"ACGTACGT"_dna4};
+
+    affine_gap_linear_space_traceback<int32_t, false> algorithm{-11, -1, {false, false, false, false}};
+    auto result = algorithm(sequence1, sequence2, nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}});
+
+    EXPECT_EQ(result.optimum.score, 20);
+    EXPECT_EQ(result.trace.size(), 10u);
+
+    auto path = result.trace_path();
+    auto it = path.begin();
+    EXPECT_EQ(it.coordinate().col, 10u);
+    EXPECT_EQ(it.coordinate().row, 8u);
+    EXPECT_EQ(*it, trace_directions::diagonal);
+
+    for (; it != std::ranges::default_sentinel; ++it)
+    {}
+
+    EXPECT_EQ(it.coordinate().col, 0u);
+    EXPECT_EQ(it.coordinate().row, 0u);
+}
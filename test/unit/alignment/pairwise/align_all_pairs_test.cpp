@@ -0,0 +1,183 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_all_pairs.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/pairwise_combine.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using namespace seqan3;
+
+TEST(all_pairs_tiling, covers_every_pair_once)
+{
+    for (size_t sequence_count : {0u, 1u, 2u, 7u, 16u, 33u})
+    {
+        for (size_t tile_size : {1u, 3u, 4u, 50u})
+        {
+            detail::all_pairs_tiling tiling{sequence_count, tile_size};
+            std::vector<size_t> coverage(sequence_count * sequence_count, 0u);
+
+            for (size_t tile_index = 0; tile_index < tiling.size(); ++tile_index)
+            {
+                auto tile = tiling[tile_index];
+                EXPECT_LE(tile.first_end - tile.first_begin, tile_size);
+                EXPECT_LE(tile.second_end - tile.second_begin, tile_size);
+
+                for (size_t second = tile.second_begin; second < tile.second_end; ++second)
+                    for (size_t first = tile.first_begin; first < std::min(tile.first_end, second); ++first)
+                        ++coverage[first * sequence_count + second];
+            }
+
+            for (size_t first = 0; first < sequence_count; ++first)
+                for (size_t second = 0; second < sequence_count; ++second)
+                    EXPECT_EQ(coverage[first * sequence_count + second], (first < second) ? 1u : 0u);
+        }
+    }
+}
+
+TEST(all_pairs_tiling, tile_size_for)
+{
+    // Two tiles of 1024 sequences with 100 bytes each fit into the cache.
+    EXPECT_EQ(detail::all_pairs_tiling::tile_size_for(100'000u, 100'000u * 100u, 1u), 1024u);
+    // Long sequences do not share a tile.
+    EXPECT_EQ(detail::all_pairs_tiling::tile_size_for(100u, 100u * 1'000'000u, 1u), 1u);
+    // Every thread gets at least eight tiles.
+    size_t const tile_size = detail::all_pairs_tiling::tile_size_for(200u, 200u * 10u, 4u);
+    EXPECT_GE(detail::all_pairs_tiling{200u, tile_size}.size(), 32u);
+}
+
+struct align_all_pairs_test : public ::testing::Test
+{
+    std::vector<std::vector<dna4>> sequences{};
+
+    align_all_pairs_test()
+    {
+        for (size_t seed = 0; seed < 40u; ++seed)
+            sequences.push_back(test::generate_sequence<dna4>(50u, 20u, seed));
+    }
+
+    // The scores of all pairs as computed by align_pairwise.
+    template <typename config_t>
+    std::map<std::pair<size_t, size_t>, int32_t> expected_scores(config_t const & config) const
+    {
+        std::map<std::pair<size_t, size_t>, int32_t> scores{};
+        auto results = align_pairwise(views::pairwise_combine(sequences), config);
+        auto result_it = results.begin();
+
+        for (size_t first = 0; first < sequences.size(); ++first)
+        {
+            for (size_t second = first + 1; second < sequences.size(); ++second, ++result_it)
+                scores[{first, second}] = (*result_it).score();
+        }
+
+        return scores;
+    }
+
+    template <typename config_t>
+    std::map<std::pair<size_t, size_t>, int32_t> all_pairs_scores(config_t const & config) const
+    {
+        std::mutex scores_mutex{};
+        std::map<std::pair<size_t, size_t>, int32_t> scores{};
+
+        align_all_pairs(sequences, config, [&] (size_t const first, size_t const second, auto && result)
+        {
+            std::lock_guard lock{scores_mutex};
+            EXPECT_TRUE(scores.emplace(std::pair{first, second}, result.score()).second);
+        });
+
+        return scores;
+    }
+};
+
+TEST_F(align_all_pairs_test, edit_distance)
+{
+    auto config = align_cfg::edit;
+
+    EXPECT_EQ(all_pairs_scores(config), expected_scores(config));
+}
+
+TEST_F(align_all_pairs_test, affine)
+{
+    auto config = align_cfg::mode{global_alignment} |
+                  align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                  align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}} |
+                  align_cfg::result{with_score};
+
+    EXPECT_EQ(all_pairs_scores(config), expected_scores(config));
+    EXPECT_EQ(all_pairs_scores(config | align_cfg::vectorise), expected_scores(config));
+}
+
+TEST_F(align_all_pairs_test, parallel)
+{
+    auto config = align_cfg::edit | align_cfg::result{with_score};
+
+    EXPECT_EQ(all_pairs_scores(config | align_cfg::parallel{4}), expected_scores(config));
+    EXPECT_THROW(all_pairs_scores(config | align_cfg::parallel{0}), invalid_alignment_configuration);
+}
+
+TEST_F(align_all_pairs_test, min_score)
+{
+    auto config = align_cfg::edit | align_cfg::result{with_score};
+
+    std::map<std::pair<size_t, size_t>, int32_t> expected{};
+    for (auto const & [pair, score] : expected_scores(config))
+        if (score >= -25)
+            expected.emplace(pair, score);
+
+    ASSERT_FALSE(expected.empty());
+    EXPECT_EQ(all_pairs_scores(config | align_cfg::min_score{-25}), expected);
+    EXPECT_EQ(all_pairs_scores(config | align_cfg::min_score{-25} | align_cfg::parallel{4}), expected);
+    EXPECT_THROW(all_pairs_scores(config | align_cfg::min_score{1}), invalid_alignment_configuration);
+}
+
+TEST_F(align_all_pairs_test, min_score_affine)
+{
+    auto config = align_cfg::mode{global_alignment} |
+                  align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                  align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}} |
+                  align_cfg::result{with_score};
+
+    // Only the better half of the pairs reaches the median score.
+    auto const all_scores = expected_scores(config);
+    std::vector<int32_t> scores{};
+    for (auto const & [pair, score] : all_scores)
+        scores.push_back(score);
+    std::nth_element(scores.begin(), scores.begin() + scores.size() / 2u, scores.end());
+    int32_t const median_score = scores[scores.size() / 2u];
+
+    std::map<std::pair<size_t, size_t>, int32_t> expected{};
+    for (auto const & [pair, score] : all_scores)
+        if (score >= median_score)
+            expected.emplace(pair, score);
+
+    ASSERT_LT(expected.size(), all_scores.size());
+    EXPECT_EQ(all_pairs_scores(config | align_cfg::min_score{median_score}), expected);
+}
+
+TEST_F(align_all_pairs_test, exception)
+{
+    auto throwing_callback = [] (size_t, size_t, auto &&)
+    {
+        throw std::runtime_error{"stop"};
+    };
+
+    EXPECT_THROW(align_all_pairs(sequences, align_cfg::edit, throwing_callback), std::runtime_error);
+    EXPECT_THROW(align_all_pairs(sequences, align_cfg::edit | align_cfg::parallel{4}, throwing_callback),
+                 std::runtime_error);
+}
@@ -14,9 +14,11 @@
 
 #include <seqan3/alignment/configuration/all.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/alphabet/nucleotide/all.hpp>
 #include <seqan3/core/concept/tuple.hpp>
+#include <seqan3/core/parallel/thread_pool.hpp>
 #include <seqan3/range/views/to_char.hpp>
 #include <seqan3/range/views/to.hpp>
 #include <seqan3/std/ranges>
@@ -189,3 +191,81 @@ TYPED_TEST(align_pairwise_test, collection_with_double_score_type)
         }
     }
 }
+
+TEST(align_pairwise_thread_pool_test, repeated_calls)
+{
+    auto seq1 = "ACGTGATG"_dna4;
+    auto seq2 = "AGTGATACT"_dna4;
+
+    auto p = std::tie(seq1, seq2);
+    std::vector<decltype(p)> vec{100, p};
+
+    thread_pool pool{4};
+    configuration cfg = align_cfg::edit | align_cfg::result{with_alignment};
+
+    for (size_t round = 0; round < 10u; ++round)
+    {
+        unsigned idx = 0;
+        for (auto && res : align_pairwise(vec, cfg | align_cfg::thread_pool{&pool}))
+        {
+            EXPECT_EQ(res.id(), idx++);
+            EXPECT_EQ(res.score(), -4);
+            auto && [gap1, gap2] = res.alignment();
+            EXPECT_EQ(gap1 | views::to_char | views::to<std::string>, "ACGTGATG--");
+            EXPECT_EQ(gap2 | views::to_char | views::to<std::string>, "A-GTGATACT");
+        }
+        EXPECT_EQ(idx, 100u);
+    }
+
+    EXPECT_THROW(align_pairwise(vec, cfg | align_cfg::thread_pool{nullptr}), invalid_alignment_configuration);
+}
+
+template <typename sequences_t, typename config_t>
+void check_result_buffer(sequences_t & sequences, config_t const & cfg)
+{
+    auto expected = align_pairwise(sequences, cfg) | views::to<std::vector>;
+
+    std::vector<std::ranges::range_value_t<decltype(align_pairwise(sequences, cfg))>> results(sequences.size() + 1);
+    EXPECT_EQ(align_pairwise(sequences, cfg, results), sequences.size());
+
+    for (size_t idx = 0; idx < expected.size(); ++idx)
+    {
+        EXPECT_EQ(results[idx].id(), expected[idx].id());
+        EXPECT_EQ(results[idx].score(), expected[idx].score());
+        EXPECT_EQ(results[idx].back_coordinate(), expected[idx].back_coordinate());
+        EXPECT_EQ(results[idx].front_coordinate(), expected[idx].front_coordinate());
+        EXPECT_EQ(results[idx].alignment(), expected[idx].alignment());
+    }
+}
+
+TEST(align_pairwise_result_buffer_test, same_as_alignment_range)
+{
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{{"ACGTGATG"_dna4, "AGTGATACT"_dna4},
+                                                               {"ACGT"_dna4, "ACGGTAAACGT"_dna4},
+                                                               {""_dna4, "AGT"_dna4},
+                                                               {"AAAACCCCGGGGTTTT"_dna4, "CCCGGGTT"_dna4}};
+
+    auto const affine_cfg = align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                            align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}} |
+                            align_cfg::result{with_alignment};
+
+    check_result_buffer(sequences, align_cfg::mode{global_alignment} | affine_cfg);
+    check_result_buffer(sequences, align_cfg::mode{local_alignment} | affine_cfg);
+    check_result_buffer(sequences, align_cfg::mode{global_alignment} | align_cfg::aligned_ends{free_ends_first} |
+                                   affine_cfg);
+    check_result_buffer(sequences, align_cfg::mode{global_alignment} | affine_cfg | align_cfg::wavefront);
+}
+
+TEST(align_pairwise_result_buffer_test, buffer_too_small)
+{
+    auto seq1 = "ACGTGATG"_dna4;
+    auto seq2 = "AGTGATACT"_dna4;
+    std::vector<decltype(std::tie(seq1, seq2))> sequences{3, std::tie(seq1, seq2)};
+
+    configuration cfg = align_cfg::edit | align_cfg::result{with_score};
+    std::vector<std::ranges::range_value_t<decltype(align_pairwise(sequences, cfg))>> results(2);
+
+    EXPECT_THROW(align_pairwise(sequences, cfg, results), std::invalid_argument);
+    EXPECT_EQ(results[0].score(), -4);
+    EXPECT_EQ(results[1].score(), -4);
+}
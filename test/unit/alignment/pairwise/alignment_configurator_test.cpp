@@ -61,8 +61,9 @@ TEST(alignment_configurator, configure_edit_semi)
 
 TEST(alignment_configurator, configure_edit_banded)
 {
-    EXPECT_THROW((run_test(align_cfg::edit | align_cfg::band{static_band{lower_bound{-1}, upper_bound{1}}})),
-                 invalid_alignment_configuration);
+    EXPECT_EQ(run_test(align_cfg::edit | align_cfg::band{static_band{lower_bound{-1}, upper_bound{1}}}).score(), 0);
+    EXPECT_EQ(run_test(align_cfg::edit | align_cfg::band{static_band{lower_bound{-1}, upper_bound{1}}} |
+                       align_cfg::result{with_alignment}).score(), 0);
 }
 
 TEST(alignment_configurator, configure_edit_max_error)
@@ -0,0 +1,202 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/alignment_statistics.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/alignment_sequence_pairs.hpp>
+
+using namespace seqan3;
+
+struct alignment_statistics_test : public ::testing::Test
+{
+    static constexpr uint64_t word_size = sizeof(uint_fast64_t) * CHAR_BIT;
+
+    static constexpr auto affine_cfg = align_cfg::mode{global_alignment} |
+                                       align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                                       align_cfg::scoring{nucleotide_scoring_scheme{match_score{4},
+                                                                                    mismatch_score{-5}}};
+
+    // Pairs of different lengths, such that the batches of the vectorised alignment are padded.
+    test::sequence_pair_collection<dna4> sequences = test::random_sequence_pairs<dna4>(
+        40u,
+        [] (size_t const seed) { return std::pair{20u + seed, 30u + seed % 7u}; });
+
+    uint64_t matrix_cells() const
+    {
+        uint64_t cells = 0u;
+        for (auto && [sequence1, sequence2] : sequences)
+            cells += (sequence1.size() + 1u) * (sequence2.size() + 1u);
+
+        return cells;
+    }
+
+    // Every query fits into one machine word, hence the edit distance computes one word per column.
+    uint64_t edit_distance_cells() const
+    {
+        uint64_t cells = 0u;
+        for (auto && [sequence1, sequence2] : sequences)
+            cells += sequence1.size() * word_size;
+
+        return cells;
+    }
+
+    uint64_t sequence_lengths() const
+    {
+        uint64_t lengths = 0u;
+        for (auto && [sequence1, sequence2] : sequences)
+            lengths += sequence1.size() + sequence2.size();
+
+        return lengths;
+    }
+
+    template <typename align_cfg_t>
+    void compute(align_cfg_t const & cfg)
+    {
+        for (auto && result : align_pairwise(sequences, cfg))
+            (void) result;
+    }
+};
+
+TEST_F(alignment_statistics_test, score)
+{
+    alignment_statistics statistics{};
+    compute(affine_cfg | align_cfg::result{with_score} | align_cfg::statistics{&statistics});
+
+    EXPECT_EQ(statistics.alignments(), sequences.size());
+    EXPECT_EQ(statistics.cells(), matrix_cells());
+    EXPECT_EQ(statistics.simd_lanes(), 0u);
+    EXPECT_EQ(statistics.padding_ratio(), 0.0);
+    EXPECT_EQ(statistics.traceback_length(), 0u);
+    EXPECT_GT(statistics.allocations(), 0u);
+    EXPECT_EQ(statistics.traceback_time().count(), 0);
+}
+
+TEST_F(alignment_statistics_test, alignment)
+{
+    alignment_statistics statistics{};
+    compute(affine_cfg | align_cfg::result{with_alignment} | align_cfg::statistics{&statistics});
+
+    EXPECT_EQ(statistics.alignments(), sequences.size());
+    EXPECT_EQ(statistics.cells(), matrix_cells());
+    // The global alignment covers both sequences completely.
+    EXPECT_EQ(statistics.traceback_length(), sequence_lengths());
+}
+
+TEST_F(alignment_statistics_test, vectorised)
+{
+    alignment_statistics statistics{};
+    compute(affine_cfg | align_cfg::result{with_score} | align_cfg::vectorise | align_cfg::statistics{&statistics});
+
+    EXPECT_EQ(statistics.alignments(), sequences.size());
+    EXPECT_GE(statistics.cells(), matrix_cells());
+    EXPECT_GE(statistics.simd_lanes(), sequence_lengths());
+    EXPECT_EQ(statistics.simd_lanes() - statistics.padded_simd_lanes(), sequence_lengths());
+    EXPECT_GT(statistics.padding_ratio(), 0.0);
+    EXPECT_LT(statistics.padding_ratio(), 1.0);
+}
+
+TEST_F(alignment_statistics_test, parallel)
+{
+    alignment_statistics statistics{};
+    compute(affine_cfg | align_cfg::result{with_alignment} | align_cfg::parallel{4} |
+            align_cfg::statistics{&statistics});
+
+    EXPECT_EQ(statistics.alignments(), sequences.size());
+    EXPECT_EQ(statistics.cells(), matrix_cells());
+    EXPECT_EQ(statistics.traceback_length(), sequence_lengths());
+}
+
+TEST_F(alignment_statistics_test, edit_distance)
+{
+    alignment_statistics statistics{};
+    compute(align_cfg::edit | align_cfg::result{with_alignment} | align_cfg::statistics{&statistics});
+
+    EXPECT_EQ(statistics.alignments(), sequences.size());
+    EXPECT_EQ(statistics.cells(), edit_distance_cells());
+    EXPECT_EQ(statistics.simd_lanes(), 0u);
+    EXPECT_EQ(statistics.traceback_length(), 0u);
+}
+
+TEST_F(alignment_statistics_test, edit_distance_max_error)
+{
+    alignment_statistics statistics{};
+    compute(align_cfg::edit | align_cfg::max_error{3u} | align_cfg::result{with_score} |
+            align_cfg::statistics{&statistics});
+
+    // The global edit distance stops once no cell of a column is within the maximal errors.
+    EXPECT_EQ(statistics.alignments(), sequences.size());
+    EXPECT_GT(statistics.cells(), 0u);
+    EXPECT_LT(statistics.cells(), edit_distance_cells());
+    EXPECT_EQ(statistics.cells() % word_size, 0u);
+}
+
+TEST_F(alignment_statistics_test, edit_distance_banded)
+{
+    alignment_statistics statistics{};
+    compute(align_cfg::edit | align_cfg::band{static_band{lower_bound{-3}, upper_bound{3}}} |
+            align_cfg::result{with_score} | align_cfg::statistics{&statistics});
+
+    // The band of 7 cells fits into one word; pairs whose band misses the last cell are not computed at all.
+    uint64_t cells = 0u;
+    for (auto && [sequence1, sequence2] : sequences)
+    {
+        int64_t const size_difference = static_cast<int64_t>(sequence1.size()) - sequence2.size();
+        if (size_difference >= -3 && size_difference <= 3)
+            cells += sequence1.size() * word_size;
+    }
+
+    EXPECT_EQ(statistics.alignments(), sequences.size());
+    EXPECT_EQ(statistics.cells(), cells);
+}
+
+TEST_F(alignment_statistics_test, edit_distance_vectorised)
+{
+    alignment_statistics statistics{};
+    compute(align_cfg::edit | align_cfg::result{with_back_coordinate} | align_cfg::vectorise |
+            align_cfg::statistics{&statistics});
+
+    // Every lane computes one word per symbol of the longest first sequence of its batch.
+    EXPECT_EQ(statistics.alignments(), sequences.size());
+    EXPECT_EQ(statistics.cells(), statistics.simd_lanes() * word_size);
+    EXPECT_EQ(statistics.simd_lanes() - statistics.padded_simd_lanes(),
+              edit_distance_cells() / word_size);
+}
+
+TEST_F(alignment_statistics_test, aggregate_and_reset)
+{
+    alignment_statistics statistics{};
+    auto cfg = affine_cfg | align_cfg::result{with_score} | align_cfg::statistics{&statistics};
+
+    compute(cfg);
+    compute(cfg);
+    EXPECT_EQ(statistics.alignments(), 2u * sequences.size());
+    EXPECT_EQ(statistics.cells(), 2u * matrix_cells());
+
+    statistics.reset();
+    EXPECT_EQ(statistics.alignments(), 0u);
+    EXPECT_EQ(statistics.cells(), 0u);
+    EXPECT_EQ(statistics.allocations(), 0u);
+    EXPECT_EQ(statistics.fill_time().count(), 0);
+    EXPECT_EQ(statistics.result_time().count(), 0);
+}
+
+TEST_F(alignment_statistics_test, null_pointer)
+{
+    auto cfg = affine_cfg | align_cfg::result{with_score} | align_cfg::statistics{nullptr};
+    EXPECT_THROW(compute(cfg), invalid_alignment_configuration);
+    EXPECT_THROW(compute(align_cfg::edit | align_cfg::statistics{nullptr}), invalid_alignment_configuration);
+}
@@ -0,0 +1,232 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_max_error.hpp>
+#include <seqan3/alignment/configuration/align_config_result.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using namespace seqan3;
+using namespace seqan3::detail;
+
+template <typename word_t>
+struct edit_distance_banded_test : public ::testing::Test
+{
+    template <typename is_semi_global_t, typename database_t, typename query_t, typename align_cfg_t>
+    auto edit_distance(database_t && database, query_t && query, align_cfg_t && align_cfg)
+    {
+        using edit_traits = default_edit_distance_trait_type<database_t,
+                                                             query_t,
+                                                             align_cfg_t,
+                                                             is_semi_global_t,
+                                                             word_t>;
+        using algorithm_t = edit_distance_banded<database_t, query_t, align_cfg_t, edit_traits>;
+        auto alignment = algorithm_t{database, query, align_cfg};
+
+        // compute alignment
+        alignment(0u);
+        return alignment;
+    }
+
+    template <typename alignment_t>
+    static std::pair<std::string, std::string> to_string(alignment_t && alignment)
+    {
+        auto && [gapped_database, gapped_query] = alignment;
+        return {gapped_database | views::to_char | views::to<std::string>,
+                gapped_query | views::to_char | views::to<std::string>};
+    }
+};
+
+using word_types = ::testing::Types<uint8_t, uint16_t, uint32_t, uint64_t>;
+
+TYPED_TEST_SUITE(edit_distance_banded_test, word_types, );
+
+TYPED_TEST(edit_distance_banded_test, global_identical_sequences)
+{
+    std::vector database = "ACGTACGT"_dna4;
+    std::vector query = "ACGTACGT"_dna4;
+    configuration align_cfg = align_cfg::edit |
+                              align_cfg::band{static_band{lower_bound{0}, upper_bound{0}}} |
+                              align_cfg::result{with_alignment};
+
+    auto alignment = this->template edit_distance<std::false_type>(database, query, align_cfg);
+
+    EXPECT_EQ(alignment.score(), 0);
+    EXPECT_EQ(alignment.back_coordinate(), (alignment_coordinate{column_index_type{8u}, row_index_type{8u}}));
+    EXPECT_EQ(alignment.front_coordinate(), (alignment_coordinate{column_index_type{0u}, row_index_type{0u}}));
+    EXPECT_EQ(this->to_string(alignment.alignment()), (std::pair<std::string, std::string>{"ACGTACGT", "ACGTACGT"}));
+}
+
+TYPED_TEST(edit_distance_banded_test, global)
+{
+    std::vector database = "AACCGGTTAACCGGTT"_dna4;
+    std::vector query = "ACGTACGTA"_dna4;
+    configuration align_cfg = align_cfg::edit |
+                              align_cfg::band{static_band{lower_bound{0}, upper_bound{7}}} |
+                              align_cfg::result{with_alignment};
+
+    auto alignment = this->template edit_distance<std::false_type>(database, query, align_cfg);
+
+    EXPECT_EQ(alignment.score(), -8);
+    EXPECT_EQ(alignment.back_coordinate(), (alignment_coordinate{column_index_type{16u}, row_index_type{9u}}));
+    EXPECT_EQ(alignment.front_coordinate(), (alignment_coordinate{column_index_type{0u}, row_index_type{0u}}));
+    EXPECT_EQ(this->to_string(alignment.alignment()),
+              (std::pair<std::string, std::string>{"AACCGGTTAACCGGTT", "A-C-G-T-A-C-G-TA"}));
+}
+
+TYPED_TEST(edit_distance_banded_test, global_band_excludes_sink)
+{
+    std::vector database = "AAAACCCC"_dna4;
+    std::vector query = "CCCC"_dna4;
+
+    { // The sink is on diagonal 4.
+        configuration align_cfg = align_cfg::edit |
+                                  align_cfg::band{static_band{lower_bound{0}, upper_bound{4}}} |
+                                  align_cfg::result{with_alignment};
+
+        auto alignment = this->template edit_distance<std::false_type>(database, query, align_cfg);
+
+        EXPECT_EQ(alignment.score(), -4);
+        EXPECT_EQ(this->to_string(alignment.alignment()),
+                  (std::pair<std::string, std::string>{"AAAACCCC", "----CCCC"}));
+    }
+
+    {
+        configuration align_cfg = align_cfg::edit |
+                                  align_cfg::band{static_band{lower_bound{0}, upper_bound{2}}} |
+                                  align_cfg::result{with_alignment};
+
+        auto alignment = this->template edit_distance<std::false_type>(database, query, align_cfg);
+
+        EXPECT_EQ(alignment.score(), std::nullopt);
+        EXPECT_EQ(alignment.back_coordinate(), (alignment_coordinate{column_index_type{8u}, row_index_type{4u}}));
+    }
+}
+
+TYPED_TEST(edit_distance_banded_test, global_band_excludes_origin)
+{
+    std::vector database = "AACCGGTTAACCGGTT"_dna4;
+    std::vector query = "ACGTACGTA"_dna4;
+    configuration align_cfg = align_cfg::edit |
+                              align_cfg::band{static_band{lower_bound{1}, upper_bound{7}}} |
+                              align_cfg::result{with_score};
+
+    auto alignment = this->template edit_distance<std::false_type>(database, query, align_cfg);
+
+    EXPECT_EQ(alignment.score(), std::nullopt);
+}
+
+TYPED_TEST(edit_distance_banded_test, semi_global)
+{
+    std::vector database = "TTTTACGTTTTT"_dna4;
+    std::vector query = "ACGT"_dna4;
+
+    { // The band contains the occurrence.
+        configuration align_cfg = align_cfg::edit |
+                                  align_cfg::band{static_band{lower_bound{4}, upper_bound{4}}} |
+                                  align_cfg::result{with_alignment};
+
+        auto alignment = this->template edit_distance<std::true_type>(database, query, align_cfg);
+
+        EXPECT_EQ(alignment.score(), 0);
+        EXPECT_EQ(alignment.back_coordinate(), (alignment_coordinate{column_index_type{8u}, row_index_type{4u}}));
+        EXPECT_EQ(alignment.front_coordinate(), (alignment_coordinate{column_index_type{4u}, row_index_type{0u}}));
+        EXPECT_EQ(this->to_string(alignment.alignment()), (std::pair<std::string, std::string>{"ACGT", "ACGT"}));
+    }
+
+    { // The band does not contain the occurrence.
+        configuration align_cfg = align_cfg::edit |
+                                  align_cfg::band{static_band{lower_bound{0}, upper_bound{2}}} |
+                                  align_cfg::result{with_alignment};
+
+        auto alignment = this->template edit_distance<std::true_type>(database, query, align_cfg);
+
+        EXPECT_EQ(alignment.score(), -3);
+        EXPECT_EQ(alignment.back_coordinate(), (alignment_coordinate{column_index_type{4u}, row_index_type{4u}}));
+        EXPECT_EQ(alignment.front_coordinate(), (alignment_coordinate{column_index_type{2u}, row_index_type{0u}}));
+        EXPECT_EQ(this->to_string(alignment.alignment()), (std::pair<std::string, std::string>{"T--T", "ACGT"}));
+    }
+}
+
+TYPED_TEST(edit_distance_banded_test, semi_global_max_errors)
+{
+    std::vector database = "TTTTACGTTTTT"_dna4;
+    std::vector query = "ACGT"_dna4;
+
+    configuration align_cfg = align_cfg::edit |
+                              align_cfg::band{static_band{lower_bound{0}, upper_bound{2}}} |
+                              align_cfg::result{with_back_coordinate};
+
+    auto hit = this->template edit_distance<std::true_type>(database, query, align_cfg | align_cfg::max_error{3u});
+    EXPECT_EQ(hit.score(), -3);
+
+    auto no_hit = this->template edit_distance<std::true_type>(database, query, align_cfg | align_cfg::max_error{2u});
+    EXPECT_EQ(no_hit.score(), std::nullopt);
+    EXPECT_EQ(no_hit.back_coordinate(), (alignment_coordinate{column_index_type{12u}, row_index_type{4u}}));
+}
+
+TYPED_TEST(edit_distance_banded_test, same_as_unbanded_within_band)
+{
+    // The band is wider than a single machine word and contains the optimal alignment.
+    std::vector database = "AACCGGTTAACCGGTTAACCGGTTAACCGGTTAACCGGTTAACCGGTTAACCGGTTAACCGGTTAACCGGTTAACCGGTT"_dna4;
+    std::vector query = "ACGTACGTAACGTACGTAACGTACGTAACGTACGTAACGTACGTA"_dna4;
+
+    for (bool is_semi_global : {false, true})
+    {
+        configuration align_cfg = align_cfg::edit |
+                                  align_cfg::band{static_band{lower_bound{-30}, upper_bound{70}}} |
+                                  align_cfg::result{with_back_coordinate};
+
+        auto compute = [&] (auto is_semi_global_v)
+        {
+            using is_semi_global_t = decltype(is_semi_global_v);
+            using edit_traits = default_edit_distance_trait_type<std::vector<dna4> &,
+                                                                 std::vector<dna4> &,
+                                                                 decltype(align_cfg),
+                                                                 is_semi_global_t,
+                                                                 TypeParam>;
+            edit_distance_unbanded unbanded{database, query, align_cfg, edit_traits{}};
+            unbanded(0u);
+            auto banded = this->template edit_distance<is_semi_global_t>(database, query, align_cfg);
+
+            EXPECT_EQ(banded.score(), unbanded.score());
+            EXPECT_EQ(banded.back_coordinate(), unbanded.back_coordinate());
+        };
+
+        if (is_semi_global)
+            compute(std::true_type{});
+        else
+            compute(std::false_type{});
+    }
+}
+
+TYPED_TEST(edit_distance_banded_test, invalid_band)
+{
+    std::vector database = "ACGT"_dna4;
+    std::vector query = "ACGTACGT"_dna4;
+
+    auto lower_cfg = align_cfg::edit | align_cfg::band{static_band{lower_bound{5}, upper_bound{6}}} |
+                     align_cfg::result{with_score};
+    auto upper_cfg = align_cfg::edit | align_cfg::band{static_band{lower_bound{-10}, upper_bound{-9}}} |
+                     align_cfg::result{with_score};
+
+    EXPECT_THROW((this->template edit_distance<std::false_type>(database, query, lower_cfg)),
+                 invalid_alignment_configuration);
+    EXPECT_THROW((this->template edit_distance<std::false_type>(database, query, upper_cfg)),
+                 invalid_alignment_configuration);
+}
@@ -0,0 +1,139 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/detail/edit_distance_query_cache.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using namespace seqan3;
+
+TEST(edit_distance_query_cache, encode)
+{
+    using cache_t = detail::edit_distance_query_cache<uint8_t>;
+
+    EXPECT_EQ(cache_t::encode("ACGTA"_dna4), (std::vector<uint8_t>{0b10001, 0b00010, 0b00100, 0b01000, 0u}));
+    EXPECT_EQ(cache_t::encode(""_dna4), std::vector<uint8_t>{});
+
+    // Three blocks of one byte each: A at 0 and 16, C at 8 and T at 17.
+    std::vector<dna4> query{"AGGGGGGGCGGGGGGGAT"_dna4};
+    EXPECT_EQ(cache_t::encode(query), (std::vector<uint8_t>{0b00000001, 0b00000000, 0b00000001,     // A
+                                                            0b00000000, 0b00000001, 0b00000000,     // C
+                                                            0b11111110, 0b11111110, 0b00000000,     // G
+                                                            0b00000000, 0b00000000, 0b00000010,     // T
+                                                            0u, 0u, 0u}));
+}
+
+TEST(edit_distance_query_cache, bit_masks)
+{
+    detail::edit_distance_query_cache<uint64_t> cache{};
+    std::vector<dna4> query1{"ACGTACGT"_dna4};
+    std::vector<dna4> query1_copy{query1};
+    std::vector<dna4> query2{"ACGTACGA"_dna4};
+
+    auto masks1 = cache.bit_masks(query1);
+    EXPECT_EQ(*masks1, detail::edit_distance_query_cache<uint64_t>::encode(query1));
+
+    // The same query, even if stored in a different object, shares the bit masks.
+    EXPECT_EQ(cache.bit_masks(query1_copy), masks1);
+    EXPECT_EQ(cache.bit_masks(query1), masks1);
+
+    auto masks2 = cache.bit_masks(query2);
+    EXPECT_NE(masks2, masks1);
+    EXPECT_EQ(*masks2, detail::edit_distance_query_cache<uint64_t>::encode(query2));
+
+    // The previous bit masks stay valid for their owners.
+    EXPECT_EQ(*masks1, detail::edit_distance_query_cache<uint64_t>::encode(query1));
+
+    auto copied_cache = cache;
+    EXPECT_EQ(copied_cache.bit_masks(query2), masks2);
+}
+
+TEST(edit_distance_query_cache, same_memory)
+{
+    detail::edit_distance_query_cache<uint64_t> cache{};
+    std::vector<dna4> query{"ACGTACGT"_dna4};
+
+    auto masks = cache.bit_masks(query);
+
+    // The last query is alive and the query occupies its memory, so it is not compared.
+    EXPECT_EQ(cache.bit_masks(query, true), masks);
+
+    // Without the guarantee a modified query in the same memory is encoded again.
+    query[0] = 'T'_dna4;
+    auto modified_masks = cache.bit_masks(query);
+    EXPECT_NE(modified_masks, masks);
+    EXPECT_EQ(*modified_masks, detail::edit_distance_query_cache<uint64_t>::encode(query));
+
+    // A query in other memory is compared even if the last query is alive.
+    std::vector<dna4> other_query{"ACGTACGA"_dna4};
+    EXPECT_EQ(*cache.bit_masks(other_query, true), detail::edit_distance_query_cache<uint64_t>::encode(other_query));
+}
+
+TEST(edit_distance_query_cache, reuse_released_bit_masks)
+{
+    detail::edit_distance_query_cache<uint64_t> cache{};
+    std::vector<dna4> query1 = test::generate_sequence<dna4>(150u, 0u, 0u);
+    std::vector<dna4> query2 = test::generate_sequence<dna4>(150u, 0u, 1u);
+    std::vector<dna4> query3 = test::generate_sequence<dna4>(100u, 0u, 2u);
+
+    auto masks = cache.bit_masks(query1);
+    uint64_t const * data = masks->data();
+    masks.reset();
+
+    // Bit masks that no one else holds are overwritten in place.
+    masks = cache.bit_masks(query2);
+    EXPECT_EQ(masks->data(), data);
+    EXPECT_EQ(*masks, detail::edit_distance_query_cache<uint64_t>::encode(query2));
+    masks.reset();
+
+    masks = cache.bit_masks(query3);
+    EXPECT_EQ(masks->data(), data);
+    EXPECT_EQ(*masks, detail::edit_distance_query_cache<uint64_t>::encode(query3));
+
+    // Bit masks that are still held are not modified.
+    auto masks1 = cache.bit_masks(query1);
+    EXPECT_NE(masks1, masks);
+    EXPECT_EQ(*masks, detail::edit_distance_query_cache<uint64_t>::encode(query3));
+    EXPECT_EQ(*masks1, detail::edit_distance_query_cache<uint64_t>::encode(query1));
+}
+
+TEST(edit_distance_query_cache, one_query_many_targets)
+{
+    std::vector<dna4> query = test::generate_sequence<dna4>(150u, 0u, 0u);
+    std::vector<std::vector<dna4>> targets{};
+    for (size_t seed = 1u; seed < 50u; ++seed)
+        targets.push_back(test::generate_sequence<dna4>(200u, 0u, seed));
+
+    std::vector<std::tuple<std::vector<dna4> &, std::vector<dna4> &>> sequences{};
+    for (auto & target : targets)
+        sequences.emplace_back(target, query);
+
+    // Changing the query in between must invalidate the cached bit masks.
+    std::vector<dna4> other_query = test::generate_sequence<dna4>(150u, 0u, 100u);
+    sequences.emplace(sequences.begin() + 20, targets[0], other_query);
+
+    auto cfg = align_cfg::edit | align_cfg::aligned_ends{free_ends_first} | align_cfg::result{with_back_coordinate};
+    auto results = align_pairwise(sequences, cfg) | views::to<std::vector>;
+    ASSERT_EQ(results.size(), sequences.size());
+
+    for (size_t idx = 0u; idx < sequences.size(); ++idx)
+    {
+        auto expected = *align_pairwise(sequences[idx], cfg).begin();
+        EXPECT_EQ(results[idx].score(), expected.score()) << idx;
+        EXPECT_EQ(results[idx].back_coordinate().first, expected.back_coordinate().first) << idx;
+        EXPECT_EQ(results[idx].back_coordinate().second, expected.back_coordinate().second) << idx;
+    }
+}
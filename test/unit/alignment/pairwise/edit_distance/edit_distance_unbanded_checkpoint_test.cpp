@@ -0,0 +1,119 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_result.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using namespace seqan3;
+using namespace seqan3::detail;
+
+// Always recompute the traces from checkpoints.
+template <typename ...args_t>
+struct checkpointed_edit_distance_trait_type : public default_edit_distance_trait_type<args_t...>
+{
+    static constexpr size_t checkpoint_min_trace_size = 0u;
+};
+
+template <typename is_semi_global_t>
+struct edit_distance_unbanded_checkpoint_test : public ::testing::Test
+{
+    using sequence_t = std::vector<dna4>;
+
+    template <typename align_cfg_t>
+    void check(sequence_t & database, sequence_t & query, align_cfg_t const & align_cfg)
+    {
+        using edit_traits = default_edit_distance_trait_type<sequence_t &, sequence_t &, align_cfg_t, is_semi_global_t>;
+        using checkpointed_edit_traits = checkpointed_edit_distance_trait_type<sequence_t &,
+                                                                               sequence_t &,
+                                                                               align_cfg_t,
+                                                                               is_semi_global_t>;
+
+        edit_distance_unbanded full{database, query, align_cfg, edit_traits{}};
+        edit_distance_unbanded checkpointed{database, query, align_cfg, checkpointed_edit_traits{}};
+        auto expected = full(0u);
+        auto result = checkpointed(0u);
+
+        // The full trace matrix is not stored if the traces are recomputed from checkpoints. An empty query has no
+        // blocks, hence its trace matrix is always stored.
+        EXPECT_EQ(full.trace_matrix().cols(), database.size() + 1u);
+        if (query.empty())
+        {
+            EXPECT_EQ(checkpointed.trace_matrix().cols(), database.size() + 1u);
+        }
+        else
+        {
+            EXPECT_THROW(checkpointed.trace_matrix(), std::logic_error);
+        }
+        EXPECT_EQ(result.score(), expected.score());
+        EXPECT_EQ(result.back_coordinate(), expected.back_coordinate());
+        EXPECT_EQ(result.front_coordinate(), expected.front_coordinate());
+        EXPECT_EQ(checkpointed.front_coordinate(), full.front_coordinate());
+        EXPECT_TRUE(checkpointed.alignment() == full.alignment());
+
+        auto && [gapped_database, gapped_query] = result.alignment();
+        auto && [expected_database, expected_query] = expected.alignment();
+        EXPECT_EQ(gapped_database | views::to_char | views::to<std::string>,
+                  expected_database | views::to_char | views::to<std::string>);
+        EXPECT_EQ(gapped_query | views::to_char | views::to<std::string>,
+                  expected_query | views::to_char | views::to<std::string>);
+    }
+
+    void check_random(size_t const database_size, size_t const query_size)
+    {
+        configuration align_cfg = align_cfg::edit | align_cfg::result{with_alignment};
+
+        for (size_t seed = 0u; seed < 10u; ++seed)
+        {
+            sequence_t database = test::generate_sequence<dna4>(database_size, 0u, seed);
+            sequence_t query = test::generate_sequence<dna4>(query_size, 0u, seed + 100u);
+            check(database, query, align_cfg);
+        }
+    }
+};
+
+using semi_global_types = ::testing::Types<std::false_type, std::true_type>;
+TYPED_TEST_SUITE(edit_distance_unbanded_checkpoint_test, semi_global_types, );
+
+TYPED_TEST(edit_distance_unbanded_checkpoint_test, small_pattern)
+{
+    this->check_random(100u, 40u);
+}
+
+TYPED_TEST(edit_distance_unbanded_checkpoint_test, large_pattern)
+{
+    this->check_random(500u, 150u);
+}
+
+TYPED_TEST(edit_distance_unbanded_checkpoint_test, single_column_segment)
+{
+    // 50 columns with a checkpoint every 8 columns, i.e. the last segment consists of a single column.
+    this->check_random(49u, 70u);
+}
+
+TYPED_TEST(edit_distance_unbanded_checkpoint_test, empty_sequences)
+{
+    configuration align_cfg = align_cfg::edit | align_cfg::result{with_alignment};
+    std::vector<dna4> database = "ACGTACGT"_dna4;
+    std::vector<dna4> query = "ACGT"_dna4;
+    std::vector<dna4> empty{};
+
+    this->check(database, empty, align_cfg);
+    this->check(empty, query, align_cfg);
+    this->check(empty, empty, align_cfg);
+}
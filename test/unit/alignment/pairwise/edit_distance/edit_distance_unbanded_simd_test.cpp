@@ -0,0 +1,162 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_aligned_ends.hpp>
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_max_error.hpp>
+#include <seqan3/alignment/configuration/align_config_result.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorise.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded_simd.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/std/ranges>
+#include <seqan3/test/pretty_printing.hpp>
+
+using namespace seqan3;
+using namespace seqan3::detail;
+
+template <typename is_semi_global_t>
+struct edit_distance_unbanded_simd_test : public ::testing::Test
+{
+    using sequence_t = std::vector<dna4>;
+
+    // Pairs of various lengths, including an empty database and a query that fills a whole word.
+    std::vector<std::pair<sequence_t, sequence_t>> sequences
+    {
+        {"AACCGGTTAACCGGTT"_dna4, "ACGTACGTA"_dna4},
+        {"ACGTACGT"_dna4, "ACGTACGT"_dna4},
+        {""_dna4, "ACG"_dna4},
+        {"TTTTACGTTTTT"_dna4, "ACGT"_dna4},
+        {"A"_dna4, "C"_dna4},
+        {"GATTACAGATTACAGATTACAGATTACAGATTACAGATTACAGATTACAGATTACAGATTACAGATTACA"_dna4,
+         "GATTACAGATTACAGATTACAGATTACAGATTACAGATTACAGATTACAGATTACAGATTACAG"_dna4},
+        {"ACGT"_dna4, "ACGTACGTACGTACGT"_dna4},
+        {"CCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCC"_dna4, "GGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGG"_dna4},
+        {"TGCATGCATGCA"_dna4, "GCAT"_dna4}
+    };
+
+    template <typename align_cfg_t>
+    void check(align_cfg_t const & align_cfg)
+    {
+        using edit_traits = default_edit_distance_trait_type<sequence_t &, sequence_t &, align_cfg_t, is_semi_global_t>;
+        using simd_algorithm_t = edit_distance_unbanded_simd<sequence_t &, sequence_t &, align_cfg_t, edit_traits>;
+
+        // Compute the sequences in batches of the simd length (the last batch might be smaller).
+        for (size_t begin = 0u; begin < sequences.size(); begin += simd_algorithm_t::lanes)
+        {
+            std::vector<std::tuple<sequence_t &, sequence_t &, size_t>> batch{};
+            for (size_t idx = begin; idx < std::min(begin + simd_algorithm_t::lanes, sequences.size()); ++idx)
+            {
+                if (simd_algorithm_t::fits_into_lane(sequences[idx].second))
+                    batch.emplace_back(sequences[idx].first, sequences[idx].second, idx);
+            }
+
+            auto results = simd_algorithm_t{align_cfg}(batch);
+            ASSERT_EQ(results.size(), batch.size());
+
+            for (size_t lane = 0u; lane < batch.size(); ++lane)
+            {
+                auto & [database, query, idx] = batch[lane];
+                edit_distance_unbanded unbanded{database, query, align_cfg, edit_traits{}};
+                auto expected = unbanded(idx);
+
+                EXPECT_EQ(results[lane].id(), expected.id());
+                EXPECT_EQ(results[lane].score(), expected.score());
+                EXPECT_EQ(results[lane].back_coordinate(), expected.back_coordinate());
+            }
+        }
+    }
+};
+
+using semi_global_types = ::testing::Types<std::false_type, std::true_type>;
+
+TYPED_TEST_SUITE(edit_distance_unbanded_simd_test, semi_global_types, );
+
+TYPED_TEST(edit_distance_unbanded_simd_test, same_as_unbanded)
+{
+    this->check(align_cfg::edit | align_cfg::result{with_back_coordinate});
+}
+
+TYPED_TEST(edit_distance_unbanded_simd_test, same_as_unbanded_max_errors)
+{
+    this->check(align_cfg::edit | align_cfg::max_error{3u} | align_cfg::result{with_back_coordinate});
+}
+
+TYPED_TEST(edit_distance_unbanded_simd_test, fits_into_lane)
+{
+    using align_cfg_t = decltype(align_cfg::edit | align_cfg::result{with_score});
+    using sequence_t = typename TestFixture::sequence_t;
+    using edit_traits = default_edit_distance_trait_type<sequence_t &, sequence_t &, align_cfg_t, TypeParam>;
+    using simd_algorithm_t = edit_distance_unbanded_simd<sequence_t &, sequence_t &, align_cfg_t, edit_traits>;
+
+    EXPECT_FALSE(simd_algorithm_t::fits_into_lane(sequence_t{}));
+    EXPECT_TRUE(simd_algorithm_t::fits_into_lane(sequence_t(1u)));
+    EXPECT_TRUE(simd_algorithm_t::fits_into_lane(sequence_t(edit_traits::word_size)));
+    EXPECT_FALSE(simd_algorithm_t::fits_into_lane(sequence_t(edit_traits::word_size + 1u)));
+}
+
+TYPED_TEST(edit_distance_unbanded_simd_test, align_pairwise)
+{
+    // The query of the third pair does not fit into a machine word and is computed by the scalar algorithm.
+    auto sequences = this->sequences;
+    sequences[2].second = sequences[5].first;
+
+    auto cfg = [] ()
+    {
+        if constexpr (TypeParam::value)
+            return align_cfg::edit | align_cfg::aligned_ends{free_ends_first} | align_cfg::result{with_back_coordinate};
+        else
+            return align_cfg::edit | align_cfg::result{with_back_coordinate};
+    }();
+
+    auto expected = align_pairwise(sequences, cfg) | views::to<std::vector>;
+    auto results = align_pairwise(sequences, cfg | align_cfg::vectorise) | views::to<std::vector>;
+
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t idx = 0u; idx < results.size(); ++idx)
+    {
+        EXPECT_EQ(results[idx].id(), idx);
+        EXPECT_EQ(results[idx].score(), expected[idx].score());
+        EXPECT_EQ(results[idx].back_coordinate(), expected[idx].back_coordinate());
+    }
+}
+
+TYPED_TEST(edit_distance_unbanded_simd_test, sequence_pairs_by_value)
+{
+    // The transform returns every pair as a temporary that holds the sequences by value.
+    auto sequences = this->sequences | std::views::transform([] (auto & sequence_pair)
+    {
+        return std::tuple{sequence_pair.first | std::views::take(sequence_pair.first.size()),
+                          sequence_pair.second | std::views::take(sequence_pair.second.size())};
+    });
+
+    auto cfg = [] ()
+    {
+        if constexpr (TypeParam::value)
+            return align_cfg::edit | align_cfg::aligned_ends{free_ends_first} | align_cfg::result{with_back_coordinate};
+        else
+            return align_cfg::edit | align_cfg::result{with_back_coordinate};
+    }();
+
+    auto expected = align_pairwise(this->sequences, cfg) | views::to<std::vector>;
+    auto results = align_pairwise(sequences, cfg | align_cfg::vectorise) | views::to<std::vector>;
+
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t idx = 0u; idx < results.size(); ++idx)
+    {
+        EXPECT_EQ(results[idx].id(), idx);
+        EXPECT_EQ(results[idx].score(), expected[idx].score());
+        EXPECT_EQ(results[idx].back_coordinate(), expected[idx].back_coordinate());
+    }
+}
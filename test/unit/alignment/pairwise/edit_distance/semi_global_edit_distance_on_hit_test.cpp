@@ -0,0 +1,162 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using namespace seqan3;
+
+struct semi_global_edit_distance_on_hit_test : public ::testing::Test
+{
+    static constexpr auto base_cfg = align_cfg::edit | align_cfg::aligned_ends{free_ends_first};
+
+    // Computes the end positions in the database with at most max_errors errors by the quadratic dynamic programming.
+    static std::vector<std::pair<size_t, int32_t>> expected_hits(std::vector<dna4> const & database,
+                                                                 std::vector<dna4> const & query,
+                                                                 int32_t const max_errors)
+    {
+        std::vector<int32_t> column(query.size() + 1u);
+        for (size_t row = 0u; row < column.size(); ++row)
+            column[row] = row;
+
+        std::vector<std::pair<size_t, int32_t>> hits{};
+        for (size_t col = 1u; col <= database.size(); ++col)
+        {
+            int32_t diagonal = column[0];
+            for (size_t row = 1u; row < column.size(); ++row)
+            {
+                int32_t const cell = std::min({diagonal + (database[col - 1] != query[row - 1]),
+                                               column[row] + 1,
+                                               column[row - 1] + 1});
+                diagonal = column[row];
+                column[row] = cell;
+            }
+
+            if (column.back() <= max_errors)
+                hits.emplace_back(col, -column.back());
+        }
+
+        return hits;
+    }
+};
+
+TEST_F(semi_global_edit_distance_on_hit_test, reports_all_hits)
+{
+    for (size_t seed = 0u; seed < 20u; ++seed)
+    {
+        // Query lengths below and above one machine word.
+        size_t const query_length = (seed % 2u == 0u) ? 12u : 100u;
+        std::vector<dna4> database = test::generate_sequence<dna4>(2000u, 0u, seed);
+        std::vector<dna4> query = test::generate_sequence<dna4>(query_length, 0u, seed + 100u);
+
+        // Plant mutated copies of the query into the database.
+        for (size_t position = 100u; position + query_length < database.size(); position += 400u)
+        {
+            size_t const mutation = seed % query_length;
+            std::copy(query.begin(), query.end(), database.begin() + position);
+            database[position + mutation] = dna4{}.assign_rank((query[mutation].to_rank() + 1) % 4);
+        }
+
+        uint32_t const max_errors = (query_length == 12u) ? 2u : 15u;
+        std::vector<std::pair<size_t, int32_t>> hits{};
+        auto cfg = base_cfg | align_cfg::max_error{max_errors} |
+                   align_cfg::on_hit{[&] (size_t const id, alignment_coordinate const coordinate, int32_t const score)
+                   {
+                       EXPECT_EQ(id, 0u);
+                       EXPECT_EQ(coordinate.second, query.size());
+                       hits.emplace_back(coordinate.first, score);
+                   }} |
+                   align_cfg::result{with_back_coordinate};
+
+        auto result = *align_pairwise(std::tie(database, query), cfg).begin();
+        auto expected = expected_hits(database, query, max_errors);
+
+        EXPECT_EQ(hits, expected) << "seed: " << seed;
+        ASSERT_FALSE(expected.empty());
+
+        // The best hit is still reported in the alignment result.
+        auto best = std::min_element(expected.rbegin(), expected.rend(), [] (auto const & lhs, auto const & rhs)
+        {
+            return lhs.second > rhs.second;
+        });
+        EXPECT_EQ(result.score(), best->second);
+        EXPECT_EQ(result.back_coordinate().first, best->first);
+    }
+}
+
+TEST_F(semi_global_edit_distance_on_hit_test, abort)
+{
+    std::vector<dna4> database{"TTACGTTTTACGTTTTACGT"_dna4};
+    std::vector<dna4> query{"ACGT"_dna4};
+
+    std::vector<size_t> hits{};
+    auto cfg = base_cfg | align_cfg::max_error{0u} |
+               align_cfg::on_hit{[&hits] (size_t, alignment_coordinate const coordinate, int32_t)
+               {
+                   hits.push_back(coordinate.first);
+                   return hits.size() == 2u; // Stop after the second occurrence.
+               }} |
+               align_cfg::result{with_back_coordinate};
+
+    auto result = *align_pairwise(std::tie(database, query), cfg).begin();
+
+    EXPECT_EQ(hits, (std::vector<size_t>{6u, 13u}));
+    EXPECT_EQ(result.score(), 0);
+    EXPECT_EQ(result.back_coordinate().first, 13u);
+}
+
+TEST_F(semi_global_edit_distance_on_hit_test, sequence_pair_ids)
+{
+    std::vector<std::pair<std::vector<dna4>, std::vector<dna4>>> sequences
+    {
+        {"ACGTTTACGT"_dna4, "ACGT"_dna4},
+        {"TTTTTTTTTT"_dna4, "ACGT"_dna4},
+        {"GGACGAGG"_dna4, "ACGT"_dna4},
+        {""_dna4, "ACGT"_dna4}
+    };
+
+    std::vector<std::pair<size_t, size_t>> hits{};
+    auto cfg = base_cfg | align_cfg::max_error{1u} |
+               align_cfg::on_hit{[&hits] (size_t const id, alignment_coordinate const coordinate, int32_t)
+               {
+                   hits.emplace_back(id, coordinate.first);
+               }};
+
+    for (auto && result : align_pairwise(sequences, cfg))
+        EXPECT_LE(result.score(), 0);
+
+    EXPECT_EQ(hits, (std::vector<std::pair<size_t, size_t>>{{0u, 3u}, {0u, 4u}, {0u, 5u},
+                                                            {0u, 9u}, {0u, 10u},
+                                                            {2u, 5u}, {2u, 6u}}));
+}
+
+TEST_F(semi_global_edit_distance_on_hit_test, invalid_configuration)
+{
+    std::vector<dna4> sequence{"ACGT"_dna4};
+    auto callback = [] (size_t, alignment_coordinate, int32_t) {};
+
+    auto without_max_error = base_cfg | align_cfg::on_hit{callback};
+    EXPECT_THROW(align_pairwise(std::tie(sequence, sequence), without_max_error), invalid_alignment_configuration);
+
+    auto global = align_cfg::edit | align_cfg::max_error{1u} | align_cfg::on_hit{callback};
+    EXPECT_THROW(align_pairwise(std::tie(sequence, sequence), global), invalid_alignment_configuration);
+
+    auto not_edit = align_cfg::mode{global_alignment} | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                    align_cfg::scoring{nucleotide_scoring_scheme{}} | align_cfg::on_hit{callback};
+    EXPECT_THROW(align_pairwise(std::tie(sequence, sequence), not_edit), invalid_alignment_configuration);
+}
@@ -7,10 +7,15 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <forward_list>
 #include <string>
+#include <thread>
 
 #include <seqan3/alignment/pairwise/execution/alignment_executor_two_way.hpp>
 #include <seqan3/range/views/persist.hpp>
+#include <seqan3/range/views/single_pass_input.hpp>
 #include <seqan3/range/views/type_reduce.hpp>
 #include <seqan3/range/views/zip.hpp>
 #include <seqan3/std/algorithm>
@@ -42,6 +47,23 @@ struct dummy_alignment
     }
 };
 
+// Counts the started and finished invocations to check that no alignment runs after the executor was destroyed.
+struct counting_alignment
+{
+    static inline std::atomic<size_t> started{0u};
+    static inline std::atomic<size_t> finished{0u};
+
+    template <typename indexed_sequence_pairs_t>
+    auto operator()(indexed_sequence_pairs_t && indexed_sequence_pairs) const
+    {
+        ++started;
+        auto result = dummy_alignment{}(std::forward<indexed_sequence_pairs_t>(indexed_sequence_pairs));
+        std::this_thread::sleep_for(std::chrono::microseconds{10});
+        ++finished;
+        return result;
+    }
+};
+
 template <typename resource_t>
 struct algorithm_type_for_input
 {
@@ -237,3 +259,80 @@ TYPED_TEST(alignment_executor_two_way_test, rvalue_sequence_pairs_view)
     EXPECT_EQ(exec.bump().value(), 7u);
     EXPECT_FALSE(static_cast<bool>(exec.bump()));
 }
+
+TYPED_TEST(alignment_executor_two_way_test, unsized_sequence_pairs_over_multiple_windows)
+{
+    using sequence_pairs_t = std::forward_list<typename TestFixture::sequence_pair_t>;
+    using algorithm_t = typename algorithm_type_for_input<sequence_pairs_t &>::type;
+    using alignment_executor_t = seqan3::detail::alignment_executor_two_way<sequence_pairs_t &,
+                                                                            algorithm_t,
+                                                                            TypeParam>;
+
+    size_t const pair_count = 3 * alignment_executor_t::default_window_size + 7;
+    sequence_pairs_t sequence_pairs{};
+    for (size_t i = pair_count; i > 0; --i)
+        sequence_pairs.emplace_front(std::string(i % 50, 'A'), std::string(i % 50, 'A'));
+
+    alignment_executor_t exec{sequence_pairs, algorithm_t{dummy_alignment{}}, 3u};
+
+    for (size_t i = 1; i <= pair_count / 2; ++i)
+        EXPECT_EQ(exec.bump().value(), i % 50);
+
+    // Move while the next window might still be computed.
+    alignment_executor_t exec_moved{std::move(exec)};
+    for (size_t i = pair_count / 2 + 1; i <= pair_count; ++i)
+        EXPECT_EQ(exec_moved.bump().value(), i % 50);
+
+    EXPECT_FALSE(static_cast<bool>(exec_moved.bump()));
+}
+
+TYPED_TEST(alignment_executor_two_way_test, destroy_before_consumed)
+{
+    using sequence_pairs_t = typename TestFixture::sequence_pairs_t;
+    using algorithm_t = typename algorithm_type_for_input<sequence_pairs_t &>::type;
+    using alignment_executor_t = seqan3::detail::alignment_executor_two_way<sequence_pairs_t &,
+                                                                            algorithm_t,
+                                                                            TypeParam>;
+
+    sequence_pairs_t sequence_pairs(3 * alignment_executor_t::default_window_size, this->sequence_pair);
+    counting_alignment::started = 0u;
+    counting_alignment::finished = 0u;
+
+    {
+        alignment_executor_t exec{sequence_pairs, algorithm_t{counting_alignment{}}};
+
+        // Stop after a few results while the next window is computed ahead.
+        for (size_t i = 0; i < 10u; ++i)
+            EXPECT_EQ(exec.bump().value(), 7u);
+    }
+
+    EXPECT_EQ(counting_alignment::started.load(), counting_alignment::finished.load());
+    EXPECT_LT(counting_alignment::finished.load(), sequence_pairs.size());
+}
+
+TYPED_TEST(alignment_executor_two_way_test, single_pass_sequence_pairs_over_multiple_windows)
+{
+    using sequence_pairs_t = typename TestFixture::sequence_pairs_t;
+    using single_pass_pairs_t = decltype(std::declval<sequence_pairs_t &>() | seqan3::views::single_pass_input);
+    using algorithm_t = typename algorithm_type_for_input<single_pass_pairs_t>::type;
+    using alignment_executor_t = seqan3::detail::alignment_executor_two_way<single_pass_pairs_t,
+                                                                            algorithm_t,
+                                                                            TypeParam>;
+
+    size_t const pair_count = 3 * alignment_executor_t::default_window_size + 7;
+    sequence_pairs_t sequence_pairs{};
+    for (size_t i = 1; i <= pair_count; ++i)
+        sequence_pairs.emplace_back(std::string(i % 50, 'A'), std::string(i % 50, 'A'));
+
+    alignment_executor_t exec{sequence_pairs | seqan3::views::single_pass_input, algorithm_t{dummy_alignment{}}, 3u};
+
+    for (size_t i = 1; i <= pair_count / 2; ++i)
+        EXPECT_EQ(exec.bump().value(), i % 50);
+
+    // Move while the next window might still be computed.
+    alignment_executor_t exec_moved{std::move(exec)};
+    for (size_t i = pair_count / 2 + 1; i <= pair_count; ++i)
+        EXPECT_EQ(exec_moved.bump().value(), i % 50);
+
+    EXPECT_FALSE(static_cast<bool>(exec_moved.bump()));
+}
@@ -0,0 +1,58 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/pairwise/execution/execution_handler_thread_pool.hpp>
+
+#include "execution_handler_template.hpp"
+
+using namespace seqan3;
+
+// The typed test default constructs the handler, hence it is bound to a pool shared by all tests.
+struct execution_handler_shared_pool : public detail::execution_handler_thread_pool
+{
+    execution_handler_shared_pool() : detail::execution_handler_thread_pool{shared_pool()}
+    {}
+
+    static thread_pool & shared_pool()
+    {
+        static thread_pool pool{4};
+        return pool;
+    }
+};
+
+INSTANTIATE_TYPED_TEST_SUITE_P(execution_handler_thread_pool, execution_handler, execution_handler_shared_pool, );
+
+TEST(execution_handler_thread_pool, reuse_after_wait)
+{
+    thread_pool pool{2};
+    detail::execution_handler_thread_pool exec_handler{pool};
+
+    std::vector<dna4_vector> sequences{test::generate_sequence<dna4>(20, 5, 0), test::generate_sequence<dna4>(30, 5, 1)};
+    auto indexed_sequence_pairs = views::zip(views::zip(sequences, sequences), std::views::iota(0));
+
+    for (size_t round = 0; round < 50u; ++round)
+    {
+        std::atomic<size_t> sum{0u};
+        exec_handler.execute(simulate_alignment_with_range, indexed_sequence_pairs, [&sum] (auto res_range)
+        {
+            for (auto && [idx, size] : res_range)
+                sum += size;
+        });
+        exec_handler.wait();
+
+        EXPECT_EQ(sum.load(), 100u);
+    }
+
+    detail::execution_handler_thread_pool moved_handler{};
+    moved_handler = std::move(exec_handler);
+    moved_handler.execute(simulate_alignment_with_range, indexed_sequence_pairs, [] (auto res_range)
+    {
+        EXPECT_EQ(res_range.size(), 2u);
+    });
+}
@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/alignment_sequence_pairs.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using namespace seqan3;
+
+struct length_binning_test : public ::testing::Test
+{
+    static constexpr auto base_cfg = align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                                     align_cfg::scoring{nucleotide_scoring_scheme{match_score{4},
+                                                                                  mismatch_score{-5}}} |
+                                     align_cfg::vectorise;
+
+    // Alternating short and long pairs, such that every simd vector of the input order mixes both.
+    test::sequence_pair_collection<dna4> sequences = test::random_sequence_pairs<dna4>(75u, [] (size_t const seed)
+    {
+        size_t const length = (seed % 2u == 0u) ? seed % 20u : 150u + seed;
+        return std::pair{length, length};
+    }, 10u);
+
+    template <typename align_cfg_t>
+    void check(align_cfg_t const & cfg, uint32_t const window)
+    {
+        test::expect_same_alignments(sequences, cfg, cfg | align_cfg::length_binning{window}, [] (auto const & result)
+        {
+            return std::tuple{result.score(),
+                              result.back_coordinate(),
+                              result.front_coordinate(),
+                              result.alignment()};
+        });
+    }
+};
+
+TEST_F(length_binning_test, global)
+{
+    check(align_cfg::mode{global_alignment} | base_cfg | align_cfg::result{with_alignment}, 1u);
+    check(align_cfg::mode{global_alignment} | base_cfg | align_cfg::result{with_alignment}, 40u);
+    check(align_cfg::mode{global_alignment} | base_cfg | align_cfg::result{with_alignment}, 1000u);
+}
+
+TEST_F(length_binning_test, semi_global)
+{
+    check(align_cfg::mode{global_alignment} | align_cfg::aligned_ends{free_ends_first} | base_cfg |
+          align_cfg::result{with_alignment}, 64u);
+}
+
+TEST_F(length_binning_test, local)
+{
+    check(align_cfg::mode{local_alignment} | base_cfg | align_cfg::result{with_alignment}, 64u);
+}
+
+TEST_F(length_binning_test, adaptive_score_width)
+{
+    check(align_cfg::mode{global_alignment} | base_cfg | align_cfg::adaptive_score_width |
+          align_cfg::result{with_alignment}, 100u);
+}
+
+TEST_F(length_binning_test, parallel)
+{
+    check(align_cfg::mode{global_alignment} | base_cfg | align_cfg::parallel{4} | align_cfg::result{with_alignment},
+          32u);
+}
+
+TEST_F(length_binning_test, empty_window)
+{
+    EXPECT_THROW(align_pairwise(sequences, align_cfg::mode{global_alignment} | base_cfg |
+                                           align_cfg::length_binning{0u}),
+                 invalid_alignment_configuration);
+}
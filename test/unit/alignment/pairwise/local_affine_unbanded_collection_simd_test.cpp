@@ -0,0 +1,46 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+
+#include "fixture/local_affine_unbanded.hpp"
+#include "pairwise_alignment_collection_test_template.hpp"
+
+namespace seqan3::test::alignment::collection::simd::local::affine::unbanded
+{
+
+// The substitution matrix is scored with the simd_matrix_scoring_scheme.
+static auto aa27_blosum62 = []()
+{
+    auto base_fixture_01 = fixture::local::affine::unbanded::aa27_01;
+    auto base_fixture_02 = fixture::local::affine::unbanded::aa27_02;
+
+    using fixture_t = decltype(base_fixture_01);
+
+    std::vector<fixture_t> data{};
+    for (size_t i = 0; i < 50; ++i)
+    {
+        data.push_back(base_fixture_01);
+        data.push_back(base_fixture_02);
+    }
+
+    return alignment_fixture_collection{base_fixture_01.config | align_cfg::vectorise, data};
+}();
+
+} // namespace seqan3::test::alignment::collection::simd::local::affine::unbanded
+
+using pairwise_collection_simd_local_affine_unbanded_testing_types = ::testing::Types<
+        pairwise_alignment_fixture<&seqan3::test::alignment::collection::simd::local::affine::unbanded::aa27_blosum62>
+    >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_collection_simd_local_affine_unbanded,
+                               pairwise_alignment_collection_test,
+                               pairwise_collection_simd_local_affine_unbanded_testing_types, );
@@ -0,0 +1,97 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/alignment_sequence_pairs.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using namespace seqan3;
+
+struct min_score_alignment_test : public ::testing::Test
+{
+    static constexpr auto affine_cfg = align_cfg::mode{global_alignment} |
+                                       align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                                       align_cfg::scoring{nucleotide_scoring_scheme{match_score{4},
+                                                                                    mismatch_score{-5}}};
+
+    // Pairs of similar sequences with an increasing number of substitutions, such that the scores cover a wide range.
+    test::sequence_pair_collection<dna4> sequences = test::similar_sequence_pairs<dna4>(
+        50u,
+        [] (size_t const seed) { return std::pair{60u + seed % 20u, 60u + seed % 20u + seed % 5u - 2u}; },
+        [] (size_t const seed) { return std::pair{seed % 5u, 1u + (50u - seed) / 4u}; });
+
+    // The scores that reach the minimal score are the same as without it, all others are lower than the minimal score.
+    template <typename align_cfg_t>
+    void check(align_cfg_t const & cfg, int32_t const min_score)
+    {
+        test::expect_same_alignments(sequences, cfg, cfg | align_cfg::min_score{min_score}, [&] (auto const & result)
+        {
+            return std::max<int32_t>(result.score(), min_score - 1);
+        });
+    }
+};
+
+TEST_F(min_score_alignment_test, global_affine)
+{
+    for (int32_t min_score : {-200, 0, 100, 200})
+        check(affine_cfg | align_cfg::result{with_score}, min_score);
+}
+
+TEST_F(min_score_alignment_test, global_affine_alignment)
+{
+    auto cfg = affine_cfg | align_cfg::result{with_alignment};
+
+    // Only the alignments that reach the minimal score are specified.
+    test::expect_same_alignments(sequences, cfg, cfg | align_cfg::min_score{100}, [] (auto const & result)
+    {
+        using members_t = decltype(std::tuple{result.score(), result.front_coordinate(), result.alignment()});
+        if (result.score() < 100)
+            return members_t{};
+
+        return members_t{result.score(), result.front_coordinate(), result.alignment()};
+    });
+}
+
+TEST_F(min_score_alignment_test, global_affine_banded)
+{
+    auto cfg = affine_cfg | align_cfg::band{static_band{lower_bound{-8}, upper_bound{8}}};
+
+    for (int32_t min_score : {-200, 0, 100, 200})
+        check(cfg | align_cfg::result{with_score}, min_score);
+}
+
+TEST_F(min_score_alignment_test, edit_distance)
+{
+    for (int32_t min_score : {-30, -10, -3, 0})
+    {
+        check(align_cfg::edit | align_cfg::result{with_score}, min_score);
+        check(align_cfg::edit | align_cfg::band{static_band{lower_bound{-8}, upper_bound{8}}} |
+              align_cfg::result{with_score}, min_score);
+    }
+}
+
+TEST_F(min_score_alignment_test, invalid_configuration)
+{
+    EXPECT_THROW((align_pairwise(sequences, affine_cfg | align_cfg::aligned_ends{free_ends_all} |
+                                            align_cfg::min_score{0}) | views::to<std::vector>),
+                 invalid_alignment_configuration);
+
+    EXPECT_THROW((align_pairwise(sequences, align_cfg::edit | align_cfg::min_score{1}) | views::to<std::vector>),
+                 invalid_alignment_configuration);
+}
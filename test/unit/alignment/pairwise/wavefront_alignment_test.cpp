@@ -0,0 +1,210 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using namespace seqan3;
+
+struct wavefront_alignment_test : public ::testing::Test
+{
+    static constexpr auto base_cfg = align_cfg::mode{global_alignment} |
+                                     align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                                     align_cfg::scoring{nucleotide_scoring_scheme{match_score{4},
+                                                                                  mismatch_score{-5}}};
+
+    // Similar and unrelated sequences of different lengths.
+    static std::vector<std::pair<std::vector<dna4>, std::vector<dna4>>> generate_sequences()
+    {
+        std::vector<std::pair<std::vector<dna4>, std::vector<dna4>>> sequences{};
+
+        for (size_t seed = 0; seed < 40u; ++seed)
+        {
+            size_t const length = (seed % 4u == 3u) ? 500u : seed * 3u;
+            std::vector<dna4> sequence1 = test::generate_sequence<dna4>(length, length / 10u, seed);
+            std::vector<dna4> sequence2 = sequence1;
+
+            if (seed % 2u == 0u) // unrelated
+            {
+                sequence2 = test::generate_sequence<dna4>(length, length / 10u, seed + 100u);
+            }
+            else // similar
+            {
+                for (size_t idx = seed; idx < sequence2.size(); idx += 17u)
+                    sequence2[idx] = dna4{}.assign_rank((sequence2[idx].to_rank() + 1) % 4);
+
+                if (sequence2.size() > 20u)
+                    sequence2.erase(sequence2.begin() + 5, sequence2.begin() + 9);
+            }
+
+            sequences.emplace_back(std::move(sequence1), std::move(sequence2));
+        }
+
+        return sequences;
+    }
+
+    template <typename sequence_t>
+    static std::string without_gaps(sequence_t const & sequence)
+    {
+        std::string characters = sequence | views::to_char | views::to<std::string>;
+        characters.erase(std::remove(characters.begin(), characters.end(), '-'), characters.end());
+        return characters;
+    }
+
+    // Computes the score of an alignment with the gap open score -10, the gap score -1 and match/mismatch 4/-5.
+    template <typename alignment_t>
+    static int32_t rescore(alignment_t const & alignment)
+    {
+        auto const & gapped1 = std::get<0>(alignment);
+        auto const & gapped2 = std::get<1>(alignment);
+
+        int32_t score = 0;
+        bool gap_in_first = false;
+        bool gap_in_second = false;
+        for (size_t idx = 0; idx < std::ranges::size(gapped1); ++idx)
+        {
+            bool const is_gap1 = gapped1[idx] == gap{};
+            bool const is_gap2 = gapped2[idx] == gap{};
+
+            if (is_gap1 || is_gap2)
+                score += -1 + ((is_gap1 && !gap_in_first) || (is_gap2 && !gap_in_second) ? -10 : 0);
+            else
+                score += (gapped1[idx] == gapped2[idx]) ? 4 : -5;
+
+            gap_in_first = is_gap1;
+            gap_in_second = is_gap2;
+        }
+
+        return score;
+    }
+};
+
+TEST_F(wavefront_alignment_test, score)
+{
+    auto sequences = generate_sequences();
+    auto cfg = base_cfg | align_cfg::result{with_back_coordinate};
+
+    auto expected = align_pairwise(sequences, cfg) | views::to<std::vector>;
+    auto actual = align_pairwise(sequences, cfg | align_cfg::wavefront) | views::to<std::vector>;
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t idx = 0; idx < expected.size(); ++idx)
+    {
+        EXPECT_EQ(actual[idx].id(), expected[idx].id());
+        EXPECT_EQ(actual[idx].score(), expected[idx].score());
+        EXPECT_EQ(actual[idx].back_coordinate(), expected[idx].back_coordinate());
+    }
+}
+
+TEST_F(wavefront_alignment_test, alignment)
+{
+    auto sequences = generate_sequences();
+    auto cfg = base_cfg | align_cfg::result{with_alignment};
+
+    auto expected = align_pairwise(sequences, cfg) | views::to<std::vector>;
+    auto actual = align_pairwise(sequences, cfg | align_cfg::wavefront) | views::to<std::vector>;
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t idx = 0; idx < expected.size(); ++idx)
+    {
+        EXPECT_EQ(actual[idx].score(), expected[idx].score());
+        EXPECT_EQ(actual[idx].front_coordinate(), expected[idx].front_coordinate());
+        EXPECT_EQ(actual[idx].back_coordinate(), expected[idx].back_coordinate());
+
+        // Among co-optimal alignments another one may be chosen.
+        auto const & alignment = actual[idx].alignment();
+        EXPECT_EQ(rescore(alignment), expected[idx].score());
+        EXPECT_EQ(without_gaps(std::get<0>(alignment)), without_gaps(sequences[idx].first));
+        EXPECT_EQ(without_gaps(std::get<1>(alignment)), without_gaps(sequences[idx].second));
+    }
+}
+
+TEST_F(wavefront_alignment_test, empty_sequences)
+{
+    std::vector<dna4> sequence1{};
+    std::vector<dna4> sequence2{"ACGT"_dna4};
+    auto cfg = base_cfg | align_cfg::wavefront | align_cfg::result{with_alignment};
+
+    auto result = *align_pairwise(std::tie(sequence1, sequence2), cfg).begin();
+    EXPECT_EQ(result.score(), -14);
+    EXPECT_EQ(result.back_coordinate(), (alignment_coordinate{column_index_type{0u}, row_index_type{4u}}));
+    EXPECT_RANGE_EQ(std::get<0>(result.alignment()) | views::to_char, std::string{"----"});
+
+    result = *align_pairwise(std::tie(sequence1, sequence1), cfg).begin();
+    EXPECT_EQ(result.score(), 0);
+}
+
+TEST_F(wavefront_alignment_test, parallel)
+{
+    auto sequences = generate_sequences();
+    auto cfg = base_cfg | align_cfg::result{with_score};
+
+    auto expected = align_pairwise(sequences, cfg) | views::to<std::vector>;
+    auto actual = align_pairwise(sequences, cfg | align_cfg::wavefront | align_cfg::parallel{4}) |
+                  views::to<std::vector>;
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t idx = 0; idx < expected.size(); ++idx)
+        EXPECT_EQ(actual[idx].score(), expected[idx].score());
+}
+
+TEST_F(wavefront_alignment_test, result_buffer)
+{
+    auto sequences = generate_sequences();
+    auto cfg = base_cfg | align_cfg::result{with_alignment} | align_cfg::wavefront;
+
+    auto expected = align_pairwise(sequences, cfg) | views::to<std::vector>;
+    decltype(expected) results(sequences.size());
+    EXPECT_EQ(align_pairwise(sequences, cfg, results), sequences.size());
+
+    for (size_t idx = 0; idx < expected.size(); ++idx)
+    {
+        EXPECT_EQ(results[idx].score(), expected[idx].score());
+        EXPECT_EQ(results[idx].alignment(), expected[idx].alignment());
+    }
+
+    // The statically dispatched alignment must not fall back to the dynamic programming for invalid configurations.
+    auto with_free_gaps = align_cfg::mode{global_alignment} | align_cfg::gap{gap_scheme{gap_score{0}}} |
+                          align_cfg::scoring{nucleotide_scoring_scheme{}} | align_cfg::wavefront;
+    using score_result_t = std::ranges::range_value_t<decltype(align_pairwise(sequences, with_free_gaps))>;
+    std::vector<score_result_t> scores(sequences.size());
+    EXPECT_THROW(align_pairwise(sequences, with_free_gaps, scores), invalid_alignment_configuration);
+}
+
+TEST_F(wavefront_alignment_test, invalid_configuration)
+{
+    std::vector<dna4> sequence{"ACGT"_dna4};
+    std::vector<aa27> protein{"ACGT"_aa27};
+
+    auto with_free_ends = base_cfg | align_cfg::aligned_ends{free_ends_first} | align_cfg::wavefront;
+    EXPECT_THROW(align_pairwise(std::tie(sequence, sequence), with_free_ends), invalid_alignment_configuration);
+
+    auto with_matrix = align_cfg::mode{global_alignment} | align_cfg::gap{gap_scheme{gap_score{-1}}} |
+                       align_cfg::scoring{aminoacid_scoring_scheme{aminoacid_similarity_matrix::BLOSUM62}} |
+                       align_cfg::wavefront;
+    EXPECT_THROW(align_pairwise(std::tie(protein, protein), with_matrix), invalid_alignment_configuration);
+
+    auto with_free_gaps = align_cfg::mode{global_alignment} | align_cfg::gap{gap_scheme{gap_score{0}}} |
+                          align_cfg::scoring{nucleotide_scoring_scheme{}} | align_cfg::wavefront;
+    EXPECT_THROW(align_pairwise(std::tie(sequence, sequence), with_free_gaps), invalid_alignment_configuration);
+}
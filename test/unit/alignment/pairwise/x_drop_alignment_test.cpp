@@ -0,0 +1,139 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using namespace seqan3;
+
+struct x_drop_alignment_test : public ::testing::Test
+{
+    static constexpr auto base_cfg = align_cfg::mode{global_alignment} |
+                                     align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                                     align_cfg::scoring{nucleotide_scoring_scheme{match_score{4},
+                                                                                  mismatch_score{-5}}};
+
+    // Ten matches, five mismatches (-25) and twenty matches.
+    std::vector<dna4> sequence1{"AAAAAAAAAACCCCCAAAAAAAAAAAAAAAAAAAA"_dna4};
+    std::vector<dna4> sequence2{"AAAAAAAAAAGGGGGAAAAAAAAAAAAAAAAAAAA"_dna4};
+
+    // Returns the score and the coordinate of the first best cell in column-major order of the debug score matrix.
+    template <typename align_cfg_t>
+    static std::pair<int32_t, std::pair<size_t, size_t>> best_cell(std::vector<dna4> const & seq1,
+                                                                   std::vector<dna4> const & seq2,
+                                                                   align_cfg_t const & cfg)
+    {
+        auto res = *align_pairwise(std::tie(seq1, seq2), cfg | align_cfg::debug).begin();
+        auto const & score_matrix = res.score_matrix();
+
+        std::pair<int32_t, std::pair<size_t, size_t>> best{std::numeric_limits<int32_t>::lowest(), {0u, 0u}};
+        for (size_t col = 0; col < score_matrix.cols(); ++col)
+        {
+            for (size_t row = 0; row < score_matrix.rows(); ++row)
+            {
+                detail::matrix_coordinate const coordinate{detail::row_index_type{row}, detail::column_index_type{col}};
+                std::optional<int32_t> const score = score_matrix[coordinate];
+                if (score.has_value() && *score > best.first)
+                    best = {*score, {col, row}};
+            }
+        }
+
+        return best;
+    }
+};
+
+TEST_F(x_drop_alignment_test, stops_at_drop)
+{
+    auto cfg = base_cfg | align_cfg::x_drop{20} | align_cfg::result{with_alignment};
+    auto res = *align_pairwise(std::tie(sequence1, sequence2), cfg).begin();
+
+    EXPECT_EQ(res.score(), 40);
+    EXPECT_EQ(res.back_coordinate(), (alignment_coordinate{detail::column_index_type{10u},
+                                                           detail::row_index_type{10u}}));
+    EXPECT_EQ(res.front_coordinate(), (alignment_coordinate{detail::column_index_type{0u},
+                                                            detail::row_index_type{0u}}));
+}
+
+TEST_F(x_drop_alignment_test, passes_drop)
+{
+    auto cfg = base_cfg | align_cfg::x_drop{30} | align_cfg::result{with_alignment};
+    auto res = *align_pairwise(std::tie(sequence1, sequence2), cfg).begin();
+
+    EXPECT_EQ(res.score(), 95);
+    EXPECT_EQ(res.back_coordinate(), (alignment_coordinate{detail::column_index_type{35u},
+                                                           detail::row_index_type{35u}}));
+    EXPECT_EQ(res.front_coordinate(), (alignment_coordinate{detail::column_index_type{0u},
+                                                            detail::row_index_type{0u}}));
+    EXPECT_EQ(std::ranges::size(std::get<0>(res.alignment())), 35u);
+}
+
+TEST_F(x_drop_alignment_test, banded)
+{
+    auto cfg = base_cfg | align_cfg::band{static_band{lower_bound{-3}, upper_bound{3}}};
+
+    auto res20 = *align_pairwise(std::tie(sequence1, sequence2), cfg | align_cfg::x_drop{20}
+                                                                     | align_cfg::result{with_back_coordinate}).begin();
+    EXPECT_EQ(res20.score(), 40);
+    EXPECT_EQ(res20.back_coordinate(), (alignment_coordinate{detail::column_index_type{10u},
+                                                             detail::row_index_type{10u}}));
+
+    auto res30 = *align_pairwise(std::tie(sequence1, sequence2), cfg | align_cfg::x_drop{30}
+                                                                     | align_cfg::result{with_alignment}).begin();
+    EXPECT_EQ(res30.score(), 95);
+    EXPECT_EQ(res30.back_coordinate(), (alignment_coordinate{detail::column_index_type{35u},
+                                                             detail::row_index_type{35u}}));
+}
+
+TEST_F(x_drop_alignment_test, without_drop_finds_best_cell)
+{
+    // Nothing is dropped, so the extension ends in the best cell of the whole matrix.
+    for (size_t seed = 0; seed < 10u; ++seed)
+    {
+        std::vector<dna4> seq1 = test::generate_sequence<dna4>(60, 10, seed);
+        std::vector<dna4> seq2 = test::generate_sequence<dna4>(60, 10, seed + 100);
+
+        auto check = [&] (auto const & cfg)
+        {
+            auto const [expected_score, expected_coordinate] = best_cell(seq1, seq2,
+                                                                         cfg | align_cfg::result{with_score});
+            auto res = *align_pairwise(std::tie(seq1, seq2), cfg | align_cfg::x_drop{1'000'000}
+                                                                 | align_cfg::result{with_back_coordinate}).begin();
+
+            EXPECT_EQ(res.score(), expected_score);
+            EXPECT_EQ(res.back_coordinate().first, expected_coordinate.first);
+            EXPECT_EQ(res.back_coordinate().second, expected_coordinate.second);
+        };
+
+        check(base_cfg);
+        check(base_cfg | align_cfg::band{static_band{lower_bound{-10}, upper_bound{10}}});
+    }
+}
+
+TEST_F(x_drop_alignment_test, edit_distance)
+{
+    // The edit distance has no positive scores, so the extension could never leave the origin.
+    auto cfg = align_cfg::edit | align_cfg::x_drop{2} | align_cfg::result{with_back_coordinate};
+    EXPECT_THROW(align_pairwise(std::tie(sequence1, sequence2), cfg), invalid_alignment_configuration);
+}
+
+TEST_F(x_drop_alignment_test, invalid_configuration)
+{
+    EXPECT_THROW(align_pairwise(std::tie(sequence1, sequence2), base_cfg | align_cfg::x_drop{-1}),
+                 invalid_alignment_configuration);
+}
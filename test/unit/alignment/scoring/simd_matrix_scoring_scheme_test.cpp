@@ -221,3 +221,56 @@ TYPED_TEST(simd_matrix_scoring_scheme_test, score_local_with_padding)
     simd_value2[0] = 3;
     SIMD_EQ(scheme.score(simd_value1, simd_value2), result);
 }
+
+TYPED_TEST(simd_matrix_scoring_scheme_test, score_with_profile)
+{
+    using scheme_t = simd_matrix_scoring_scheme<TypeParam,
+                                                aa27,
+                                                detail::global_alignment_type,
+                                                aminoacid_scoring_scheme<>>;
+
+    scheme_t scheme{aminoacid_scoring_scheme{aminoacid_similarity_matrix::BLOSUM62}};
+    constexpr size_t length = simd_traits<TypeParam>::length;
+
+    // Every lane holds another symbol and the last lane is padded.
+    TypeParam simd_value1{};
+    for (size_t i = 0; i < length; ++i)
+        simd_value1[i] = i % alphabet_size<aa27>;
+    simd_value1[length - 1] = this->padded_value1;
+
+    auto const profile = scheme.make_profile(simd_value1);
+
+    for (size_t rank = 0; rank < alphabet_size<aa27>; ++rank)
+    {
+        TypeParam simd_value2 = simd::fill<TypeParam>(rank);
+        SIMD_EQ(scheme.score(profile, simd_value2), scheme.score(simd_value1, simd_value2));
+
+        simd_value2[0] = this->padded_value2;
+        SIMD_EQ(scheme.score(profile, simd_value2), scheme.score(simd_value1, simd_value2));
+    }
+}
+
+TYPED_TEST(simd_matrix_scoring_scheme_test, symbol_profile)
+{
+    using scheme_t = simd_matrix_scoring_scheme<TypeParam,
+                                                aa27,
+                                                detail::global_alignment_type,
+                                                aminoacid_scoring_scheme<>>;
+
+    scheme_t scheme{aminoacid_scoring_scheme{aminoacid_similarity_matrix::BLOSUM62}};
+
+    for (size_t rank = 0; rank < alphabet_size<aa27>; ++rank)
+    {
+        auto const & profile = scheme.symbol_profile(rank);
+        auto const expected = scheme.make_profile(simd::fill<TypeParam>(rank));
+
+        for (size_t symbol = 0; symbol <= alphabet_size<aa27>; ++symbol)
+            SIMD_EQ(profile.scores[symbol], expected.scores[symbol]);
+    }
+
+    // The padded symbol has its own profile.
+    auto const & padded_profile = scheme.symbol_profile(this->padded_value1);
+    TypeParam simd_value2 = simd::fill<TypeParam>(3);
+    SIMD_EQ(scheme.score(padded_profile, simd_value2),
+            scheme.score(simd::fill<TypeParam>(this->padded_value1), simd_value2));
+}
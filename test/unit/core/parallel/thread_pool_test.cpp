@@ -0,0 +1,65 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/core/parallel/thread_pool.hpp>
+
+using namespace seqan3;
+
+struct counting_task : public detail::thread_pool_task
+{
+    counting_task(thread_pool & pool, std::atomic<size_t> & counter) : pool{&pool}, counter{&counter}
+    {
+        execute = [] (detail::thread_pool_task & task) noexcept
+        {
+            counting_task & self = static_cast<counting_task &>(task);
+            self.worker_index = self.pool->worker_index();
+            self.counter->fetch_add(1u);
+        };
+    }
+
+    thread_pool * pool{};
+    std::atomic<size_t> * counter{};
+    size_t worker_index{};
+};
+
+TEST(thread_pool, construction)
+{
+    EXPECT_FALSE(std::is_copy_constructible_v<thread_pool>);
+    EXPECT_FALSE(std::is_move_constructible_v<thread_pool>);
+
+    thread_pool pool{3};
+    EXPECT_EQ(pool.size(), 3u);
+    EXPECT_EQ(pool.worker_index(), 3u);
+
+    thread_pool default_pool{};
+    EXPECT_GE(default_pool.size(), 1u);
+
+    EXPECT_THROW(thread_pool{0}, std::invalid_argument);
+}
+
+TEST(thread_pool, destruction_executes_all_tasks)
+{
+    std::atomic<size_t> counter{0u};
+    std::vector<counting_task> tasks{};
+
+    {
+        thread_pool pool{4};
+        tasks.reserve(10000);
+        for (size_t i = 0; i < 10000u; ++i)
+            pool.submit(tasks.emplace_back(pool, counter));
+    }
+
+    EXPECT_EQ(counter.load(), 10000u);
+    for (counting_task const & task : tasks)
+        EXPECT_LT(task.worker_index, 4u);
+}